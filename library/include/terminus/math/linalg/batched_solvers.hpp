@@ -0,0 +1,365 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    batched_solvers.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/fixed_size_solvers.hpp>
+#include <terminus/math/parallel_for.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <span>
+#include <string>
+
+namespace tmns::math::linalg {
+
+/**
+ * Execution controls for the batched solvers
+ */
+struct Batch_Solver_Options
+{
+    /// @brief Number of worker threads.  Zero uses the hardware concurrency.
+    size_t num_threads { 0 };
+
+    /// @brief Number of problems handed to a worker at a time
+    size_t grain_size { 256 };
+}; // End of Batch_Solver_Options struct
+
+/**
+ * Number of problems solved side-by-side by the lane kernels.  Sized so one lane group of
+ * a single matrix element fills a 256-bit vector register.
+ */
+template <typename ValueT>
+constexpr size_t batch_lane_count()
+{
+    return std::max<size_t>( 1, 32 / sizeof(ValueT) );
+}
+
+namespace detail {
+
+/**
+ * Cholesky solve of L independent N x N systems stored element-major ( a[element][lane] ).
+ *
+ * The innermost loop of every step runs across the lanes, so each arithmetic operation maps
+ * onto one SIMD instruction covering L problems.  Lanes which fail keep computing on a
+ * harmless placeholder pivot so the remaining lanes are not disturbed; their status records
+ * the failure and their output is ignored by the caller.
+ */
+template <typename ValueT,
+          size_t   N,
+          size_t   L>
+void cholesky_solve_lanes( std::array<std::array<ValueT,L>,N*N>& a,
+                           std::array<std::array<ValueT,L>,N>&   b,
+                           std::array<Solve_Status,L>&           status )
+{
+    std::array<std::array<ValueT,L>,N> inv_diag;
+    std::array<bool,L> failed {};
+
+    // Right-looking factorization:  scale column j, then update the trailing lower triangle
+    for( size_t j = 0; j < N; j++ )
+    {
+        for( size_t l = 0; l < L; l++ )
+        {
+            const ValueT d   = a[j*N+j][l];
+            const bool   bad = !( d > ValueT( 0 ) );
+            failed[l]        = failed[l] || bad;
+            const ValueT ljj = std::sqrt( bad ? ValueT( 1 ) : d );
+            a[j*N+j][l]      = ljj;
+            inv_diag[j][l]   = ValueT( 1 ) / ljj;
+        }
+
+        for( size_t i = j + 1; i < N; i++ )
+        {
+            for( size_t l = 0; l < L; l++ )
+            {
+                a[i*N+j][l] *= inv_diag[j][l];
+            }
+        }
+
+        for( size_t i = j + 1; i < N; i++ )
+        {
+            for( size_t c = j + 1; c <= i; c++ )
+            {
+                for( size_t l = 0; l < L; l++ )
+                {
+                    a[i*N+c][l] -= a[i*N+j][l] * a[c*N+j][l];
+                }
+            }
+        }
+    }
+
+    // Forward substitution
+    for( size_t i = 0; i < N; i++ )
+    {
+        for( size_t k = 0; k < i; k++ )
+        {
+            for( size_t l = 0; l < L; l++ )
+            {
+                b[i][l] -= a[i*N+k][l] * b[k][l];
+            }
+        }
+        for( size_t l = 0; l < L; l++ )
+        {
+            b[i][l] *= inv_diag[i][l];
+        }
+    }
+
+    // Back substitution
+    for( size_t ii = N; ii-- > 0; )
+    {
+        for( size_t k = ii + 1; k < N; k++ )
+        {
+            for( size_t l = 0; l < L; l++ )
+            {
+                b[ii][l] -= a[k*N+ii][l] * b[k][l];
+            }
+        }
+        for( size_t l = 0; l < L; l++ )
+        {
+            b[ii][l] *= inv_diag[ii][l];
+        }
+    }
+
+    for( size_t l = 0; l < L; l++ )
+    {
+        status[l] = failed[l] ? Solve_Status::NOT_POSITIVE_DEFINITE : Solve_Status::SUCCESS;
+    }
+}
+
+/**
+ * Shared driver for the SPD batch.  Gathers lane groups using the supplied accessors,
+ * solves them with the lane kernel and scatters the results back.
+ */
+template <typename ValueT,
+          size_t   N,
+          typename LoadT,
+          typename StoreT>
+void batch_cholesky_driver( size_t                      count,
+                            const Batch_Solver_Options& options,
+                            LoadT&&                     load,
+                            StoreT&&                    store )
+{
+    constexpr size_t L = batch_lane_count<ValueT>();
+
+    // Keep chunk boundaries on lane-group boundaries so only the final group is partial
+    const size_t grain = ( ( std::max<size_t>( options.grain_size, L ) + L - 1 ) / L ) * L;
+
+    parallel_for( count, options.num_threads, grain,
+                  [&]( size_t begin, size_t end, size_t )
+    {
+        std::array<std::array<ValueT,L>,N*N> a;
+        std::array<std::array<ValueT,L>,N>   b;
+        std::array<Solve_Status,L>           lane_status;
+
+        for( size_t p0 = begin; p0 < end; p0 += L )
+        {
+            const size_t lanes = std::min( L, end - p0 );
+            for( size_t l = 0; l < lanes; l++ )
+            {
+                load( p0 + l, l, a, b );
+            }
+
+            // Pad a partial group with identity systems
+            for( size_t l = lanes; l < L; l++ )
+            {
+                for( size_t e = 0; e < N * N; e++ )
+                {
+                    a[e][l] = ( e % ( N + 1 ) == 0 ) ? ValueT( 1 ) : ValueT( 0 );
+                }
+                for( size_t r = 0; r < N; r++ )
+                {
+                    b[r][l] = ValueT( 0 );
+                }
+            }
+
+            cholesky_solve_lanes<ValueT,N,L>( a, b, lane_status );
+
+            for( size_t l = 0; l < lanes; l++ )
+            {
+                store( p0 + l, l, b, lane_status[l] );
+            }
+        }
+    });
+}
+
+/**
+ * Validate the sizes of the batch spans
+ */
+inline Result<void> check_batch_sizes( size_t num_a,
+                                       size_t num_b,
+                                       size_t num_x,
+                                       size_t num_status )
+{
+    if( num_b != num_a || num_x != num_a || num_status != num_a )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Batch size mismatch. A: " + std::to_string( num_a ) +
+                              ", b: " + std::to_string( num_b ) +
+                              ", x: " + std::to_string( num_x ) +
+                              ", status: " + std::to_string( num_status ) );
+    }
+    return outcome::ok();
+}
+
+} // End of detail namespace
+
+/**
+ * Solve A[p] x[p] = b[p] for a batch of small symmetric positive-definite systems.
+ *
+ * Problems are processed in groups of batch_lane_count<ValueT>() so that each SIMD lane
+ * carries a different problem, and groups are spread across worker threads.  A failure in
+ * one problem does not affect any other; it is reported in status[p] and x[p] is left
+ * untouched.
+ *
+ * All spans must have the same length.  Only the lower triangle of each A is read.
+ */
+template <typename ValueT,
+          size_t   N>
+Result<void> batch_solve_symmetric( std::span<const Matrix<ValueT,N,N>> A,
+                                    std::span<const Vector_<ValueT,N>>  b,
+                                    std::span<Vector_<ValueT,N>>        x,
+                                    std::span<Solve_Status>             status,
+                                    const Batch_Solver_Options&         options = Batch_Solver_Options() )
+{
+    auto res = detail::check_batch_sizes( A.size(), b.size(), x.size(), status.size() );
+    if( res.has_error() )
+    {
+        return res;
+    }
+
+    constexpr size_t L = batch_lane_count<ValueT>();
+    detail::batch_cholesky_driver<ValueT,N>( A.size(), options,
+        [&]( size_t p, size_t l, auto& a_lanes, auto& b_lanes )
+        {
+            const auto& Ap = A[p];
+            const auto& bp = b[p];
+            size_t e = 0;
+            for( auto it = Ap.begin(); it != Ap.end(); it++, e++ )
+            {
+                a_lanes[e][l] = *it;
+            }
+            for( size_t r = 0; r < N; r++ )
+            {
+                b_lanes[r][l] = bp.data()[r];
+            }
+        },
+        [&]( size_t p, size_t l, const std::array<std::array<ValueT,L>,N>& b_lanes, Solve_Status s )
+        {
+            status[p] = s;
+            if( s == Solve_Status::SUCCESS )
+            {
+                for( size_t r = 0; r < N; r++ )
+                {
+                    x[p].data()[r] = b_lanes[r][l];
+                }
+            }
+        });
+
+    return outcome::ok();
+}
+
+/**
+ * Structure-of-arrays variant of batch_solve_symmetric().
+ *
+ * Element (i,j) of problem p is A[( i * N + j ) * count + p] and entry i of its right-hand
+ * side and solution is b[i * count + p] / x[i * count + p].  This layout lets the lane
+ * gather read contiguous memory, and is the preferred form for very large batches.
+ */
+template <typename ValueT,
+          size_t   N>
+Result<void> batch_solve_symmetric_soa( size_t                      count,
+                                        std::span<const ValueT>     A,
+                                        std::span<const ValueT>     b,
+                                        std::span<ValueT>           x,
+                                        std::span<Solve_Status>     status,
+                                        const Batch_Solver_Options& options = Batch_Solver_Options() )
+{
+    if( A.size() != N * N * count || b.size() != N * count || x.size() != N * count )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Structure-of-arrays buffers do not match a batch of " +
+                              std::to_string( count ) + " problems of size " + std::to_string( N ) );
+    }
+    if( status.size() != count )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Status size (" + std::to_string( status.size() ) +
+                              ") does not match batch size (" + std::to_string( count ) + ")" );
+    }
+
+    constexpr size_t L = batch_lane_count<ValueT>();
+    detail::batch_cholesky_driver<ValueT,N>( count, options,
+        [&]( size_t p, size_t l, auto& a_lanes, auto& b_lanes )
+        {
+            for( size_t e = 0; e < N * N; e++ )
+            {
+                a_lanes[e][l] = A[e * count + p];
+            }
+            for( size_t r = 0; r < N; r++ )
+            {
+                b_lanes[r][l] = b[r * count + p];
+            }
+        },
+        [&]( size_t p, size_t l, const std::array<std::array<ValueT,L>,N>& b_lanes, Solve_Status s )
+        {
+            status[p] = s;
+            if( s == Solve_Status::SUCCESS )
+            {
+                for( size_t r = 0; r < N; r++ )
+                {
+                    x[r * count + p] = b_lanes[r][l];
+                }
+            }
+        });
+
+    return outcome::ok();
+}
+
+/**
+ * Solve A[p] x[p] = b[p] for a batch of small general systems using LU with partial
+ * pivoting.
+ *
+ * Pivoting makes the control flow data-dependent, so problems are solved one at a time with
+ * the unrolled fixed-size kernel and the batch is spread across worker threads.  Singular
+ * problems are reported in status[p] and x[p] is left untouched.
+ */
+template <typename ValueT,
+          size_t   N>
+Result<void> batch_solve( std::span<const Matrix<ValueT,N,N>> A,
+                          std::span<const Vector_<ValueT,N>>  b,
+                          std::span<Vector_<ValueT,N>>        x,
+                          std::span<Solve_Status>             status,
+                          const Batch_Solver_Options&         options = Batch_Solver_Options() )
+{
+    auto res = detail::check_batch_sizes( A.size(), b.size(), x.size(), status.size() );
+    if( res.has_error() )
+    {
+        return res;
+    }
+
+    parallel_for( A.size(), options.num_threads, options.grain_size,
+                  [&]( size_t begin, size_t end, size_t )
+    {
+        for( size_t p = begin; p < end; p++ )
+        {
+            status[p] = lu_solve<ValueT,N>( A[p], b[p], x[p] );
+        }
+    });
+
+    return outcome::ok();
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,324 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    cached_matrix.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/linalg/cholesky_decomposition.hpp>
+#include <terminus/math/linalg/lu_decomposition.hpp>
+#include <terminus/math/linalg/svd.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace tmns::math::linalg {
+
+/**
+ * Matrix wrapper which memoizes its inverse, determinant and LU / Cholesky / SVD factors.
+ *
+ * Every mutation bumps a version counter, and each cached result is stamped with
+ * the version it was computed from, so a result is recomputed only on the first query after
+ * a mutation.  Use this for matrices which are read far more often than they change, such as
+ * calibration, covariance and projection matrices.
+ *
+ * Const queries may run concurrently from any number of threads:  the first reader to find a
+ * stale entry computes it under an exclusive lock while the others wait.  Mutation is not
+ * synchronized and needs exclusive access, the same as a plain matrix.  References returned by
+ * the queries stay valid until the next mutation.
+ *
+ * There is no writable element reference, since a write through one made after a query would
+ * not be seen by the version counter.  Elements are changed with set() or modify().
+ */
+template <typename MatrixT>
+class Cached_Matrix
+{
+    public:
+
+        /// @brief Wrapped matrix type
+        using matrix_type = MatrixT;
+
+        /// @brief Underlying Value Type
+        using value_type = typename MatrixT::value_type;
+
+        /// @brief Type returned by inverse().  Fixed-size matrices stay fixed-size.
+        using inverse_type = decltype( std::declval<const MatrixT&>().inverse() );
+
+        /**
+         * Default Constructor
+         */
+        Cached_Matrix() = default;
+
+        /**
+         * Wrap a copy of a matrix
+         */
+        explicit Cached_Matrix( MatrixT matrix )
+            : m_matrix( std::move( matrix ) )
+        {
+        }
+
+        /**
+         * Copy Constructor.  Copies the matrix but starts with an empty cache.
+         */
+        Cached_Matrix( const Cached_Matrix& rhs )
+            : m_matrix( rhs.m_matrix )
+        {
+        }
+
+        /**
+         * Copy Assignment.  Counts as a mutation.
+         */
+        Cached_Matrix& operator = ( const Cached_Matrix& rhs )
+        {
+            if( this != &rhs )
+            {
+                m_matrix = rhs.m_matrix;
+                m_version++;
+            }
+            return (*this);
+        }
+
+        /**
+         * Replace the wrapped matrix.  Counts as a mutation.
+         */
+        Cached_Matrix& operator = ( const MatrixT& matrix )
+        {
+            m_matrix = matrix;
+            m_version++;
+            return (*this);
+        }
+
+        /**
+         * Read-only access to the wrapped matrix
+         */
+        const MatrixT& matrix() const
+        {
+            return m_matrix;
+        }
+
+        /**
+         * Read-only element access
+         */
+        const value_type& operator()( size_t row, size_t col ) const
+        {
+            return m_matrix( row, col );
+        }
+
+        /**
+         * Set one element.  Counts as a mutation.
+         */
+        void set( size_t            row,
+                  size_t            col,
+                  const value_type& value )
+        {
+            m_version++;
+            m_matrix( row, col ) = value;
+        }
+
+        /**
+         * Apply an arbitrary edit to the wrapped matrix.  Counts as one mutation.
+         */
+        template <typename FuncT>
+        void modify( FuncT&& func )
+        {
+            m_version++;
+            func( m_matrix );
+        }
+
+        /**
+         * Number of rows
+         */
+        size_t rows() const
+        {
+            return m_matrix.rows();
+        }
+
+        /**
+         * Number of columns
+         */
+        size_t cols() const
+        {
+            return m_matrix.cols();
+        }
+
+        /**
+         * Mutation counter.  Changes whenever the cached results are invalidated.
+         */
+        uint64_t version() const
+        {
+            return m_version;
+        }
+
+        /**
+         * LU decomposition with partial pivoting
+         *
+         * Throws std::runtime_error if the matrix is not square.
+         */
+        const LU_Decomposition<value_type>& lu() const
+        {
+            return cached( m_lu, [this]( LU_Decomposition<value_type>& lu )
+            {
+                auto res = lu.compute( MatrixN<value_type>( m_matrix ) );
+                if( res.has_error() )
+                {
+                    throw std::runtime_error( "Cached_Matrix::lu() failed: " + res.error().message() );
+                }
+            });
+        }
+
+        /**
+         * Cholesky decomposition.  Check is_positive_definite() on the result.
+         *
+         * Throws std::runtime_error if the matrix is not square.
+         */
+        const Cholesky_Decomposition<value_type>& cholesky() const
+        {
+            return cached( m_cholesky, [this]( Cholesky_Decomposition<value_type>& llt )
+            {
+                auto res = llt.compute( MatrixN<value_type>( m_matrix ) );
+                if( res.has_error() )
+                {
+                    throw std::runtime_error( "Cached_Matrix::cholesky() failed: " + res.error().message() );
+                }
+            });
+        }
+
+        /**
+         * Complete singular value decomposition
+         *
+         * Throws std::runtime_error if the decomposition fails.
+         */
+        const SVD_Result<value_type>& svd() const
+        {
+            return cached( m_svd, [this]( SVD_Result<value_type>& svd )
+            {
+                auto res = compute_svd( m_matrix );
+                if( res.has_error() )
+                {
+                    throw std::runtime_error( "Cached_Matrix::svd() failed: " + res.error().message() );
+                }
+                svd = std::move( res.value() );
+            });
+        }
+
+        /**
+         * Determinant, computed from the cached LU factors
+         *
+         * Throws std::runtime_error if the matrix is not square.
+         */
+        value_type determinant() const
+        {
+            const auto& factors = lu();
+            return cached( m_determinant, [&factors]( value_type& det )
+            {
+                det = factors.determinant();
+            });
+        }
+
+        /**
+         * Inverse, computed from the cached LU factors
+         *
+         * Throws std::runtime_error if the matrix is singular or not square, matching
+         * Matrix::inverse().
+         */
+        const inverse_type& inverse() const
+        {
+            const auto& factors = lu();
+            return cached( m_inverse, [&factors]( inverse_type& inv )
+            {
+                auto res = factors.inverse();
+                if( res.has_error() )
+                {
+                    throw std::runtime_error( "Matrix is singular in inverse()" );
+                }
+                inv = inverse_type( res.value() );
+            });
+        }
+
+    private:
+
+        /// @brief Stamp of an entry which has never been computed
+        static constexpr uint64_t INVALID_VERSION = std::numeric_limits<uint64_t>::max();
+
+        /**
+         * One memoized result and the matrix version it was computed from
+         */
+        template <typename ValueT>
+        struct Cache_Entry
+        {
+            ValueT   value {};
+            uint64_t stamp { INVALID_VERSION };
+        }; // End of Cache_Entry struct
+
+        /**
+         * Return the entry, recomputing it first if it is older than the matrix.
+         *
+         * The fast path only takes a shared lock.  A stale entry is rechecked under the
+         * exclusive lock so concurrent readers compute it once.  The mutex is not recursive,
+         * so queries built on another entry fetch it before calling this.
+         */
+        template <typename ValueT,
+                  typename FuncT>
+        const ValueT& cached( Cache_Entry<ValueT>& entry,
+                              FuncT&&              compute ) const
+        {
+            {
+                std::shared_lock<std::shared_mutex> lock( m_mutex );
+                if( entry.stamp == m_version )
+                {
+                    return entry.value;
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock( m_mutex );
+            if( entry.stamp != m_version )
+            {
+                compute( entry.value );
+                entry.stamp = m_version;
+            }
+            return entry.value;
+        }
+
+        /// @brief Wrapped matrix
+        MatrixT m_matrix;
+
+        /// @brief Mutation counter
+        uint64_t m_version { 0 };
+
+        /// @brief Guards the cache entries
+        mutable std::shared_mutex m_mutex;
+
+        /// @brief Memoized LU factors
+        mutable Cache_Entry<LU_Decomposition<value_type>> m_lu;
+
+        /// @brief Memoized Cholesky factor
+        mutable Cache_Entry<Cholesky_Decomposition<value_type>> m_cholesky;
+
+        /// @brief Memoized SVD
+        mutable Cache_Entry<SVD_Result<value_type>> m_svd;
+
+        /// @brief Memoized determinant
+        mutable Cache_Entry<value_type> m_determinant;
+
+        /// @brief Memoized inverse
+        mutable Cache_Entry<inverse_type> m_inverse;
+
+}; // End of Cached_Matrix class
+
+} // End of tmns::math::linalg namespace
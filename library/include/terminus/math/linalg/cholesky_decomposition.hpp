@@ -0,0 +1,312 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    cholesky_decomposition.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/condition_estimate.hpp>
+#include <terminus/math/linalg/triangular_solve.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * Cholesky decomposition A = L L^T of a symmetric positive-definite matrix.
+ *
+ * Only the lower triangle of A is read.  A matrix which is not positive definite still
+ * returns ok from compute(); is_positive_definite() reports it and the solves fail, so a
+ * caller can fall back to LU_Decomposition without treating it as an error.
+ */
+template <typename ValueT>
+class Cholesky_Decomposition
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor.  Call compute() before use.
+         */
+        Cholesky_Decomposition() = default;
+
+        /**
+         * Factor A on construction.  Check is_positive_definite() for failure.
+         */
+        explicit Cholesky_Decomposition( const MatrixN<ValueT>& A )
+        {
+            (void)compute( A );
+        }
+
+        /**
+         * Factor a symmetric matrix
+         */
+        Result<void> compute( const MatrixN<ValueT>& A )
+        {
+            m_computed          = false;
+            m_positive_definite = false;
+            if( A.rows() != A.cols() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Cholesky_Decomposition requires a square matrix.  Actual: "
+                                      + std::to_string( A.rows() ) + " x " + std::to_string( A.cols() ) );
+            }
+
+            const size_t n = A.rows();
+            m_norm_1 = detail::symmetric_norm_1( A.data(), n );
+            m_L.set_size( n, n );
+            ValueT* l = m_L.data();
+            for( size_t i = 0; i < n; i++ )
+            {
+                ValueT* row_i = l + i * n;
+                for( size_t j = 0; j <= i; j++ )
+                {
+                    // Dot product of two contiguous row prefixes of L
+                    const ValueT* row_j = l + j * n;
+                    ValueT s = A( i, j );
+                    for( size_t k = 0; k < j; k++ )
+                    {
+                        s -= row_i[k] * row_j[k];
+                    }
+                    if( i == j )
+                    {
+                        if( !( s > ValueT( 0 ) ) )
+                        {
+                            m_computed = true;
+                            return outcome::ok();
+                        }
+                        row_i[i] = std::sqrt( s );
+                    }
+                    else
+                    {
+                        row_i[j] = s / row_j[j];
+                    }
+                }
+                for( size_t j = i + 1; j < n; j++ )
+                {
+                    row_i[j] = ValueT( 0 );
+                }
+            }
+
+            m_computed          = true;
+            m_positive_definite = true;
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A x = b into an existing vector
+         */
+        Result<void> solve( const VectorN<ValueT>& b,
+                            VectorN<ValueT>&       x ) const
+        {
+            auto res = check_solvable( b.size() );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            const size_t n = size();
+            x = b;
+            trsv( Triangle::LOWER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT, n, m_L.data(), n, x.data().data() );
+            trsv( Triangle::LOWER, Transpose::TRANSPOSE,    Diagonal::NON_UNIT, n, m_L.data(), n, x.data().data() );
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A x = b, returning a new vector
+         */
+        Result<VectorN<ValueT>> solve( const VectorN<ValueT>& b ) const
+        {
+            VectorN<ValueT> x( size() );
+            auto res = solve( b, x );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<VectorN<ValueT>>( std::move( x ) );
+        }
+
+        /**
+         * Solve A X = B for every column of B into an existing matrix
+         */
+        Result<void> solve( const MatrixN<ValueT>& B,
+                            MatrixN<ValueT>&       X ) const
+        {
+            auto res = check_solvable( B.rows() );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            const size_t n = size();
+            X = B;
+            trsm( Triangle::LOWER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT, n, B.cols(), m_L.data(), n, X.data(), B.cols() );
+            trsm( Triangle::LOWER, Transpose::TRANSPOSE,    Diagonal::NON_UNIT, n, B.cols(), m_L.data(), n, X.data(), B.cols() );
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A x = b and estimate the condition number of A in the same call
+         */
+        Result<Condition_Info<ValueT>> solve_with_condition( const VectorN<ValueT>& b,
+                                                             VectorN<ValueT>&       x ) const
+        {
+            auto res = solve( b, x );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<Condition_Info<ValueT>>( condition() );
+        }
+
+        /**
+         * Estimate the 1-norm condition number of A from L in O(n^2).  A is symmetric, so
+         * the transposed solve is the same as the plain one.
+         */
+        Condition_Info<ValueT> condition() const
+        {
+            Condition_Info<ValueT> info;
+            info.norm_1 = m_norm_1;
+            if( !m_positive_definite )
+            {
+                return info;
+            }
+
+            const size_t n = size();
+            auto apply_inverse = [&]( std::vector<ValueT>& x )
+            {
+                trsv( Triangle::LOWER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT, n, m_L.data(), n, x.data() );
+                trsv( Triangle::LOWER, Transpose::TRANSPOSE,    Diagonal::NON_UNIT, n, m_L.data(), n, x.data() );
+            };
+            info.inverse_norm_1 = estimate_inverse_norm_1<ValueT>( n, apply_inverse, apply_inverse );
+            info.rcond = detail::reciprocal_condition( info.norm_1, info.inverse_norm_1 );
+            return info;
+        }
+
+        /**
+         * Inverse of A, computed as the solution of A X = I
+         */
+        Result<MatrixN<ValueT>> inverse() const
+        {
+            const size_t n = size();
+            MatrixN<ValueT> I( n, n );
+            for( size_t i = 0; i < n; i++ )
+            {
+                I( i, i ) = ValueT( 1 );
+            }
+            MatrixN<ValueT> X;
+            auto res = solve( I, X );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<MatrixN<ValueT>>( std::move( X ) );
+        }
+
+        /**
+         * Determinant of A, the squared product of the diagonal of L
+         */
+        ValueT determinant() const
+        {
+            if( !m_positive_definite )
+            {
+                return ValueT( 0 );
+            }
+            ValueT det = ValueT( 1 );
+            for( size_t i = 0; i < size(); i++ )
+            {
+                det *= m_L( i, i ) * m_L( i, i );
+            }
+            return det;
+        }
+
+        /**
+         * Lower triangular factor L.  The strict upper triangle is zero.
+         */
+        const MatrixN<ValueT>& matrix_l() const
+        {
+            return m_L;
+        }
+
+        /**
+         * Dimension of the factored matrix
+         */
+        size_t size() const
+        {
+            return m_L.rows();
+        }
+
+        /**
+         * Check if compute() has been run
+         */
+        bool is_computed() const
+        {
+            return m_computed;
+        }
+
+        /**
+         * Check if the factorization completed with a positive pivot at every step
+         */
+        bool is_positive_definite() const
+        {
+            return m_positive_definite;
+        }
+
+    private:
+
+        /**
+         * Common checks before any solve
+         */
+        Result<void> check_solvable( size_t rhs_rows ) const
+        {
+            if( !m_computed )
+            {
+                return outcome::fail( error::Error_Code::UNINITIALIZED,
+                                      "Cholesky_Decomposition::solve() called before compute()" );
+            }
+            if( !m_positive_definite )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Cholesky_Decomposition: matrix is not positive definite" );
+            }
+            if( rhs_rows != size() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Right-hand side has " + std::to_string( rhs_rows )
+                                      + " rows, expected " + std::to_string( size() ) );
+            }
+            return outcome::ok();
+        }
+
+        /// @brief Lower triangular factor
+        MatrixN<ValueT> m_L;
+
+        /// @brief 1-norm of the factored matrix
+        ValueT m_norm_1 { 0 };
+
+        /// @brief Set when compute() has been run on a square matrix
+        bool m_computed { false };
+
+        /// @brief Set when every pivot was positive
+        bool m_positive_definite { false };
+
+}; // End of Cholesky_Decomposition class
+
+} // End of tmns::math::linalg namespace
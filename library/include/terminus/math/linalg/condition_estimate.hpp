@@ -0,0 +1,214 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    condition_estimate.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * 1-norm condition estimate reported by the factorizations
+ */
+template <typename ValueT>
+struct Condition_Info
+{
+    /// @brief ||A||_1, computed exactly
+    ValueT norm_1 { 0 };
+
+    /// @brief Estimate of ||A^-1||_1.  A lower bound, almost always within a factor of 3.
+    ValueT inverse_norm_1 { std::numeric_limits<ValueT>::infinity() };
+
+    /// @brief Reciprocal condition number 1 / ( ||A||_1 ||A^-1||_1 ).  Zero when singular.
+    ValueT rcond { 0 };
+
+    /**
+     * Estimated 1-norm condition number
+     */
+    ValueT condition() const
+    {
+        return rcond > ValueT( 0 ) ? ValueT( 1 ) / rcond : std::numeric_limits<ValueT>::infinity();
+    }
+
+    /**
+     * Check if about -log10(rcond) digits would be lost beyond the given tolerance.
+     *
+     * The default flags matrices whose solutions have fewer than about half the digits of ValueT.
+     */
+    bool is_ill_conditioned( ValueT tolerance = std::sqrt( std::numeric_limits<ValueT>::epsilon() ) ) const
+    {
+        return !( rcond > tolerance );
+    }
+
+}; // End of Condition_Info struct
+
+namespace detail {
+
+/**
+ * 1-norm of an n x n row-major matrix, the maximum absolute column sum
+ */
+template <typename ValueT>
+ValueT matrix_norm_1( const ValueT* a,
+                      size_t        n )
+{
+    std::vector<ValueT> sums( n, ValueT( 0 ) );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            sums[c] += std::abs( a[r * n + c] );
+        }
+    }
+    return sums.empty() ? ValueT( 0 ) : *std::max_element( sums.begin(), sums.end() );
+}
+
+/**
+ * 1-norm of the symmetric n x n row-major matrix whose lower triangle is stored in a.  The
+ * upper triangle is never read.
+ */
+template <typename ValueT>
+ValueT symmetric_norm_1( const ValueT* a,
+                         size_t        n )
+{
+    std::vector<ValueT> sums( n, ValueT( 0 ) );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < r; c++ )
+        {
+            const ValueT v = std::abs( a[r * n + c] );
+            sums[r] += v;
+            sums[c] += v;
+        }
+        sums[r] += std::abs( a[r * n + r] );
+    }
+    return sums.empty() ? ValueT( 0 ) : *std::max_element( sums.begin(), sums.end() );
+}
+
+/**
+ * 1 / ( ||A|| ||A^-1|| ), zero for a singular or non-finite estimate
+ */
+template <typename ValueT>
+ValueT reciprocal_condition( ValueT norm,
+                             ValueT inverse_norm )
+{
+    if( !( norm > ValueT( 0 ) ) || !( inverse_norm > ValueT( 0 ) ) || !std::isfinite( inverse_norm ) )
+    {
+        return ValueT( 0 );
+    }
+    return ( ValueT( 1 ) / norm ) / inverse_norm;
+}
+
+} // End of detail namespace
+
+/**
+ * Estimate ||A^-1||_1 from solves with A and A^T (Hager's method with Higham's refinements).
+ *
+ * Needs at most five pairs of O(n^2) triangular solves on an existing factorization, plus
+ * one extra solve with Higham's alternating-sign vector to guard against the rare cases
+ * where the gradient ascent stops early.
+ *
+ * @param n                Dimension of A
+ * @param solve            Callable overwriting a std::vector<ValueT> x with A^-1 x
+ * @param solve_transpose  Callable overwriting a std::vector<ValueT> x with A^-T x
+ */
+template <typename ValueT,
+          typename SolveFuncT,
+          typename SolveTransposeFuncT>
+ValueT estimate_inverse_norm_1( size_t                n,
+                                SolveFuncT&&          solve,
+                                SolveTransposeFuncT&& solve_transpose )
+{
+    if( n == 0 )
+    {
+        return ValueT( 0 );
+    }
+
+    auto norm_1 = []( const std::vector<ValueT>& v )
+    {
+        ValueT s = 0;
+        for( const auto& value : v )
+        {
+            s += std::abs( value );
+        }
+        return s;
+    };
+
+    std::vector<ValueT> x( n, ValueT( 1 ) / ValueT( n ) );
+    std::vector<ValueT> x_in( n ), xi( n ), xi_old( n );
+    ValueT estimate = 0;
+
+    for( size_t iter = 0; iter < 5; iter++ )
+    {
+        x_in = x;
+        solve( x );
+        const ValueT new_estimate = norm_1( x );
+        if( !std::isfinite( new_estimate ) )
+        {
+            return std::numeric_limits<ValueT>::infinity();
+        }
+
+        for( size_t i = 0; i < n; i++ )
+        {
+            xi[i] = ( x[i] >= ValueT( 0 ) ) ? ValueT( 1 ) : ValueT( -1 );
+        }
+        if( iter > 0 && ( xi == xi_old || new_estimate <= estimate ) )
+        {
+            estimate = std::max( estimate, new_estimate );
+            break;
+        }
+        estimate = new_estimate;
+        xi_old   = xi;
+
+        // Gradient:  z = A^-T xi.  Stop when no unit vector improves on the current x.
+        std::vector<ValueT> z = xi;
+        solve_transpose( z );
+        size_t j = 0;
+        for( size_t i = 1; i < n; i++ )
+        {
+            if( std::abs( z[i] ) > std::abs( z[j] ) )
+            {
+                j = i;
+            }
+        }
+        ValueT z_dot_x = 0;
+        for( size_t i = 0; i < n; i++ )
+        {
+            z_dot_x += z[i] * x_in[i];
+        }
+        if( iter > 0 && std::abs( z[j] ) <= z_dot_x )
+        {
+            break;
+        }
+        std::fill( x.begin(), x.end(), ValueT( 0 ) );
+        x[j] = ValueT( 1 );
+    }
+
+    // Higham's alternating-sign test vector
+    std::vector<ValueT> alt( n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        const ValueT mag = ValueT( 1 ) + ( n > 1 ? ValueT( i ) / ValueT( n - 1 ) : ValueT( 0 ) );
+        alt[i] = ( i % 2 == 0 ) ? mag : -mag;
+    }
+    solve( alt );
+    const ValueT alt_estimate = ValueT( 2 ) * norm_1( alt ) / ValueT( 3 * n );
+    return std::max( estimate, alt_estimate );
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,210 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    fixed_size_solvers.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/matrix.hpp>
+#include <terminus/math/vector/vector.hpp>
+
+// C++ Libraries
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace tmns::math::linalg {
+
+/**
+ * Per-problem outcome of the small dense solvers.  These are plain status codes rather than
+ * Result<> objects since they are produced in bulk by the batched solvers.
+ */
+enum class Solve_Status : int8_t
+{
+    SUCCESS               = 0,
+    NOT_POSITIVE_DEFINITE = 1,
+    SINGULAR              = 2,
+}; // End of Solve_Status enum
+
+namespace detail {
+
+/**
+ * In-place Cholesky (LL^T) solve of a row-major N x N system.  On return, b holds x.
+ *
+ * Every loop bound is a compile-time constant so the compiler fully unrolls small systems.
+ * Only the lower triangle of a is read.
+ */
+template <typename ValueT,
+          size_t   N>
+Solve_Status cholesky_solve_inplace( std::array<ValueT,N*N>& a,
+                                     std::array<ValueT,N>&   b )
+{
+    std::array<ValueT,N> inv_diag;
+    for( size_t j = 0; j < N; j++ )
+    {
+        ValueT d = a[j*N+j];
+        for( size_t k = 0; k < j; k++ )
+        {
+            d -= a[j*N+k] * a[j*N+k];
+        }
+        if( !( d > ValueT( 0 ) ) )
+        {
+            return Solve_Status::NOT_POSITIVE_DEFINITE;
+        }
+        const ValueT ljj = std::sqrt( d );
+        inv_diag[j] = ValueT( 1 ) / ljj;
+        a[j*N+j]    = ljj;
+
+        for( size_t i = j + 1; i < N; i++ )
+        {
+            ValueT s = a[i*N+j];
+            for( size_t k = 0; k < j; k++ )
+            {
+                s -= a[i*N+k] * a[j*N+k];
+            }
+            a[i*N+j] = s * inv_diag[j];
+        }
+    }
+
+    // Forward substitution:  L y = b
+    for( size_t i = 0; i < N; i++ )
+    {
+        ValueT s = b[i];
+        for( size_t k = 0; k < i; k++ )
+        {
+            s -= a[i*N+k] * b[k];
+        }
+        b[i] = s * inv_diag[i];
+    }
+
+    // Back substitution:  L^T x = y
+    for( size_t ii = N; ii-- > 0; )
+    {
+        ValueT s = b[ii];
+        for( size_t k = ii + 1; k < N; k++ )
+        {
+            s -= a[k*N+ii] * b[k];
+        }
+        b[ii] = s * inv_diag[ii];
+    }
+    return Solve_Status::SUCCESS;
+}
+
+/**
+ * In-place LU solve with partial pivoting of a row-major N x N system.  On return, b holds x.
+ */
+template <typename ValueT,
+          size_t   N>
+Solve_Status lu_solve_inplace( std::array<ValueT,N*N>& a,
+                               std::array<ValueT,N>&   b )
+{
+    for( size_t k = 0; k < N; k++ )
+    {
+        // Find the pivot
+        size_t p = k;
+        ValueT max_val = std::fabs( a[k*N+k] );
+        for( size_t i = k + 1; i < N; i++ )
+        {
+            const ValueT v = std::fabs( a[i*N+k] );
+            if( v > max_val )
+            {
+                max_val = v;
+                p       = i;
+            }
+        }
+        if( max_val == ValueT( 0 ) )
+        {
+            return Solve_Status::SINGULAR;
+        }
+        if( p != k )
+        {
+            for( size_t j = 0; j < N; j++ )
+            {
+                std::swap( a[k*N+j], a[p*N+j] );
+            }
+            std::swap( b[k], b[p] );
+        }
+
+        // Eliminate below the pivot, carrying the right-hand side along
+        const ValueT inv_pivot = ValueT( 1 ) / a[k*N+k];
+        for( size_t i = k + 1; i < N; i++ )
+        {
+            const ValueT f = a[i*N+k] * inv_pivot;
+            for( size_t j = k + 1; j < N; j++ )
+            {
+                a[i*N+j] -= f * a[k*N+j];
+            }
+            b[i] -= f * b[k];
+        }
+    }
+
+    // Back substitution:  U x = y
+    for( size_t ii = N; ii-- > 0; )
+    {
+        ValueT s = b[ii];
+        for( size_t j = ii + 1; j < N; j++ )
+        {
+            s -= a[ii*N+j] * b[j];
+        }
+        b[ii] = s / a[ii*N+ii];
+    }
+    return Solve_Status::SUCCESS;
+}
+
+} // End of detail namespace
+
+/**
+ * Solve Ax=b for a fixed-size symmetric positive-definite A using an unrolled Cholesky.
+ * Runs entirely on the stack.  x is left untouched if A is not positive definite.
+ */
+template <typename ValueT,
+          size_t   N>
+Solve_Status cholesky_solve( const Matrix<ValueT,N,N>& A,
+                             const Vector_<ValueT,N>&  b,
+                             Vector_<ValueT,N>&        x )
+{
+    std::array<ValueT,N*N> a;
+    std::array<ValueT,N>   y = b.data();
+    std::copy( A.begin(), A.end(), a.begin() );
+
+    auto status = detail::cholesky_solve_inplace<ValueT,N>( a, y );
+    if( status == Solve_Status::SUCCESS )
+    {
+        x.data() = y;
+    }
+    return status;
+}
+
+/**
+ * Solve Ax=b for a fixed-size general A using an unrolled LU with partial pivoting.
+ * Runs entirely on the stack.  x is left untouched if A is singular.
+ */
+template <typename ValueT,
+          size_t   N>
+Solve_Status lu_solve( const Matrix<ValueT,N,N>& A,
+                       const Vector_<ValueT,N>&  b,
+                       Vector_<ValueT,N>&        x )
+{
+    std::array<ValueT,N*N> a;
+    std::array<ValueT,N>   y = b.data();
+    std::copy( A.begin(), A.end(), a.begin() );
+
+    auto status = detail::lu_solve_inplace<ValueT,N>( a, y );
+    if( status == Solve_Status::SUCCESS )
+    {
+        x.data() = y;
+    }
+    return status;
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,521 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    incremental_svd.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/workspace_solvers.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <string>
+
+namespace tmns::math::linalg {
+
+/**
+ * Controls for Incremental_SVD
+ */
+struct Incremental_SVD_Options
+{
+    /// @brief Maximum number of singular triplets kept.  Zero lets the rank grow with the data.
+    size_t max_rank { 0 };
+
+    /// @brief Singular values at or below rank_tolerance * S[0] are dropped after each update
+    double rank_tolerance { 1e-10 };
+
+    /// @brief Re-orthonormalize U and V after this many columns.  Zero disables it.
+    size_t reorthogonalize_interval { 100 };
+
+    /// @brief Track the right singular vectors.  Without V, memory is O(m k) no matter how many columns arrive.
+    bool compute_v { true };
+}; // End of Incremental_SVD_Options struct
+
+namespace detail {
+
+/**
+ * Thin QR of the first k columns of a row-major matrix with twice-applied modified
+ * Gram-Schmidt.  A is overwritten with Q and R (k x k, upper triangular) is returned.
+ */
+template <typename ValueT>
+void thin_qr_columns( MatrixN<ValueT>& A,
+                      size_t           k,
+                      MatrixN<ValueT>& R )
+{
+    const size_t m = A.rows();
+    R.set_size( k, k );
+    std::fill( R.data(), R.data() + k * k, ValueT( 0 ) );
+
+    for( size_t c = 0; c < k; c++ )
+    {
+        for( int pass = 0; pass < 2; pass++ )
+        {
+            for( size_t p = 0; p < c; p++ )
+            {
+                ValueT d = 0;
+                for( size_t i = 0; i < m; i++ )
+                {
+                    d += A( i, p ) * A( i, c );
+                }
+                for( size_t i = 0; i < m; i++ )
+                {
+                    A( i, c ) -= d * A( i, p );
+                }
+                R( p, c ) += d;
+            }
+        }
+        ValueT norm = 0;
+        for( size_t i = 0; i < m; i++ )
+        {
+            norm += A( i, c ) * A( i, c );
+        }
+        norm = std::sqrt( norm );
+        R( c, c ) = norm;
+        const ValueT scale = norm > 0 ? ValueT( 1 ) / norm : ValueT( 0 );
+        for( size_t i = 0; i < m; i++ )
+        {
+            A( i, c ) *= scale;
+        }
+    }
+}
+
+/**
+ * dst( :, 0:cols ) = [ src, extra ] * rot( :, 0:cols ), row by row.  src has k columns and
+ * extra supplies the (k+1)-th column for each row, so the block matrix is never formed.
+ * Rows past the end of src are treated as zero.
+ */
+template <typename ValueT,
+          typename ExtraT>
+void rotate_rows( const MatrixN<ValueT>& src,
+                  size_t                 k,
+                  ExtraT&&               extra,
+                  const MatrixN<ValueT>& rot,
+                  size_t                 cols,
+                  MatrixN<ValueT>&       dst,
+                  size_t                 rows )
+{
+    if( dst.rows() != rows || dst.cols() != cols )
+    {
+        dst.set_size( rows, cols );
+    }
+    for( size_t i = 0; i < rows; i++ )
+    {
+        const ValueT e     = extra( i );
+        const size_t src_k = ( i < src.rows() ) ? k : 0;
+        for( size_t c = 0; c < cols; c++ )
+        {
+            ValueT s = e * rot( k, c );
+            for( size_t p = 0; p < src_k; p++ )
+            {
+                s += src( i, p ) * rot( p, c );
+            }
+            dst( i, c ) = s;
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Truncated SVD X ~ U diag(S) V^T of a matrix whose columns arrive one at a time
+ * (Brand, "Fast low-rank modifications of the thin singular value decomposition", 2006).
+ *
+ * Each new column c is split into its projection p = U^T c and the orthogonal remainder
+ * r = c - U p.  The SVD of the small (k+1) x (k+1) core
+ *
+ *      K = [ diag(S)  p     ]
+ *          [ 0        ||r|| ]
+ *
+ * rotates the enlarged bases [U r/||r||] and [V 0; 0 1].  An update costs
+ * O( (m + t) k^2 ) instead of recomputing the SVD of the whole m x t matrix.
+ *
+ * Rounding slowly erodes the orthogonality of U and V, so they are periodically
+ * re-orthonormalized.  With max_rank set the decomposition is truncated after every update,
+ * and with compute_v disabled nothing grows with the number of columns.
+ *
+ * Only float and double are supported.
+ */
+template <typename ValueT>
+class Incremental_SVD
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Constructor
+         *
+         * @param rows Length m of each incoming column
+         * @param options Rank, tolerance and reorthogonalization settings
+         */
+        explicit Incremental_SVD( size_t                         rows,
+                                  const Incremental_SVD_Options& options = Incremental_SVD_Options() )
+          : m_options( options ),
+            m_rows( rows ),
+            m_U( rows, 0 ),
+            m_residual( rows )
+        {
+        }
+
+        /**
+         * Discard all columns
+         */
+        void reset()
+        {
+            m_U.set_size( m_rows, 0 );
+            m_V.set_size( 0, 0 );
+            m_S.data().clear();
+            m_rank    = 0;
+            m_columns = 0;
+        }
+
+        /**
+         * Append one column to the decomposed matrix
+         */
+        Result<void> add_column( std::span<const ValueT> column )
+        {
+            if( column.size() != m_rows )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Column has " + std::to_string( column.size() )
+                                      + " entries, expected " + std::to_string( m_rows ) );
+            }
+            const size_t k = m_rank;
+
+            // p = U^T c and r = c - U p, with a second pass to keep r orthogonal to U
+            m_proj.data().assign( k, ValueT( 0 ) );
+            std::copy( column.begin(), column.end(), m_residual.begin() );
+            for( int pass = 0; pass < 2; pass++ )
+            {
+                for( size_t p = 0; p < k; p++ )
+                {
+                    ValueT d = 0;
+                    for( size_t i = 0; i < m_rows; i++ )
+                    {
+                        d += m_U( i, p ) * m_residual[i];
+                    }
+                    for( size_t i = 0; i < m_rows; i++ )
+                    {
+                        m_residual[i] -= d * m_U( i, p );
+                    }
+                    m_proj[p] += d;
+                }
+            }
+            ValueT rho = 0;
+            for( size_t i = 0; i < m_rows; i++ )
+            {
+                rho += m_residual[i] * m_residual[i];
+            }
+            rho = std::sqrt( rho );
+
+            // Treat a remainder at the rank tolerance as lying inside the current subspace
+            const ValueT scale = ( k > 0 ) ? m_S[0] : rho;
+            if( rho <= ValueT( m_options.rank_tolerance ) * scale )
+            {
+                rho = 0;
+            }
+            const ValueT inv_rho = rho > 0 ? ValueT( 1 ) / rho : ValueT( 0 );
+
+            // Core matrix K and its SVD
+            m_core.set_size( k + 1, k + 1 );
+            std::fill( m_core.data(), m_core.data() + ( k + 1 ) * ( k + 1 ), ValueT( 0 ) );
+            for( size_t p = 0; p < k; p++ )
+            {
+                m_core( p, p ) = m_S[p];
+                m_core( p, k ) = m_proj[p];
+            }
+            m_core( k, k ) = rho;
+
+            auto res = m_core_svd.factor( m_core );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            m_core_svd.singular_values( m_core_s );
+            m_core_svd.matrix_u( m_core_u );
+
+            const size_t new_rank = truncated_rank( m_core_s );
+
+            // U <- [ U, r / ||r|| ] * U_K
+            detail::rotate_rows( m_U, k, [&]( size_t i ){ return m_residual[i] * inv_rho; },
+                                 m_core_u, new_rank, m_U_next, m_rows );
+            copy_into( m_U_next, m_U );
+
+            // V <- [ V 0; 0 1 ] * V_K
+            if( m_options.compute_v )
+            {
+                m_core_svd.matrix_v( m_core_v );
+                const size_t t = m_columns;
+                detail::rotate_rows( m_V, k, [&]( size_t i ){ return i == t ? ValueT( 1 ) : ValueT( 0 ); },
+                                     m_core_v, new_rank, m_V_next, t + 1 );
+                copy_into( m_V_next, m_V );
+            }
+
+            m_S.data().assign( m_core_s.begin(), m_core_s.begin() + new_rank );
+            m_rank = new_rank;
+            m_columns++;
+
+            if( m_options.reorthogonalize_interval > 0 &&
+                m_columns % m_options.reorthogonalize_interval == 0 )
+            {
+                return reorthogonalize();
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Append one column to the decomposed matrix
+         */
+        Result<void> add_column( const VectorN<ValueT>& column )
+        {
+            return add_column( std::span<const ValueT>( column.data() ) );
+        }
+
+        /**
+         * Append every column of C, left to right
+         */
+        Result<void> add_columns( const MatrixN<ValueT>& C )
+        {
+            if( C.rows() != m_rows )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Column block has " + std::to_string( C.rows() )
+                                      + " rows, expected " + std::to_string( m_rows ) );
+            }
+            VectorN<ValueT> column( m_rows );
+            for( size_t c = 0; c < C.cols(); c++ )
+            {
+                for( size_t r = 0; r < m_rows; r++ )
+                {
+                    column[r] = C( r, c );
+                }
+                auto res = add_column( column );
+                if( res.has_error() )
+                {
+                    return res.error();
+                }
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Restore exact orthonormality of U (and V).  With U = Q1 R1 and V = Q2 R2, the core
+         * R1 diag(S) R2^T is re-decomposed and its factors folded back into Q1 and Q2.
+         */
+        Result<void> reorthogonalize()
+        {
+            const size_t k = m_rank;
+            if( k == 0 )
+            {
+                return outcome::ok();
+            }
+
+            detail::thin_qr_columns( m_U, k, m_R_u );
+            if( m_options.compute_v )
+            {
+                detail::thin_qr_columns( m_V, k, m_R_v );
+            }
+
+            // Core = R1 diag(S) R2^T
+            m_core.set_size( k, k );
+            for( size_t r = 0; r < k; r++ )
+            {
+                for( size_t c = 0; c < k; c++ )
+                {
+                    ValueT s = 0;
+                    if( m_options.compute_v )
+                    {
+                        for( size_t p = std::max( r, c ); p < k; p++ )
+                        {
+                            s += m_R_u( r, p ) * m_S[p] * m_R_v( c, p );
+                        }
+                    }
+                    else
+                    {
+                        s = ( c >= r ) ? m_R_u( r, c ) * m_S[c] : ValueT( 0 );
+                    }
+                    m_core( r, c ) = s;
+                }
+            }
+
+            auto res = m_core_svd.factor( m_core );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            m_core_svd.singular_values( m_core_s );
+
+            auto zero = []( size_t ){ return ValueT( 0 ); };
+            m_core_svd.matrix_u( m_core_next );
+            pad_rotation( m_core_next, m_core_u, k );
+            detail::rotate_rows( m_U, k, zero, m_core_u, k, m_U_next, m_rows );
+            copy_into( m_U_next, m_U );
+
+            if( m_options.compute_v )
+            {
+                m_core_svd.matrix_v( m_core_next );
+                pad_rotation( m_core_next, m_core_v, k );
+                detail::rotate_rows( m_V, k, zero, m_core_v, k, m_V_next, m_columns );
+                copy_into( m_V_next, m_V );
+            }
+
+            m_S.data().assign( m_core_s.begin(), m_core_s.end() );
+            return outcome::ok();
+        }
+
+        /**
+         * Left singular vectors (rows x rank)
+         */
+        const MatrixN<ValueT>& matrix_u() const
+        {
+            return m_U;
+        }
+
+        /**
+         * Singular values in descending order (rank)
+         */
+        const VectorN<ValueT>& singular_values() const
+        {
+            return m_S;
+        }
+
+        /**
+         * Right singular vectors (columns seen x rank).  Empty when compute_v is disabled.
+         */
+        const MatrixN<ValueT>& matrix_v() const
+        {
+            return m_V;
+        }
+
+        /**
+         * Number of singular triplets currently kept
+         */
+        size_t rank() const
+        {
+            return m_rank;
+        }
+
+        /**
+         * Length of each column
+         */
+        size_t rows() const
+        {
+            return m_rows;
+        }
+
+        /**
+         * Number of columns appended since construction or reset()
+         */
+        size_t columns_seen() const
+        {
+            return m_columns;
+        }
+
+        /**
+         * Get the configured options
+         */
+        const Incremental_SVD_Options& options() const
+        {
+            return m_options;
+        }
+
+    private:
+
+        /**
+         * Number of singular values worth keeping after an update
+         */
+        size_t truncated_rank( const VectorN<ValueT>& s ) const
+        {
+            size_t r = 0;
+            const ValueT thresh = s.size() > 0 ? ValueT( m_options.rank_tolerance ) * s[0] : ValueT( 0 );
+            while( r < s.size() && s[r] > thresh && s[r] > ValueT( 0 ) )
+            {
+                r++;
+            }
+            if( m_options.max_rank > 0 )
+            {
+                r = std::min( r, m_options.max_rank );
+            }
+            return r;
+        }
+
+        /**
+         * Copy src into dst, reusing dst's storage.  MatrixN has no move, so this is cheaper
+         * than swapping.
+         */
+        static void copy_into( const MatrixN<ValueT>& src,
+                               MatrixN<ValueT>&       dst )
+        {
+            if( dst.rows() != src.rows() || dst.cols() != src.cols() )
+            {
+                dst.set_size( src.rows(), src.cols() );
+            }
+            std::copy( src.data(), src.data() + src.rows() * src.cols(), dst.data() );
+        }
+
+        /**
+         * Copy a k x k rotation into a (k+1) x k one with a zero last row, the shape
+         * rotate_rows() expects
+         */
+        static void pad_rotation( const MatrixN<ValueT>& src,
+                                  MatrixN<ValueT>&       dst,
+                                  size_t                 k )
+        {
+            if( dst.rows() != k + 1 || dst.cols() != k )
+            {
+                dst.set_size( k + 1, k );
+            }
+            std::copy( src.data(), src.data() + k * k, dst.data() );
+            std::fill( dst.data() + k * k, dst.data() + ( k + 1 ) * k, ValueT( 0 ) );
+        }
+
+        /// @brief Configuration
+        Incremental_SVD_Options m_options;
+
+        /// @brief Column length
+        size_t m_rows;
+
+        /// @brief Current factors
+        MatrixN<ValueT> m_U;
+        VectorN<ValueT> m_S;
+        MatrixN<ValueT> m_V;
+
+        /// @brief Number of kept singular triplets
+        size_t m_rank { 0 };
+
+        /// @brief Columns appended so far
+        size_t m_columns { 0 };
+
+        /// @brief Per-update workspace, reused between columns
+        VectorN<ValueT>    m_proj;
+        VectorN<ValueT>    m_residual;
+        MatrixN<ValueT>    m_core;
+        MatrixN<ValueT>    m_core_u;
+        MatrixN<ValueT>    m_core_v;
+        MatrixN<ValueT>    m_core_next;
+        VectorN<ValueT>    m_core_s;
+        MatrixN<ValueT>    m_U_next;
+        MatrixN<ValueT>    m_V_next;
+        MatrixN<ValueT>    m_R_u;
+        MatrixN<ValueT>    m_R_v;
+        SVD_Solver<ValueT> m_core_svd;
+
+}; // End of Incremental_SVD class
+
+} // End of tmns::math::linalg namespace
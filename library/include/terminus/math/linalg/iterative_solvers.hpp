@@ -0,0 +1,801 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    iterative_solvers.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/linear_operator.hpp>
+#include <terminus/math/linalg/preconditioners.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace tmns::math::linalg {
+
+/**
+ * Stopping controls shared by the Krylov solvers.
+ *
+ * A solve converges once the residual norm drops below
+ * max( relative_tolerance * ||b||, absolute_tolerance ).  The least squares solvers also
+ * stop once ||A^T r|| <= relative_tolerance * ||A|| * ||r||, which is the test for an
+ * inconsistent system having reached its minimum.
+ */
+struct Iterative_Solver_Options
+{
+    /// @brief Iteration limit.  Zero selects twice the problem dimension.
+    size_t max_iterations { 0 };
+
+    /// @brief Tolerance relative to the norm of the right-hand side
+    double relative_tolerance { 1e-10 };
+
+    /// @brief Absolute residual tolerance
+    double absolute_tolerance { 0 };
+}; // End of Iterative_Solver_Options struct
+
+/**
+ * Summary of an iterative solve.  Running out of iterations is not an error; check
+ * converged.
+ */
+struct Iterative_Solver_Info
+{
+    /// @brief Number of iterations performed
+    size_t iterations { 0 };
+
+    /// @brief Final residual norm ||b - Ax|| (estimated by MINRES/LSQR/LSMR)
+    double residual_norm { 0 };
+
+    /// @brief Final normal-equation residual ||A^T (b - Ax)||, least squares solvers only
+    double normal_residual_norm { 0 };
+
+    /// @brief True if a tolerance was met
+    bool converged { false };
+}; // End of Iterative_Solver_Info struct
+
+namespace detail {
+
+/**
+ * Resolve the iteration limit for a problem of dimension n
+ */
+inline size_t resolve_max_iterations( const Iterative_Solver_Options& options,
+                                      size_t                          n )
+{
+    return options.max_iterations > 0 ? options.max_iterations : std::max<size_t>( 2 * n, 1 );
+}
+
+/**
+ * Check operator / vector dimensions and prepare the initial guess
+ */
+template <typename ValueT,
+          typename OperatorT>
+Result<void> check_dimensions( const OperatorT&       A,
+                               const VectorN<ValueT>& b,
+                               VectorN<ValueT>&       x,
+                               bool                   square )
+{
+    if( square && A.rows() != A.cols() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Operator must be square. Actual: " + std::to_string( A.rows() ) +
+                              " x " + std::to_string( A.cols() ) );
+    }
+    if( b.size() != A.rows() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Right-hand side size (" + std::to_string( b.size() ) +
+                              ") does not match operator rows (" + std::to_string( A.rows() ) + ")" );
+    }
+
+    // A mismatched x cannot be a meaningful initial guess, so start from zero
+    if( x.size() != A.cols() )
+    {
+        x.data().assign( A.cols(), ValueT( 0 ) );
+    }
+    return outcome::ok();
+}
+
+} // End of detail namespace
+
+/**
+ * Preconditioned conjugate gradient for symmetric positive-definite operators.
+ *
+ * The solver owns its work vectors, so repeated solves at the same dimension reuse them.
+ * x is used as the initial guess when its size matches the system.
+ */
+template <typename ValueT>
+class Conjugate_Gradient_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Constructor
+         */
+        explicit Conjugate_Gradient_Solver( const Iterative_Solver_Options& options = Iterative_Solver_Options() )
+            : m_options( options )
+        {
+        }
+
+        /**
+         * Get the stopping controls
+         */
+        const Iterative_Solver_Options& options() const
+        {
+            return m_options;
+        }
+
+        /**
+         * Set the stopping controls
+         */
+        void set_options( const Iterative_Solver_Options& options )
+        {
+            m_options = options;
+        }
+
+        /**
+         * Solve Ax=b.  Fails if A is not square or a direction of non-positive curvature is
+         * found, meaning A (or the preconditioner) is not positive definite.
+         */
+        template <Linear_Operator<ValueT> OperatorT,
+                  Preconditioner<ValueT>  PreconditionerT = Identity_Preconditioner>
+        Result<Iterative_Solver_Info> solve( const OperatorT&       A,
+                                             const VectorN<ValueT>& b,
+                                             VectorN<ValueT>&       x,
+                                             const PreconditionerT& M = PreconditionerT() )
+        {
+            auto res = detail::check_dimensions( A, b, x, true );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+
+            const size_t n = b.size();
+            detail::resize_workspace( m_r,  n );
+            detail::resize_workspace( m_z,  n );
+            detail::resize_workspace( m_p,  n );
+            detail::resize_workspace( m_Ap, n );
+
+            Iterative_Solver_Info info;
+            const double tol = std::max( m_options.relative_tolerance * double( detail::norm2( b ) ),
+                                         m_options.absolute_tolerance );
+
+            // r = b - A x
+            A.apply( x, m_Ap );
+            for( size_t i = 0; i < n; i++ )
+            {
+                m_r[i] = b[i] - m_Ap[i];
+            }
+            info.residual_norm = detail::norm2( m_r );
+            if( info.residual_norm <= tol )
+            {
+                info.converged = true;
+                return outcome::ok<Iterative_Solver_Info>( info );
+            }
+
+            M.apply( m_r, m_z );
+            std::copy( m_z.begin(), m_z.end(), m_p.begin() );
+            ValueT rz = detail::dot( m_r, m_z );
+
+            const size_t max_iterations = detail::resolve_max_iterations( m_options, n );
+            while( info.iterations < max_iterations )
+            {
+                A.apply( m_p, m_Ap );
+                const ValueT pAp = detail::dot( m_p, m_Ap );
+                if( !( pAp > ValueT( 0 ) ) )
+                {
+                    return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                          "Conjugate gradient found non-positive curvature at iteration " +
+                                          std::to_string( info.iterations ) + ". The operator is not SPD." );
+                }
+
+                const ValueT alpha = rz / pAp;
+                detail::axpy(  alpha, m_p,  x );
+                detail::axpy( -alpha, m_Ap, m_r );
+                info.iterations++;
+
+                info.residual_norm = detail::norm2( m_r );
+                if( info.residual_norm <= tol )
+                {
+                    info.converged = true;
+                    break;
+                }
+
+                M.apply( m_r, m_z );
+                const ValueT rz_new = detail::dot( m_r, m_z );
+                detail::xpby( m_z, rz_new / rz, m_p );
+                rz = rz_new;
+            }
+            return outcome::ok<Iterative_Solver_Info>( info );
+        }
+
+    private:
+
+        /// @brief Stopping controls
+        Iterative_Solver_Options m_options;
+
+        /// @brief Work vectors
+        VectorN<ValueT> m_r;
+        VectorN<ValueT> m_z;
+        VectorN<ValueT> m_p;
+        VectorN<ValueT> m_Ap;
+
+}; // End of Conjugate_Gradient_Solver class
+
+/**
+ * MINRES for symmetric, possibly indefinite, operators (Paige & Saunders).
+ *
+ * An optional symmetric positive-definite preconditioner may be supplied, in which case the
+ * residual is measured in the preconditioner norm.
+ */
+template <typename ValueT>
+class MINRES_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Constructor
+         */
+        explicit MINRES_Solver( const Iterative_Solver_Options& options = Iterative_Solver_Options() )
+            : m_options( options )
+        {
+        }
+
+        /**
+         * Get the stopping controls
+         */
+        const Iterative_Solver_Options& options() const
+        {
+            return m_options;
+        }
+
+        /**
+         * Set the stopping controls
+         */
+        void set_options( const Iterative_Solver_Options& options )
+        {
+            m_options = options;
+        }
+
+        /**
+         * Solve Ax=b.  Fails if A is not square or the preconditioner is indefinite.
+         */
+        template <Linear_Operator<ValueT> OperatorT,
+                  Preconditioner<ValueT>  PreconditionerT = Identity_Preconditioner>
+        Result<Iterative_Solver_Info> solve( const OperatorT&       A,
+                                             const VectorN<ValueT>& b,
+                                             VectorN<ValueT>&       x,
+                                             const PreconditionerT& M = PreconditionerT() )
+        {
+            auto res = detail::check_dimensions( A, b, x, true );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+
+            const size_t n = b.size();
+            detail::resize_workspace( m_r1, n );
+            detail::resize_workspace( m_r2, n );
+            detail::resize_workspace( m_y,  n );
+            detail::resize_workspace( m_v,  n );
+            detail::resize_workspace( m_w,  n );
+            detail::resize_workspace( m_w1, n );
+            detail::resize_workspace( m_w2, n );
+
+            Iterative_Solver_Info info;
+
+            // Tolerance in the preconditioner norm of b
+            M.apply( b, m_y );
+            const double b_norm = std::sqrt( std::max( double( detail::dot( b, m_y ) ), 0.0 ) );
+            const double tol    = std::max( m_options.relative_tolerance * b_norm,
+                                            m_options.absolute_tolerance );
+
+            // r1 = b - A x,  y = M r1
+            A.apply( x, m_y );
+            for( size_t i = 0; i < n; i++ )
+            {
+                m_r1[i] = b[i] - m_y[i];
+            }
+            M.apply( m_r1, m_y );
+            ValueT beta1 = detail::dot( m_r1, m_y );
+            if( beta1 < ValueT( 0 ) )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "MINRES preconditioner is not positive definite" );
+            }
+            beta1 = std::sqrt( beta1 );
+            info.residual_norm = beta1;
+            if( info.residual_norm <= tol )
+            {
+                info.converged = true;
+                return outcome::ok<Iterative_Solver_Info>( info );
+            }
+
+            std::copy( m_r1.begin(), m_r1.end(), m_r2.begin() );
+            std::fill( m_w.begin(),  m_w.end(),  ValueT( 0 ) );
+            std::fill( m_w2.begin(), m_w2.end(), ValueT( 0 ) );
+
+            ValueT oldb   = 0;
+            ValueT beta   = beta1;
+            ValueT dbar   = 0;
+            ValueT epsln  = 0;
+            ValueT phibar = beta1;
+            ValueT cs     = -1;
+            ValueT sn     = 0;
+
+            const size_t max_iterations = detail::resolve_max_iterations( m_options, n );
+            while( info.iterations < max_iterations )
+            {
+                // Lanczos step
+                const ValueT s = ValueT( 1 ) / beta;
+                for( size_t i = 0; i < n; i++ )
+                {
+                    m_v[i] = s * m_y[i];
+                }
+                A.apply( m_v, m_y );
+                if( info.iterations > 0 )
+                {
+                    detail::axpy( -beta / oldb, m_r1, m_y );
+                }
+                const ValueT alfa = detail::dot( m_v, m_y );
+                detail::axpy( -alfa / beta, m_r2, m_y );
+
+                // r1 <- r2, r2 <- y, y <- M r2
+                m_r1.data().swap( m_r2.data() );
+                m_r2.data().swap( m_y.data() );
+                M.apply( m_r2, m_y );
+                oldb = beta;
+                beta = detail::dot( m_r2, m_y );
+                if( beta < ValueT( 0 ) )
+                {
+                    return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                          "MINRES preconditioner is not positive definite" );
+                }
+                beta = std::sqrt( beta );
+
+                // Apply the previous rotation, then compute and apply the new one
+                const ValueT oldeps = epsln;
+                const ValueT delta  = cs * dbar + sn * alfa;
+                const ValueT gbar   = sn * dbar - cs * alfa;
+                epsln = sn * beta;
+                dbar  = -cs * beta;
+
+                const ValueT gamma = std::max( std::hypot( gbar, beta ),
+                                               std::numeric_limits<ValueT>::epsilon() );
+                cs = gbar / gamma;
+                sn = beta / gamma;
+                const ValueT phi = cs * phibar;
+                phibar = sn * phibar;
+
+                // Update the search direction and the solution
+                m_w1.data().swap( m_w2.data() );
+                m_w2.data().swap( m_w.data() );
+                const ValueT denom = ValueT( 1 ) / gamma;
+                for( size_t i = 0; i < n; i++ )
+                {
+                    m_w[i] = ( m_v[i] - oldeps * m_w1[i] - delta * m_w2[i] ) * denom;
+                }
+                detail::axpy( phi, m_w, x );
+                info.iterations++;
+
+                info.residual_norm = std::fabs( phibar );
+                if( info.residual_norm <= tol )
+                {
+                    info.converged = true;
+                    break;
+                }
+                if( beta == ValueT( 0 ) )
+                {
+                    // Invariant subspace found; x is exact for the Krylov space
+                    info.converged = true;
+                    break;
+                }
+            }
+            return outcome::ok<Iterative_Solver_Info>( info );
+        }
+
+    private:
+
+        /// @brief Stopping controls
+        Iterative_Solver_Options m_options;
+
+        /// @brief Work vectors
+        VectorN<ValueT> m_r1;
+        VectorN<ValueT> m_r2;
+        VectorN<ValueT> m_y;
+        VectorN<ValueT> m_v;
+        VectorN<ValueT> m_w;
+        VectorN<ValueT> m_w1;
+        VectorN<ValueT> m_w2;
+
+}; // End of MINRES_Solver class
+
+/**
+ * LSQR for min ||Ax-b|| with rectangular operators (Paige & Saunders).
+ *
+ * Mathematically equivalent to CG on the normal equations, but never forms A^T A.
+ */
+template <typename ValueT>
+class LSQR_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Constructor
+         */
+        explicit LSQR_Solver( const Iterative_Solver_Options& options = Iterative_Solver_Options() )
+            : m_options( options )
+        {
+        }
+
+        /**
+         * Get the stopping controls
+         */
+        const Iterative_Solver_Options& options() const
+        {
+            return m_options;
+        }
+
+        /**
+         * Set the stopping controls
+         */
+        void set_options( const Iterative_Solver_Options& options )
+        {
+            m_options = options;
+        }
+
+        /**
+         * Solve min ||Ax-b||.  x is resized to A.cols() if needed.
+         */
+        template <Transposable_Linear_Operator<ValueT> OperatorT>
+        Result<Iterative_Solver_Info> solve( const OperatorT&       A,
+                                             const VectorN<ValueT>& b,
+                                             VectorN<ValueT>&       x )
+        {
+            auto res = detail::check_dimensions( A, b, x, false );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+
+            const size_t m = A.rows();
+            const size_t n = A.cols();
+            detail::resize_workspace( m_u,  m );
+            detail::resize_workspace( m_Av, m );
+            detail::resize_workspace( m_v,  n );
+            detail::resize_workspace( m_w,  n );
+            detail::resize_workspace( m_Atu, n );
+
+            Iterative_Solver_Info info;
+            const double tol = std::max( m_options.relative_tolerance * double( detail::norm2( b ) ),
+                                         m_options.absolute_tolerance );
+
+            // Golub-Kahan start:  beta u = b - A x,  alfa v = A^T u
+            A.apply( x, m_Av );
+            for( size_t i = 0; i < m; i++ )
+            {
+                m_u[i] = b[i] - m_Av[i];
+            }
+            ValueT beta = detail::norm2( m_u );
+            if( beta > ValueT( 0 ) )
+            {
+                detail::scale( ValueT( 1 ) / beta, m_u );
+            }
+            A.apply_transpose( m_u, m_v );
+            ValueT alfa = detail::norm2( m_v );
+            if( alfa > ValueT( 0 ) )
+            {
+                detail::scale( ValueT( 1 ) / alfa, m_v );
+            }
+            std::copy( m_v.begin(), m_v.end(), m_w.begin() );
+
+            ValueT phibar = beta;
+            ValueT rhobar = alfa;
+            double anorm  = 0;
+
+            info.residual_norm        = beta;
+            info.normal_residual_norm = alfa * beta;
+            if( info.residual_norm <= tol || info.normal_residual_norm == 0 )
+            {
+                info.converged = true;
+                return outcome::ok<Iterative_Solver_Info>( info );
+            }
+
+            const size_t max_iterations = detail::resolve_max_iterations( m_options, n );
+            while( info.iterations < max_iterations )
+            {
+                // Continue the bidiagonalization
+                A.apply( m_v, m_Av );
+                for( size_t i = 0; i < m; i++ )
+                {
+                    m_u[i] = m_Av[i] - alfa * m_u[i];
+                }
+                beta = detail::norm2( m_u );
+                if( beta > ValueT( 0 ) )
+                {
+                    detail::scale( ValueT( 1 ) / beta, m_u );
+                }
+                anorm = std::sqrt( anorm * anorm + double( alfa ) * alfa + double( beta ) * beta );
+
+                A.apply_transpose( m_u, m_Atu );
+                for( size_t i = 0; i < n; i++ )
+                {
+                    m_v[i] = m_Atu[i] - beta * m_v[i];
+                }
+                alfa = detail::norm2( m_v );
+                if( alfa > ValueT( 0 ) )
+                {
+                    detail::scale( ValueT( 1 ) / alfa, m_v );
+                }
+
+                // Plane rotation eliminating the subdiagonal
+                const ValueT rho   = std::hypot( rhobar, beta );
+                const ValueT c     = rhobar / rho;
+                const ValueT s     = beta / rho;
+                const ValueT theta = s * alfa;
+                rhobar = -c * alfa;
+                const ValueT phi = c * phibar;
+                phibar = s * phibar;
+
+                // Update x and w
+                detail::axpy( phi / rho, m_w, x );
+                detail::xpby( m_v, -theta / rho, m_w );
+                info.iterations++;
+
+                info.residual_norm        = std::fabs( phibar );
+                info.normal_residual_norm = std::fabs( alfa * c * phibar );
+                if( info.residual_norm <= tol ||
+                    info.normal_residual_norm <= m_options.relative_tolerance * anorm * info.residual_norm )
+                {
+                    info.converged = true;
+                    break;
+                }
+            }
+            return outcome::ok<Iterative_Solver_Info>( info );
+        }
+
+    private:
+
+        /// @brief Stopping controls
+        Iterative_Solver_Options m_options;
+
+        /// @brief Work vectors
+        VectorN<ValueT> m_u;
+        VectorN<ValueT> m_Av;
+        VectorN<ValueT> m_v;
+        VectorN<ValueT> m_w;
+        VectorN<ValueT> m_Atu;
+
+}; // End of LSQR_Solver class
+
+/**
+ * LSMR for min ||Ax-b|| with rectangular operators (Fong & Saunders).
+ *
+ * Equivalent to MINRES on the normal equations, so ||A^T r|| decreases monotonically,
+ * which makes it safer than LSQR to stop early on inconsistent systems.
+ */
+template <typename ValueT>
+class LSMR_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Constructor
+         */
+        explicit LSMR_Solver( const Iterative_Solver_Options& options = Iterative_Solver_Options() )
+            : m_options( options )
+        {
+        }
+
+        /**
+         * Get the stopping controls
+         */
+        const Iterative_Solver_Options& options() const
+        {
+            return m_options;
+        }
+
+        /**
+         * Set the stopping controls
+         */
+        void set_options( const Iterative_Solver_Options& options )
+        {
+            m_options = options;
+        }
+
+        /**
+         * Solve min ||Ax-b||.  x is resized to A.cols() if needed.
+         */
+        template <Transposable_Linear_Operator<ValueT> OperatorT>
+        Result<Iterative_Solver_Info> solve( const OperatorT&       A,
+                                             const VectorN<ValueT>& b,
+                                             VectorN<ValueT>&       x )
+        {
+            auto res = detail::check_dimensions( A, b, x, false );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+
+            const size_t m = A.rows();
+            const size_t n = A.cols();
+            detail::resize_workspace( m_u,    m );
+            detail::resize_workspace( m_Av,   m );
+            detail::resize_workspace( m_v,    n );
+            detail::resize_workspace( m_h,    n );
+            detail::resize_workspace( m_hbar, n );
+            detail::resize_workspace( m_Atu,  n );
+
+            Iterative_Solver_Info info;
+            const double tol = std::max( m_options.relative_tolerance * double( detail::norm2( b ) ),
+                                         m_options.absolute_tolerance );
+
+            // Golub-Kahan start
+            A.apply( x, m_Av );
+            for( size_t i = 0; i < m; i++ )
+            {
+                m_u[i] = b[i] - m_Av[i];
+            }
+            ValueT beta = detail::norm2( m_u );
+            if( beta > ValueT( 0 ) )
+            {
+                detail::scale( ValueT( 1 ) / beta, m_u );
+            }
+            A.apply_transpose( m_u, m_v );
+            ValueT alpha = detail::norm2( m_v );
+            if( alpha > ValueT( 0 ) )
+            {
+                detail::scale( ValueT( 1 ) / alpha, m_v );
+            }
+
+            info.residual_norm        = beta;
+            info.normal_residual_norm = alpha * beta;
+            if( info.residual_norm <= tol || info.normal_residual_norm == 0 )
+            {
+                info.converged = true;
+                return outcome::ok<Iterative_Solver_Info>( info );
+            }
+
+            // Rotation state for the solution update
+            ValueT zetabar  = alpha * beta;
+            ValueT alphabar = alpha;
+            ValueT rho      = 1;
+            ValueT rhobar   = 1;
+            ValueT cbar     = 1;
+            ValueT sbar     = 0;
+            std::copy( m_v.begin(), m_v.end(), m_h.begin() );
+            std::fill( m_hbar.begin(), m_hbar.end(), ValueT( 0 ) );
+
+            // State for the ||r|| estimate
+            ValueT betadd      = beta;
+            ValueT betad       = 0;
+            ValueT rhodold     = 1;
+            ValueT tautildeold = 0;
+            ValueT thetatilde  = 0;
+            ValueT zeta        = 0;
+            double norm_a2     = double( alpha ) * alpha;
+
+            const size_t max_iterations = detail::resolve_max_iterations( m_options, n );
+            while( info.iterations < max_iterations )
+            {
+                // Continue the bidiagonalization
+                A.apply( m_v, m_Av );
+                for( size_t i = 0; i < m; i++ )
+                {
+                    m_u[i] = m_Av[i] - alpha * m_u[i];
+                }
+                beta = detail::norm2( m_u );
+                if( beta > ValueT( 0 ) )
+                {
+                    detail::scale( ValueT( 1 ) / beta, m_u );
+                    A.apply_transpose( m_u, m_Atu );
+                    for( size_t i = 0; i < n; i++ )
+                    {
+                        m_v[i] = m_Atu[i] - beta * m_v[i];
+                    }
+                    alpha = detail::norm2( m_v );
+                    if( alpha > ValueT( 0 ) )
+                    {
+                        detail::scale( ValueT( 1 ) / alpha, m_v );
+                    }
+                }
+
+                // First rotation:  Q_i
+                const ValueT rhoold = rho;
+                rho = std::hypot( alphabar, beta );
+                const ValueT c        = alphabar / rho;
+                const ValueT s        = beta / rho;
+                const ValueT thetanew = s * alpha;
+                alphabar = c * alpha;
+
+                // Second rotation:  Qbar_i
+                const ValueT rhobarold = rhobar;
+                const ValueT zetaold   = zeta;
+                const ValueT thetabar  = sbar * rho;
+                const ValueT rhotemp   = cbar * rho;
+                rhobar = std::hypot( rhotemp, thetanew );
+                cbar   = rhotemp / rhobar;
+                sbar   = thetanew / rhobar;
+                zeta    = cbar * zetabar;
+                zetabar = -sbar * zetabar;
+
+                // Update h, hbar and x
+                detail::xpby( m_h, -thetabar * rho / ( rhoold * rhobarold ), m_hbar );
+                detail::axpy( zeta / ( rho * rhobar ), m_hbar, x );
+                detail::xpby( m_v, -thetanew / rho, m_h );
+                info.iterations++;
+
+                // Estimate ||r||
+                const ValueT betaacute = betadd;
+                const ValueT betahat   = c * betaacute;
+                betadd = -s * betaacute;
+
+                const ValueT thetatildeold = thetatilde;
+                const ValueT rhotildeold   = std::hypot( rhodold, thetabar );
+                const ValueT ctildeold     = rhodold / rhotildeold;
+                const ValueT stildeold     = thetabar / rhotildeold;
+                thetatilde = stildeold * rhobar;
+                rhodold    = ctildeold * rhobar;
+                betad      = -stildeold * betad + ctildeold * betahat;
+
+                tautildeold = ( zetaold - thetatildeold * tautildeold ) / rhotildeold;
+                const ValueT taud = ( zeta - thetatilde * tautildeold ) / rhodold;
+                info.residual_norm = std::sqrt( double( betad - taud ) * ( betad - taud ) +
+                                                double( betadd ) * betadd );
+
+                // Estimate ||A||
+                norm_a2 += double( beta ) * beta;
+                const double norm_a = std::sqrt( norm_a2 );
+                norm_a2 += double( alpha ) * alpha;
+
+                info.normal_residual_norm = std::fabs( zetabar );
+                if( info.residual_norm <= tol ||
+                    info.normal_residual_norm <= m_options.relative_tolerance * norm_a * info.residual_norm )
+                {
+                    info.converged = true;
+                    break;
+                }
+            }
+            return outcome::ok<Iterative_Solver_Info>( info );
+        }
+
+    private:
+
+        /// @brief Stopping controls
+        Iterative_Solver_Options m_options;
+
+        /// @brief Work vectors
+        VectorN<ValueT> m_u;
+        VectorN<ValueT> m_Av;
+        VectorN<ValueT> m_v;
+        VectorN<ValueT> m_h;
+        VectorN<ValueT> m_hbar;
+        VectorN<ValueT> m_Atu;
+
+}; // End of LSMR_Solver class
+
+} // End of tmns::math::linalg namespace
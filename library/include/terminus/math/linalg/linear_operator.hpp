@@ -0,0 +1,216 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    linear_operator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+namespace tmns::math::linalg {
+
+/**
+ * A linear operator A which can compute y = A*x without exposing its entries.
+ *
+ * Implementations provide rows(), cols() and apply( x, y ).  The solvers always pass a y
+ * which is already sized to rows(), so apply() only needs to fill it in.
+ */
+template <typename OperatorT,
+          typename ValueT>
+concept Linear_Operator = requires( const OperatorT&     op,
+                                    const VectorN<ValueT>& x,
+                                    VectorN<ValueT>&       y )
+{
+    { op.rows() } -> std::convertible_to<size_t>;
+    { op.cols() } -> std::convertible_to<size_t>;
+    op.apply( x, y );
+};
+
+/**
+ * A linear operator which can also compute y = A^T*x.  Required by the least squares
+ * solvers.  As with apply(), y is pre-sized to cols().
+ */
+template <typename OperatorT,
+          typename ValueT>
+concept Transposable_Linear_Operator = Linear_Operator<OperatorT,ValueT> &&
+    requires( const OperatorT&       op,
+              const VectorN<ValueT>& x,
+              VectorN<ValueT>&       y )
+{
+    op.apply_transpose( x, y );
+};
+
+/**
+ * Wraps any dense matrix so it can be passed to the iterative solvers.  The matrix is held
+ * by reference and must outlive the operator.
+ */
+template <typename MatrixT>
+class Dense_Operator
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = typename MatrixT::value_type;
+
+        /**
+         * Constructor
+         */
+        explicit Dense_Operator( const MatrixT& matrix )
+            : m_matrix( matrix )
+        {
+        }
+
+        /**
+         * Number of rows of the wrapped matrix
+         */
+        size_t rows() const
+        {
+            return m_matrix.rows();
+        }
+
+        /**
+         * Number of columns of the wrapped matrix
+         */
+        size_t cols() const
+        {
+            return m_matrix.cols();
+        }
+
+        /**
+         * y = A * x
+         */
+        void apply( const VectorN<value_type>& x,
+                    VectorN<value_type>&       y ) const
+        {
+            for( size_t r = 0; r < m_matrix.rows(); r++ )
+            {
+                value_type s = 0;
+                for( size_t c = 0; c < m_matrix.cols(); c++ )
+                {
+                    s += m_matrix( r, c ) * x[c];
+                }
+                y[r] = s;
+            }
+        }
+
+        /**
+         * y = A^T * x
+         */
+        void apply_transpose( const VectorN<value_type>& x,
+                              VectorN<value_type>&       y ) const
+        {
+            std::fill( y.begin(), y.end(), value_type( 0 ) );
+            for( size_t r = 0; r < m_matrix.rows(); r++ )
+            {
+                const value_type xr = x[r];
+                for( size_t c = 0; c < m_matrix.cols(); c++ )
+                {
+                    y[c] += m_matrix( r, c ) * xr;
+                }
+            }
+        }
+
+    private:
+
+        /// @brief Wrapped matrix
+        const MatrixT& m_matrix;
+
+}; // End of Dense_Operator class
+
+namespace detail {
+
+/**
+ * Resize a work vector only when its size differs
+ */
+template <typename ValueT>
+void resize_workspace( VectorN<ValueT>& v,
+                       size_t           n )
+{
+    if( v.size() != n )
+    {
+        v.data().resize( n );
+    }
+}
+
+/**
+ * Inner product of two equally-sized vectors
+ */
+template <typename ValueT>
+ValueT dot( const VectorN<ValueT>& a,
+            const VectorN<ValueT>& b )
+{
+    ValueT s = 0;
+    for( size_t i = 0; i < a.size(); i++ )
+    {
+        s += a[i] * b[i];
+    }
+    return s;
+}
+
+/**
+ * Euclidean norm
+ */
+template <typename ValueT>
+ValueT norm2( const VectorN<ValueT>& a )
+{
+    return std::sqrt( dot( a, a ) );
+}
+
+/**
+ * y += alpha * x
+ */
+template <typename ValueT>
+void axpy( ValueT                 alpha,
+           const VectorN<ValueT>& x,
+           VectorN<ValueT>&       y )
+{
+    for( size_t i = 0; i < y.size(); i++ )
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+/**
+ * y = x + beta * y
+ */
+template <typename ValueT>
+void xpby( const VectorN<ValueT>& x,
+           ValueT                 beta,
+           VectorN<ValueT>&       y )
+{
+    for( size_t i = 0; i < y.size(); i++ )
+    {
+        y[i] = x[i] + beta * y[i];
+    }
+}
+
+/**
+ * x *= alpha
+ */
+template <typename ValueT>
+void scale( ValueT           alpha,
+            VectorN<ValueT>& x )
+{
+    for( auto& v : x.data() )
+    {
+        v *= alpha;
+    }
+}
+
+} // End of detail namespace
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,406 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    lu_decomposition.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/condition_estimate.hpp>
+#include <terminus/math/linalg/triangular_solve.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * LU decomposition with partial pivoting, P A = L U.
+ *
+ * L (unit lower) and U share one row-major matrix.  The elimination updates whole trailing
+ * rows, so its inner loop is contiguous, and all solves go through the shared trsv/trsm
+ * kernels.  A singular matrix still factors; is_singular() reports it and the solves fail.
+ *
+ * condition() estimates the 1-norm condition number in O(n^2) from the stored factors, so
+ * callers can detect ill-conditioning that an exact-zero pivot test misses.
+ */
+template <typename ValueT>
+class LU_Decomposition
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor.  Call compute() before use.
+         */
+        LU_Decomposition() = default;
+
+        /**
+         * Factor A on construction.  Check is_computed() for failure.
+         */
+        explicit LU_Decomposition( const MatrixN<ValueT>& A )
+        {
+            (void)compute( A );
+        }
+
+        /**
+         * Factor a square matrix
+         */
+        Result<void> compute( const MatrixN<ValueT>& A )
+        {
+            m_computed = false;
+            if( A.rows() != A.cols() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "LU_Decomposition requires a square matrix.  Actual: "
+                                      + std::to_string( A.rows() ) + " x " + std::to_string( A.cols() ) );
+            }
+
+            const size_t n = A.rows();
+            m_norm_1 = detail::matrix_norm_1( A.data(), n );
+            m_LU = A;
+            m_perm.data().resize( n );
+            for( size_t i = 0; i < n; i++ )
+            {
+                m_perm[i] = i;
+            }
+            m_sign     = 1;
+            m_singular = false;
+
+            ValueT* lu = m_LU.data();
+            for( size_t k = 0; k < n; k++ )
+            {
+                // Pivot on the largest magnitude in column k
+                size_t pivot = k;
+                ValueT best  = std::abs( lu[k * n + k] );
+                for( size_t i = k + 1; i < n; i++ )
+                {
+                    const ValueT v = std::abs( lu[i * n + k] );
+                    if( v > best )
+                    {
+                        best  = v;
+                        pivot = i;
+                    }
+                }
+                if( best == ValueT( 0 ) )
+                {
+                    m_singular = true;
+                    continue;
+                }
+                if( pivot != k )
+                {
+                    std::swap_ranges( lu + k * n, lu + ( k + 1 ) * n, lu + pivot * n );
+                    std::swap( m_perm[k], m_perm[pivot] );
+                    m_sign = -m_sign;
+                }
+
+                // Eliminate below the pivot, one contiguous trailing row at a time
+                const ValueT  inv_pivot = ValueT( 1 ) / lu[k * n + k];
+                const ValueT* row_k     = lu + k * n;
+                for( size_t i = k + 1; i < n; i++ )
+                {
+                    ValueT*      row_i = lu + i * n;
+                    const ValueT l     = row_i[k] * inv_pivot;
+                    row_i[k] = l;
+                    if( l != ValueT( 0 ) )
+                    {
+                        for( size_t j = k + 1; j < n; j++ )
+                        {
+                            row_i[j] -= l * row_k[j];
+                        }
+                    }
+                }
+            }
+
+            m_computed = true;
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A x = b into an existing vector
+         */
+        Result<void> solve( const VectorN<ValueT>& b,
+                            VectorN<ValueT>&       x ) const
+        {
+            auto res = check_solvable( b.size() );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            const size_t n = size();
+            if( x.size() != n )
+            {
+                x.data().resize( n );
+            }
+            for( size_t i = 0; i < n; i++ )
+            {
+                x[i] = b[m_perm[i]];
+            }
+            trsv( Triangle::LOWER, Transpose::NO_TRANSPOSE, Diagonal::UNIT,     n, m_LU.data(), n, x.data().data() );
+            trsv( Triangle::UPPER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT, n, m_LU.data(), n, x.data().data() );
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A x = b, returning a new vector
+         */
+        Result<VectorN<ValueT>> solve( const VectorN<ValueT>& b ) const
+        {
+            VectorN<ValueT> x( size() );
+            auto res = solve( b, x );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<VectorN<ValueT>>( std::move( x ) );
+        }
+
+        /**
+         * Solve A^T x = b into an existing vector
+         */
+        Result<void> solve_transpose( const VectorN<ValueT>& b,
+                                      VectorN<ValueT>&       x ) const
+        {
+            auto res = check_solvable( b.size() );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            const size_t n = size();
+            VectorN<ValueT> y = b;
+            trsv( Triangle::UPPER, Transpose::TRANSPOSE, Diagonal::NON_UNIT, n, m_LU.data(), n, y.data().data() );
+            trsv( Triangle::LOWER, Transpose::TRANSPOSE, Diagonal::UNIT,     n, m_LU.data(), n, y.data().data() );
+            if( x.size() != n )
+            {
+                x.data().resize( n );
+            }
+            for( size_t i = 0; i < n; i++ )
+            {
+                x[m_perm[i]] = y[i];
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A X = B for every column of B into an existing matrix
+         */
+        Result<void> solve( const MatrixN<ValueT>& B,
+                            MatrixN<ValueT>&       X ) const
+        {
+            auto res = check_solvable( B.rows() );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            const size_t n    = size();
+            const size_t nrhs = B.cols();
+            if( X.rows() != n || X.cols() != nrhs )
+            {
+                X.set_size( n, nrhs );
+            }
+            for( size_t i = 0; i < n; i++ )
+            {
+                std::copy( B.data() + m_perm[i] * nrhs,
+                           B.data() + ( m_perm[i] + 1 ) * nrhs,
+                           X.data() + i * nrhs );
+            }
+            trsm( Triangle::LOWER, Transpose::NO_TRANSPOSE, Diagonal::UNIT,     n, nrhs, m_LU.data(), n, X.data(), nrhs );
+            trsm( Triangle::UPPER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT, n, nrhs, m_LU.data(), n, X.data(), nrhs );
+            return outcome::ok();
+        }
+
+        /**
+         * Solve A x = b and estimate the condition number of A in the same call
+         */
+        Result<Condition_Info<ValueT>> solve_with_condition( const VectorN<ValueT>& b,
+                                                             VectorN<ValueT>&       x ) const
+        {
+            auto res = solve( b, x );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<Condition_Info<ValueT>>( condition() );
+        }
+
+        /**
+         * Estimate the 1-norm condition number of A from the stored factors in O(n^2)
+         */
+        Condition_Info<ValueT> condition() const
+        {
+            Condition_Info<ValueT> info;
+            info.norm_1 = m_norm_1;
+            if( !m_computed || m_singular )
+            {
+                return info;
+            }
+
+            const size_t n = size();
+            std::vector<ValueT> tmp( n );
+            info.inverse_norm_1 = estimate_inverse_norm_1<ValueT>( n,
+                [&]( std::vector<ValueT>& x )
+                {
+                    for( size_t i = 0; i < n; i++ )
+                    {
+                        tmp[i] = x[m_perm[i]];
+                    }
+                    trsv( Triangle::LOWER, Transpose::NO_TRANSPOSE, Diagonal::UNIT,     n, m_LU.data(), n, tmp.data() );
+                    trsv( Triangle::UPPER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT, n, m_LU.data(), n, tmp.data() );
+                    x = tmp;
+                },
+                [&]( std::vector<ValueT>& x )
+                {
+                    trsv( Triangle::UPPER, Transpose::TRANSPOSE, Diagonal::NON_UNIT, n, m_LU.data(), n, x.data() );
+                    trsv( Triangle::LOWER, Transpose::TRANSPOSE, Diagonal::UNIT,     n, m_LU.data(), n, x.data() );
+                    for( size_t i = 0; i < n; i++ )
+                    {
+                        tmp[m_perm[i]] = x[i];
+                    }
+                    x = tmp;
+                });
+            info.rcond = detail::reciprocal_condition( info.norm_1, info.inverse_norm_1 );
+            return info;
+        }
+
+        /**
+         * Inverse of A, computed as the solution of A X = I
+         */
+        Result<MatrixN<ValueT>> inverse() const
+        {
+            const size_t n = size();
+            MatrixN<ValueT> I( n, n );
+            for( size_t i = 0; i < n; i++ )
+            {
+                I( i, i ) = ValueT( 1 );
+            }
+            MatrixN<ValueT> X;
+            auto res = solve( I, X );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<MatrixN<ValueT>>( std::move( X ) );
+        }
+
+        /**
+         * Determinant of A, the signed product of the pivots
+         */
+        ValueT determinant() const
+        {
+            if( !m_computed || m_singular )
+            {
+                return ValueT( 0 );
+            }
+            ValueT det = ValueT( m_sign );
+            for( size_t i = 0; i < size(); i++ )
+            {
+                det *= m_LU( i, i );
+            }
+            return det;
+        }
+
+        /**
+         * Combined factors:  L below the diagonal (unit diagonal implied), U on and above
+         */
+        const MatrixN<ValueT>& matrix_lu() const
+        {
+            return m_LU;
+        }
+
+        /**
+         * Row permutation:  row i of P A is row permutation()[i] of A
+         */
+        const VectorN<size_t>& permutation() const
+        {
+            return m_perm;
+        }
+
+        /**
+         * Dimension of the factored matrix
+         */
+        size_t size() const
+        {
+            return m_LU.rows();
+        }
+
+        /**
+         * Check if a factorization is stored
+         */
+        bool is_computed() const
+        {
+            return m_computed;
+        }
+
+        /**
+         * Check if a zero pivot was found
+         */
+        bool is_singular() const
+        {
+            return m_singular;
+        }
+
+    private:
+
+        /**
+         * Common checks before any solve
+         */
+        Result<void> check_solvable( size_t rhs_rows ) const
+        {
+            if( !m_computed )
+            {
+                return outcome::fail( error::Error_Code::UNINITIALIZED,
+                                      "LU_Decomposition::solve() called before compute()" );
+            }
+            if( m_singular )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "LU_Decomposition: matrix is singular" );
+            }
+            if( rhs_rows != size() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Right-hand side has " + std::to_string( rhs_rows )
+                                      + " rows, expected " + std::to_string( size() ) );
+            }
+            return outcome::ok();
+        }
+
+        /// @brief Combined L and U factors
+        MatrixN<ValueT> m_LU;
+
+        /// @brief Row permutation
+        VectorN<size_t> m_perm;
+
+        /// @brief 1-norm of the factored matrix
+        ValueT m_norm_1 { 0 };
+
+        /// @brief Sign of the permutation
+        int m_sign { 1 };
+
+        /// @brief Set when a factorization is stored
+        bool m_computed { false };
+
+        /// @brief Set when a zero pivot was found
+        bool m_singular { false };
+
+}; // End of LU_Decomposition class
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,772 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    matrix_functions.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/lu_decomposition.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Dense matrix functions:  exponential, logarithm and principal square root.
+ *
+ * The general routines work on square MatrixN and follow Higham:
+ *  - expm:  diagonal Pade approximant of degree 3..13 with scaling and squaring.
+ *  - sqrtm: product-form Denman-Beavers iteration with determinant scaling.
+ *  - logm:  inverse scaling and squaring, i.e. repeated square roots followed by a
+ *           Gauss-Legendre partial-fraction Pade approximant of log(I + X).
+ *
+ * Fixed-size overloads route 3x3 skew-symmetric generators and rotations through Rodrigues'
+ * formula, and 4x4 rigid-body generators and transforms through the closed-form SE(3) maps,
+ * which are both faster and exact to rounding.  Anything else falls back to the general path.
+ */
+namespace tmns::math::linalg {
+namespace detail {
+
+/**
+ * C = A * B for n x n row-major matrices.  C must not alias A or B.
+ */
+template <typename ValueT>
+void square_multiply( const MatrixN<ValueT>& A,
+                      const MatrixN<ValueT>& B,
+                      MatrixN<ValueT>&       C )
+{
+    const size_t n = A.rows();
+    if( C.rows() != n || C.cols() != n )
+    {
+        C.set_size( n, n );
+    }
+    const ValueT* a = A.data();
+    const ValueT* b = B.data();
+    ValueT*       c = C.data();
+    std::fill( c, c + n * n, ValueT( 0 ) );
+    for( size_t i = 0; i < n; i++ )
+    {
+        ValueT* c_row = c + i * n;
+        for( size_t k = 0; k < n; k++ )
+        {
+            const ValueT  aik   = a[i * n + k];
+            const ValueT* b_row = b + k * n;
+            for( size_t j = 0; j < n; j++ )
+            {
+                c_row[j] += aik * b_row[j];
+            }
+        }
+    }
+}
+
+/**
+ * Matrix 1-norm, the maximum absolute column sum
+ */
+template <typename ValueT>
+ValueT norm_1( const MatrixN<ValueT>& A )
+{
+    std::vector<ValueT> sums( A.cols(), ValueT( 0 ) );
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        const ValueT* row = A.data() + r * A.cols();
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            sums[c] += std::abs( row[c] );
+        }
+    }
+    return sums.empty() ? ValueT( 0 ) : *std::max_element( sums.begin(), sums.end() );
+}
+
+/**
+ * n x n identity
+ */
+template <typename ValueT>
+MatrixN<ValueT> identity( size_t n )
+{
+    MatrixN<ValueT> I( n, n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        I( i, i ) = ValueT( 1 );
+    }
+    return I;
+}
+
+/**
+ * Check the input is square
+ */
+template <typename ValueT>
+Result<void> check_square( const MatrixN<ValueT>& A,
+                           const std::string&     func )
+{
+    if( A.rows() != A.cols() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              func + " requires a square matrix.  Actual: "
+                              + std::to_string( A.rows() ) + " x " + std::to_string( A.cols() ) );
+    }
+    return outcome::ok();
+}
+
+/**
+ * Skew-symmetric cross-product matrix of w
+ */
+template <typename ValueT>
+Matrix<ValueT,3,3> skew( ValueT wx, ValueT wy, ValueT wz )
+{
+    return Matrix<ValueT,3,3>( { ValueT( 0 ),         -wz,          wy,
+                                           wz, ValueT( 0 ),         -wx,
+                                          -wy,          wx, ValueT( 0 ) } );
+}
+
+/**
+ * Coefficients of the SO(3) / SE(3) exponential for rotation angle theta:
+ *   a = sin(t)/t,  b = (1 - cos(t))/t^2,  c = (t - sin(t))/t^3
+ * with Taylor expansions near zero.
+ */
+template <typename ValueT>
+void rodrigues_coefficients( ValueT  theta,
+                             ValueT& a,
+                             ValueT& b,
+                             ValueT& c )
+{
+    const ValueT t2 = theta * theta;
+    if( theta < ValueT( 1e-4 ) )
+    {
+        a = ValueT( 1 ) - t2 / ValueT( 6 ) + t2 * t2 / ValueT( 120 );
+        b = ValueT( 0.5 ) - t2 / ValueT( 24 ) + t2 * t2 / ValueT( 720 );
+        c = ValueT( 1 ) / ValueT( 6 ) - t2 / ValueT( 120 ) + t2 * t2 / ValueT( 5040 );
+        return;
+    }
+    a = std::sin( theta ) / theta;
+    b = ( ValueT( 1 ) - std::cos( theta ) ) / t2;
+    c = ( theta - std::sin( theta ) ) / ( t2 * theta );
+}
+
+/**
+ * Copy a fixed-size matrix out of a MatrixN of the same shape
+ */
+template <typename ValueT,
+          size_t   N>
+Matrix<ValueT,N,N> to_fixed( const MatrixN<ValueT>& A )
+{
+    Matrix<ValueT,N,N> out;
+    std::copy( A.data(), A.data() + N * N, out.data() );
+    return out;
+}
+
+} // End of detail namespace
+
+/**
+ * Matrix exponential by scaling and squaring with a diagonal Pade approximant.
+ *
+ * The Pade degree (3, 5, 7, 9 or 13) and scaling power are chosen from the 1-norm of A
+ * following Higham (2005), so small matrices need only a few products.
+ */
+template <typename ValueT>
+Result<MatrixN<ValueT>> expm( const MatrixN<ValueT>& A )
+{
+    auto check = detail::check_square( A, "expm()" );
+    if( check.has_error() )
+    {
+        return check.error();
+    }
+
+    const size_t n = A.rows();
+    if( n == 0 )
+    {
+        return outcome::ok<MatrixN<ValueT>>( A );
+    }
+
+    // Degree thresholds theta_m for double precision
+    static constexpr std::array<double,4> theta  { 1.495585217958292e-2, 2.539398330063230e-1,
+                                                   9.504178996162932e-1, 2.097847961257068e+0 };
+    static constexpr double               theta_13 = 5.371920351148152e+0;
+    static constexpr std::array<std::array<double,10>,4> low_coeffs {{
+        { 120., 60., 12., 1. },
+        { 30240., 15120., 3360., 420., 30., 1. },
+        { 17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1. },
+        { 17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+          2162160., 110880., 3960., 90., 1. } }};
+    static constexpr std::array<double,14> b13 { 64764752532480000., 32382376266240000., 7771770303897600.,
+                                                 1187353796428800., 129060195264000., 10559470521600.,
+                                                 670442572800., 33522128640., 1323241920., 40840800.,
+                                                 960960., 16380., 182., 1. };
+
+    const double norm = static_cast<double>( detail::norm_1( A ) );
+    const auto   I    = detail::identity<ValueT>( n );
+
+    MatrixN<ValueT> As = A;
+    MatrixN<ValueT> A2( n, n );
+    MatrixN<ValueT> U( n, n ), V( n, n ), tmp( n, n );
+    size_t squarings = 0;
+
+    // Accumulate sum_k coeff[k] * P_k into out
+    auto accumulate = [n]( MatrixN<ValueT>& out, std::initializer_list<std::pair<double,const MatrixN<ValueT>*>> terms )
+    {
+        ValueT* o = out.data();
+        std::fill( o, o + n * n, ValueT( 0 ) );
+        for( const auto& [coeff, mat] : terms )
+        {
+            const ValueT  c = static_cast<ValueT>( coeff );
+            const ValueT* m = mat->data();
+            for( size_t i = 0; i < n * n; i++ )
+            {
+                o[i] += c * m[i];
+            }
+        }
+    };
+
+    size_t degree_index = theta.size();
+    for( size_t d = 0; d < theta.size(); d++ )
+    {
+        if( norm <= theta[d] )
+        {
+            degree_index = d;
+            break;
+        }
+    }
+
+    detail::square_multiply( As, As, A2 );
+    if( degree_index < theta.size() )
+    {
+        // Low-degree approximant:  U = A * sum b_odd A^(k-1),  V = sum b_even A^k
+        const auto& b = low_coeffs[degree_index];
+        const size_t m = 3 + 2 * degree_index;
+        MatrixN<ValueT> power = I;
+        MatrixN<ValueT> U_inner( n, n ), next( n, n );
+        accumulate( U_inner, { { b[1], &I } } );
+        accumulate( V,       { { b[0], &I } } );
+        for( size_t k = 2; k <= m; k += 2 )
+        {
+            detail::square_multiply( power, A2, next );
+            power = next;
+            for( size_t i = 0; i < n * n; i++ )
+            {
+                V.data()[i]       += static_cast<ValueT>( b[k] )     * power.data()[i];
+                U_inner.data()[i] += static_cast<ValueT>( b[k + 1] ) * power.data()[i];
+            }
+        }
+        detail::square_multiply( As, U_inner, U );
+    }
+    else
+    {
+        // Degree 13 on A / 2^s
+        squarings = static_cast<size_t>( std::max( 0.0, std::ceil( std::log2( norm / theta_13 ) ) ) );
+        const ValueT scale = std::ldexp( ValueT( 1 ), -static_cast<int>( squarings ) );
+        for( size_t i = 0; i < n * n; i++ )
+        {
+            As.data()[i] *= scale;
+        }
+        detail::square_multiply( As, As, A2 );
+        MatrixN<ValueT> A4( n, n ), A6( n, n );
+        detail::square_multiply( A2, A2, A4 );
+        detail::square_multiply( A2, A4, A6 );
+
+        accumulate( tmp, { { b13[13], &A6 }, { b13[11], &A4 }, { b13[9], &A2 } } );
+        MatrixN<ValueT> inner( n, n );
+        detail::square_multiply( A6, tmp, inner );
+        accumulate( tmp, { { 1.0, &inner }, { b13[7], &A6 }, { b13[5], &A4 }, { b13[3], &A2 }, { b13[1], &I } } );
+        detail::square_multiply( As, tmp, U );
+
+        accumulate( tmp, { { b13[12], &A6 }, { b13[10], &A4 }, { b13[8], &A2 } } );
+        detail::square_multiply( A6, tmp, inner );
+        accumulate( V, { { 1.0, &inner }, { b13[6], &A6 }, { b13[4], &A4 }, { b13[2], &A2 }, { b13[0], &I } } );
+    }
+
+    // Solve ( V - U ) X = ( V + U )
+    MatrixN<ValueT> P( n, n ), Q( n, n );
+    for( size_t i = 0; i < n * n; i++ )
+    {
+        P.data()[i] = V.data()[i] + U.data()[i];
+        Q.data()[i] = V.data()[i] - U.data()[i];
+    }
+    LU_Decomposition<ValueT> lu( Q );
+    MatrixN<ValueT> X;
+    auto solve_res = lu.solve( P, X );
+    if( solve_res.has_error() )
+    {
+        return outcome::fail( error::Error_Code::UNKNOWN,
+                              "expm(): Pade denominator is singular.  " + solve_res.error().message() );
+    }
+
+    // Undo the scaling
+    for( size_t s = 0; s < squarings; s++ )
+    {
+        detail::square_multiply( X, X, tmp );
+        X = tmp;
+    }
+    return outcome::ok<MatrixN<ValueT>>( std::move( X ) );
+}
+
+/**
+ * Principal matrix square root by the scaled product-form Denman-Beavers iteration.
+ *
+ * Fails if A is singular or has eigenvalues on the closed negative real axis, where the
+ * principal root does not exist, or if the iteration does not converge.
+ */
+template <typename ValueT>
+Result<MatrixN<ValueT>> sqrtm( const MatrixN<ValueT>& A,
+                               size_t                 max_iterations = 50 )
+{
+    auto check = detail::check_square( A, "sqrtm()" );
+    if( check.has_error() )
+    {
+        return check.error();
+    }
+
+    // Convergence is quadratic, so one more step after ||M - I|| <= sqrt(eps) reaches rounding
+    const size_t n   = A.rows();
+    const ValueT tol = std::sqrt( std::numeric_limits<ValueT>::epsilon() );
+    bool finishing   = false;
+
+    // M_k -> I,  Y_k -> sqrt(A)
+    MatrixN<ValueT> M = A;
+    MatrixN<ValueT> Y = A;
+    MatrixN<ValueT> tmp( n, n );
+    LU_Decomposition<ValueT> lu;
+
+    for( size_t iter = 0; iter < max_iterations; iter++ )
+    {
+        auto lu_res = lu.compute( M );
+        if( lu_res.has_error() || lu.is_singular() )
+        {
+            return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                  "sqrtm(): matrix is singular or has no principal square root" );
+        }
+
+        // Determinant scaling accelerates the early iterations
+        const ValueT det = std::abs( lu.determinant() );
+        ValueT mu = ValueT( 1 );
+        if( !finishing && std::isfinite( det ) && det > ValueT( 0 ) )
+        {
+            mu = std::pow( det, ValueT( -1 ) / ValueT( 2 * n ) );
+        }
+
+        auto M_inv = lu.inverse().value();
+
+        // Y <- mu Y ( I + M^-1 / mu^2 ) / 2,  M <- ( mu^2 M + M^-1 / mu^2 + 2 I ) / 4
+        const ValueT mu2 = mu * mu;
+        for( size_t i = 0; i < n * n; i++ )
+        {
+            tmp.data()[i] = M_inv.data()[i] / mu2;
+        }
+        for( size_t i = 0; i < n; i++ )
+        {
+            tmp( i, i ) += ValueT( 1 );
+        }
+        MatrixN<ValueT> Y_next( n, n );
+        detail::square_multiply( Y, tmp, Y_next );
+
+        ValueT diff = 0;
+        for( size_t i = 0; i < n * n; i++ )
+        {
+            Y_next.data()[i] *= mu / ValueT( 2 );
+            M.data()[i] = ( mu2 * M.data()[i] + M_inv.data()[i] / mu2 ) / ValueT( 4 );
+        }
+        for( size_t i = 0; i < n; i++ )
+        {
+            M( i, i ) += ValueT( 0.5 );
+        }
+        for( size_t i = 0; i < n * n; i++ )
+        {
+            diff = std::max( diff, std::abs( M.data()[i] - ( ( i % ( n + 1 ) == 0 ) ? ValueT( 1 ) : ValueT( 0 ) ) ) );
+        }
+        Y = Y_next;
+
+        if( !std::isfinite( diff ) )
+        {
+            break;
+        }
+        if( finishing )
+        {
+            return outcome::ok<MatrixN<ValueT>>( std::move( Y ) );
+        }
+        finishing = ( diff <= tol );
+    }
+    return outcome::fail( error::Error_Code::UNKNOWN,
+                          "sqrtm(): Denman-Beavers iteration did not converge" );
+}
+
+/**
+ * Principal matrix logarithm by inverse scaling and squaring.
+ *
+ * Square roots are taken until ||A^(1/2^k) - I||_1 <= 0.25, then log(I + X) is evaluated
+ * with an 8-point Gauss-Legendre partial-fraction Pade approximant and scaled by 2^k.
+ * Fails where sqrtm() fails.
+ */
+template <typename ValueT>
+Result<MatrixN<ValueT>> logm( const MatrixN<ValueT>& A,
+                              size_t                 max_square_roots = 40 )
+{
+    auto check = detail::check_square( A, "logm()" );
+    if( check.has_error() )
+    {
+        return check.error();
+    }
+
+    // Gauss-Legendre nodes and weights on [-1, 1]
+    static constexpr std::array<double,4> nodes   { 0.1834346424956498, 0.5255324099163290,
+                                                    0.7966664774136267, 0.9602898564975363 };
+    static constexpr std::array<double,4> weights { 0.3626837833783620, 0.3137066458778873,
+                                                    0.2223810344533745, 0.1012285362903763 };
+
+    const size_t n = A.rows();
+    const auto   I = detail::identity<ValueT>( n );
+
+    MatrixN<ValueT> X = A;
+    size_t roots = 0;
+    while( true )
+    {
+        MatrixN<ValueT> D = X;
+        for( size_t i = 0; i < n; i++ )
+        {
+            D( i, i ) -= ValueT( 1 );
+        }
+        if( detail::norm_1( D ) <= ValueT( 0.25 ) )
+        {
+            X = D;
+            break;
+        }
+        if( roots == max_square_roots )
+        {
+            return outcome::fail( error::Error_Code::UNKNOWN,
+                                  "logm(): too many square roots needed" );
+        }
+        auto root = sqrtm( X );
+        if( root.has_error() )
+        {
+            return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                  "logm(): " + root.error().message() );
+        }
+        X = root.value();
+        roots++;
+    }
+
+    // log(I + X) = int_0^1 X ( I + t X )^-1 dt = sum_j w_j ( I + t_j X )^-1 X
+    MatrixN<ValueT> L( n, n );
+    MatrixN<ValueT> term;
+    LU_Decomposition<ValueT> lu;
+    for( size_t j = 0; j < 2 * nodes.size(); j++ )
+    {
+        const double node = ( j % 2 == 0 ) ? nodes[j / 2] : -nodes[j / 2];
+        const ValueT t    = static_cast<ValueT>( ( node + 1.0 ) / 2.0 );
+        const ValueT w    = static_cast<ValueT>( weights[j / 2] / 2.0 );
+
+        MatrixN<ValueT> denom = I;
+        for( size_t i = 0; i < n * n; i++ )
+        {
+            denom.data()[i] += t * X.data()[i];
+        }
+        (void)lu.compute( denom );
+        auto res = lu.solve( X, term );
+        if( res.has_error() )
+        {
+            return outcome::fail( error::Error_Code::UNKNOWN,
+                                  "logm(): Pade denominator is singular" );
+        }
+        for( size_t i = 0; i < n * n; i++ )
+        {
+            L.data()[i] += w * term.data()[i];
+        }
+    }
+
+    const ValueT scale = std::ldexp( ValueT( 1 ), static_cast<int>( roots ) );
+    for( size_t i = 0; i < n * n; i++ )
+    {
+        L.data()[i] *= scale;
+    }
+    return outcome::ok<MatrixN<ValueT>>( std::move( L ) );
+}
+
+/**
+ * Rotation matrix exp(K) for a 3x3 skew-symmetric K (Rodrigues' formula).
+ *
+ * Only the strict upper triangle of K is read.
+ */
+template <typename ValueT>
+Matrix<ValueT,3,3> expm_skew( const Matrix<ValueT,3,3>& K )
+{
+    const ValueT wx = K( 2, 1 ), wy = K( 0, 2 ), wz = K( 1, 0 );
+    const ValueT theta = std::sqrt( wx * wx + wy * wy + wz * wz );
+    ValueT a, b, c;
+    detail::rodrigues_coefficients( theta, a, b, c );
+
+    const auto S  = detail::skew( wx, wy, wz );
+    const Matrix<ValueT,3,3> S2 = S * S;
+    Matrix<ValueT,3,3> R = Matrix<ValueT,3,3>::identity();
+    for( size_t i = 0; i < 9; i++ )
+    {
+        R.data()[i] += a * S.data()[i] + b * S2.data()[i];
+    }
+    return R;
+}
+
+/**
+ * Skew-symmetric log(R) of a rotation matrix, the inverse of expm_skew()
+ *
+ * Handles angles near 0 and near pi, where the usual ( R - R^T ) / ( 2 sin ) form breaks down.
+ */
+template <typename ValueT>
+Matrix<ValueT,3,3> logm_rotation( const Matrix<ValueT,3,3>& R )
+{
+    // vee( R - R^T ) = 2 sin(theta) * axis.  atan2 keeps theta accurate near 0 and pi.
+    const ValueT wx = R( 2, 1 ) - R( 1, 2 );
+    const ValueT wy = R( 0, 2 ) - R( 2, 0 );
+    const ValueT wz = R( 1, 0 ) - R( 0, 1 );
+    const ValueT cos_theta = ( R.trace() - ValueT( 1 ) ) / ValueT( 2 );
+    const ValueT theta     = std::atan2( std::sqrt( wx * wx + wy * wy + wz * wz ) / ValueT( 2 ), cos_theta );
+
+    if( theta < ValueT( 1e-4 ) )
+    {
+        const ValueT f = ValueT( 0.5 ) * ( ValueT( 1 ) + theta * theta / ValueT( 6 ) );
+        return detail::skew( f * wx, f * wy, f * wz );
+    }
+    if( std::numbers::pi_v<ValueT> - theta < ValueT( 1e-3 ) )
+    {
+        // ( R + R^T ) / 2 - cos(theta) I = ( 1 - cos(theta) ) axis axis^T:  use its largest column
+        size_t k = 0;
+        for( size_t i = 1; i < 3; i++ )
+        {
+            if( R( i, i ) > R( k, k ) )
+            {
+                k = i;
+            }
+        }
+        std::array<ValueT,3> axis;
+        for( size_t i = 0; i < 3; i++ )
+        {
+            axis[i] = ( R( i, k ) + R( k, i ) ) / ValueT( 2 ) - ( i == k ? cos_theta : ValueT( 0 ) );
+        }
+        const ValueT norm = std::sqrt( axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2] );
+        const ValueT sign = ( axis[0] * wx + axis[1] * wy + axis[2] * wz ) < ValueT( 0 ) ? ValueT( -1 ) : ValueT( 1 );
+        const ValueT f = sign * theta / norm;
+        return detail::skew( f * axis[0], f * axis[1], f * axis[2] );
+    }
+    const ValueT f = theta / ( ValueT( 2 ) * std::sin( theta ) );
+    return detail::skew( f * wx, f * wy, f * wz );
+}
+
+/**
+ * Rigid transform exp(G) for a 4x4 twist generator G = [ K v ; 0 0 ] with K skew-symmetric
+ */
+template <typename ValueT>
+Matrix<ValueT,4,4> expm_rigid( const Matrix<ValueT,4,4>& G )
+{
+    const ValueT wx = G( 2, 1 ), wy = G( 0, 2 ), wz = G( 1, 0 );
+    const ValueT theta = std::sqrt( wx * wx + wy * wy + wz * wz );
+    ValueT a, b, c;
+    detail::rodrigues_coefficients( theta, a, b, c );
+
+    const auto S  = detail::skew( wx, wy, wz );
+    const Matrix<ValueT,3,3> S2 = S * S;
+
+    // R = I + a S + b S^2,  t = ( I + b S + c S^2 ) v
+    Matrix<ValueT,4,4> T = Matrix<ValueT,4,4>::identity();
+    for( size_t r = 0; r < 3; r++ )
+    {
+        ValueT t = G( r, 3 );
+        for( size_t k = 0; k < 3; k++ )
+        {
+            T( r, k ) += a * S( r, k ) + b * S2( r, k );
+            t += ( b * S( r, k ) + c * S2( r, k ) ) * G( k, 3 );
+        }
+        T( r, 3 ) = t;
+    }
+    return T;
+}
+
+/**
+ * Twist generator log(T) of a 4x4 rigid transform, the inverse of expm_rigid()
+ */
+template <typename ValueT>
+Matrix<ValueT,4,4> logm_rigid( const Matrix<ValueT,4,4>& T )
+{
+    Matrix<ValueT,3,3> R;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            R( r, c ) = T( r, c );
+        }
+    }
+    const auto   S     = logm_rotation( R );
+    const ValueT wx = S( 2, 1 ), wy = S( 0, 2 ), wz = S( 1, 0 );
+    const ValueT theta = std::sqrt( wx * wx + wy * wy + wz * wz );
+    const Matrix<ValueT,3,3> S2 = S * S;
+
+    // V^-1 = I - S / 2 + d S^2,  d = ( 1 - a / ( 2 b ) ) / theta^2
+    ValueT d;
+    if( theta < ValueT( 1e-4 ) )
+    {
+        d = ValueT( 1 ) / ValueT( 12 ) + theta * theta / ValueT( 720 );
+    }
+    else
+    {
+        ValueT a, b, c;
+        detail::rodrigues_coefficients( theta, a, b, c );
+        d = ( ValueT( 1 ) - a / ( ValueT( 2 ) * b ) ) / ( theta * theta );
+    }
+
+    Matrix<ValueT,4,4> G;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        ValueT v = T( r, 3 );
+        for( size_t k = 0; k < 3; k++ )
+        {
+            G( r, k ) = S( r, k );
+            v += ( -S( r, k ) / ValueT( 2 ) + d * S2( r, k ) ) * T( k, 3 );
+        }
+        G( r, 3 ) = v;
+    }
+    return G;
+}
+
+/**
+ * Matrix exponential of a fixed-size matrix.
+ *
+ * Exactly skew-symmetric 3x3 inputs use Rodrigues' formula and 4x4 twist generators use the
+ * closed-form SE(3) exponential; everything else goes through the Pade path.
+ */
+template <typename ValueT,
+          size_t   N>
+Result<Matrix<ValueT,N,N>> expm( const Matrix<ValueT,N,N>& A )
+{
+    if constexpr ( N == 3 || N == 4 )
+    {
+        bool structured = true;
+        for( size_t r = 0; r < 3 && structured; r++ )
+        {
+            for( size_t c = r; c < 3; c++ )
+            {
+                if( A( r, c ) != -A( c, r ) )
+                {
+                    structured = false;
+                    break;
+                }
+            }
+        }
+        if constexpr ( N == 4 )
+        {
+            structured = structured && A( 3, 0 ) == ValueT( 0 ) && A( 3, 1 ) == ValueT( 0 ) &&
+                                       A( 3, 2 ) == ValueT( 0 ) && A( 3, 3 ) == ValueT( 0 );
+        }
+        if( structured )
+        {
+            if constexpr ( N == 3 )
+            {
+                return outcome::ok<Matrix<ValueT,N,N>>( expm_skew( A ) );
+            }
+            else
+            {
+                return outcome::ok<Matrix<ValueT,N,N>>( expm_rigid( A ) );
+            }
+        }
+    }
+
+    auto res = expm( MatrixN<ValueT>( A ) );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<Matrix<ValueT,N,N>>( detail::to_fixed<ValueT,N>( res.value() ) );
+}
+
+/**
+ * Principal logarithm of a fixed-size matrix.
+ *
+ * 3x3 rotations and 4x4 rigid transforms (orthonormal to within sqrt(epsilon), positive
+ * determinant, [0 0 0 1] bottom row) use the closed-form inverse maps.
+ */
+template <typename ValueT,
+          size_t   N>
+Result<Matrix<ValueT,N,N>> logm( const Matrix<ValueT,N,N>& A )
+{
+    if constexpr ( N == 3 || N == 4 )
+    {
+        const ValueT tol = std::sqrt( std::numeric_limits<ValueT>::epsilon() );
+        bool structured = true;
+        for( size_t r = 0; r < 3 && structured; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                ValueT dot = 0;
+                for( size_t k = 0; k < 3; k++ )
+                {
+                    dot += A( k, r ) * A( k, c );
+                }
+                if( std::abs( dot - ( r == c ? ValueT( 1 ) : ValueT( 0 ) ) ) > tol )
+                {
+                    structured = false;
+                    break;
+                }
+            }
+        }
+        Matrix<ValueT,3,3> R;
+        for( size_t r = 0; r < 3; r++ )
+        {
+            for( size_t c = 0; c < 3; c++ )
+            {
+                R( r, c ) = A( r, c );
+            }
+        }
+        structured = structured && R.determinant() > ValueT( 0 );
+        if constexpr ( N == 4 )
+        {
+            structured = structured && A( 3, 0 ) == ValueT( 0 ) && A( 3, 1 ) == ValueT( 0 ) &&
+                                       A( 3, 2 ) == ValueT( 0 ) && A( 3, 3 ) == ValueT( 1 );
+        }
+        if( structured )
+        {
+            if constexpr ( N == 3 )
+            {
+                return outcome::ok<Matrix<ValueT,N,N>>( logm_rotation( A ) );
+            }
+            else
+            {
+                return outcome::ok<Matrix<ValueT,N,N>>( logm_rigid( A ) );
+            }
+        }
+    }
+
+    auto res = logm( MatrixN<ValueT>( A ) );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<Matrix<ValueT,N,N>>( detail::to_fixed<ValueT,N>( res.value() ) );
+}
+
+/**
+ * Principal square root of a fixed-size matrix
+ */
+template <typename ValueT,
+          size_t   N>
+Result<Matrix<ValueT,N,N>> sqrtm( const Matrix<ValueT,N,N>& A )
+{
+    auto res = sqrtm( MatrixN<ValueT>( A ) );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<Matrix<ValueT,N,N>>( detail::to_fixed<ValueT,N>( res.value() ) );
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,155 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    normal_equations.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/parallel_for.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * Add rows [row_begin, row_end) of a row-major J (rows x n) into the upper triangle of
+ * JtJ (n x n, row-major) and into Jte, in a single pass over J.
+ *
+ * Each row of J contributes the rank-one update a a^T to the upper triangle and e_r a to
+ * Jte.  The inner loop runs over a contiguous row of J and a contiguous row of JtJ, so it
+ * vectorizes without ever forming J^T.  Zero entries of J are skipped, which helps the
+ * block-sparse Jacobians typical of least squares.  The strict lower triangle of JtJ is
+ * not touched.
+ */
+template <typename ValueT>
+void accumulate_normal_equations( const ValueT* J,
+                                  size_t        n,
+                                  const ValueT* e,
+                                  size_t        row_begin,
+                                  size_t        row_end,
+                                  ValueT*       JtJ,
+                                  ValueT*       Jte )
+{
+    for( size_t r = row_begin; r < row_end; r++ )
+    {
+        const ValueT* row = J + r * n;
+        const ValueT  er  = e[r];
+        for( size_t i = 0; i < n; i++ )
+        {
+            const ValueT a = row[i];
+            if( a == ValueT( 0 ) )
+            {
+                continue;
+            }
+            Jte[i] += a * er;
+            ValueT* out = JtJ + i * n;
+            for( size_t j = i; j < n; j++ )
+            {
+                out[j] += a * row[j];
+            }
+        }
+    }
+}
+
+/**
+ * Form the Gauss-Newton normal equations JtJ = J^T J and Jte = J^T e.
+ *
+ * Only the upper triangle is accumulated, then mirrored, so the work is half of a general
+ * product and J is read exactly once.  For tall Jacobians the rows can be split over
+ * num_threads workers (zero means the hardware concurrency).  Each worker owns a
+ * contiguous row range and its own partial sums, which are added in worker order, so
+ * the result does not depend on thread scheduling.  JtJ and Jte are resized only when
+ * their size differs.
+ */
+template <typename ValueT>
+Result<void> normal_equations( const MatrixN<ValueT>& J,
+                               const VectorN<ValueT>& e,
+                               MatrixN<ValueT>&       JtJ,
+                               VectorN<ValueT>&       Jte,
+                               size_t                 num_threads = 1 )
+{
+    const size_t m = J.rows();
+    const size_t n = J.cols();
+    if( e.size() != m )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Residual has " + std::to_string( e.size() ) + " entries, Jacobian has "
+                              + std::to_string( m ) + " rows" );
+    }
+    if( JtJ.rows() != n || JtJ.cols() != n )
+    {
+        JtJ.set_size( n, n );
+    }
+    if( Jte.size() != n )
+    {
+        Jte = VectorN<ValueT>( n );
+    }
+    std::fill( JtJ.data(), JtJ.data() + n * n, ValueT( 0 ) );
+    std::fill( Jte.begin(), Jte.end(), ValueT( 0 ) );
+
+    // Below a few thousand rows the partial sums cost more than they save
+    constexpr size_t MIN_ROWS_PER_WORKER = 2048;
+    const size_t workers = resolve_thread_count( num_threads, std::max<size_t>( 1, m / MIN_ROWS_PER_WORKER ) );
+    if( workers == 1 )
+    {
+        accumulate_normal_equations( J.data(), n, e.data().data(), 0, m, JtJ.data(), Jte.data().data() );
+    }
+    else
+    {
+        std::vector<std::vector<ValueT>> partial_JtJ( workers, std::vector<ValueT>( n * n, ValueT( 0 ) ) );
+        std::vector<std::vector<ValueT>> partial_Jte( workers, std::vector<ValueT>( n, ValueT( 0 ) ) );
+        const size_t rows_per_worker = ( m + workers - 1 ) / workers;
+        parallel_for( workers, workers, 1, [&]( size_t begin, size_t end, size_t )
+        {
+            for( size_t w = begin; w < end; w++ )
+            {
+                const size_t row_begin = std::min( m, w * rows_per_worker );
+                const size_t row_end   = std::min( m, row_begin + rows_per_worker );
+                accumulate_normal_equations( J.data(), n, e.data().data(), row_begin, row_end,
+                                             partial_JtJ[w].data(), partial_Jte[w].data() );
+            }
+        });
+
+        ValueT* jtj = JtJ.data();
+        for( size_t w = 0; w < workers; w++ )
+        {
+            for( size_t i = 0; i < n; i++ )
+            {
+                Jte[i] += partial_Jte[w][i];
+                for( size_t j = i; j < n; j++ )
+                {
+                    jtj[i * n + j] += partial_JtJ[w][i * n + j];
+                }
+            }
+        }
+    }
+
+    // Mirror the upper triangle
+    ValueT* jtj = JtJ.data();
+    for( size_t i = 0; i < n; i++ )
+    {
+        for( size_t j = i + 1; j < n; j++ )
+        {
+            jtj[j * n + i] = jtj[i * n + j];
+        }
+    }
+    return outcome::ok();
+}
+
+} // End of tmns::math::linalg namespace
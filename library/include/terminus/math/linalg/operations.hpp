@@ -54,53 +54,31 @@ template <typename MatrixT>
 size_t nullity( const Matrix_Base<MatrixT>& A,
                 typename MatrixT::value_type thresh = -1 )
 {
-    using value_type = typename MatrixT::value_type;
-    MatrixN<value_type> U, V;
-    VectorN<value_type> S;
-
-    auto res = complete_svd( A.impl(), U, S, V );
-    V = transpose( V );
-    return nullity( A, U, S, V, thresh );
+    auto svd_res = compute_svd( A );
+    if( svd_res.has_error() )
+    {
+        return 0;
+    }
+    return svd_res.value().nullity( thresh );
 }
 
 /**
  * Solve for the nullspace of a Matrix A. If Ax = [0], the nullspace is an x that is not zero.
+ *
+ * Returns the basis vectors as columns, or a 0 x 0 matrix if the nullspace is trivial.
  */
 template <typename MatrixT>
 Result<MatrixN<typename MatrixT::value_type>> nullspace( const Matrix_Base<MatrixT>&  A,
                                                          typename MatrixT::value_type thresh = -1 )
 {
-    typedef typename MatrixT::value_type value_type;
-    MatrixN<value_type> U, V;
-    VectorN<value_type> S;
-    auto svd_res = complete_svd( A.impl(), U, S, V );
-
-    std::cout << "A: " << A.to_log_string() << std::endl;
-    std::cout << "U: " << U.to_log_string() << std::endl;
-    std::cout << "S: " << S.to_log_string() << std::endl;
-    std::cout << "V: " << V.to_log_string() << std::endl;
-    V = transpose(V);
+    using value_type = typename MatrixT::value_type;
 
-    // Nullity must be greater than 0
-    size_t nty = nullity( A.impl(), U, S, V, thresh );
-    if ( nty == 0 )
+    auto svd_res = compute_svd( A );
+    if( svd_res.has_error() )
     {
-        return MatrixN<value_type>( 0, 0 );
+        return svd_res.error();
     }
-
-    Matrix<value_type> nullsp(A.impl().cols(), nty );
-    value_type th = ( thresh >= 0. ? thresh : detail::calc_threshold(A, S) );
-    size_t nn = 0;
-    for ( size_t j = 0; j < A.impl().cols(); j++ ) {
-      if ( j < S.size() )
-        if ( S[j] > th )
-          continue;
-      for ( size_t jj = 0; jj < A.impl().cols(); jj++ )
-        nullsp(jj,nn) = V[jj][j];
-      nn++;
-    }
-    return nullsp;
-  }
-
+    return outcome::ok<MatrixN<value_type>>( svd_res.value().nullspace( thresh ) );
+}
 
 } // End of tmns::math::linalg namespace
\ No newline at end of file
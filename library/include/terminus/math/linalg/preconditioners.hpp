@@ -0,0 +1,292 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    preconditioners.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace tmns::math::linalg {
+
+/**
+ * A preconditioner M ~ A^-1 which computes z = M*r.  z is pre-sized by the solver.
+ */
+template <typename PreconditionerT,
+          typename ValueT>
+concept Preconditioner = requires( const PreconditionerT& pre,
+                                   const VectorN<ValueT>& r,
+                                   VectorN<ValueT>&       z )
+{
+    pre.apply( r, z );
+};
+
+/**
+ * No-op preconditioner.  Used as the default by the Krylov solvers.
+ */
+class Identity_Preconditioner
+{
+    public:
+
+        /**
+         * z = r
+         */
+        template <typename ValueT>
+        void apply( const VectorN<ValueT>& r,
+                    VectorN<ValueT>&       z ) const
+        {
+            std::copy( r.begin(), r.end(), z.begin() );
+        }
+
+}; // End of Identity_Preconditioner class
+
+/**
+ * Diagonal (Jacobi) preconditioner, z_i = r_i / A_ii.
+ *
+ * Only needs the diagonal of A, so it also works with operators which never form A.
+ */
+template <typename ValueT>
+class Jacobi_Preconditioner
+{
+    public:
+
+        /**
+         * Default Constructor.  Behaves like the identity until compute() is called.
+         */
+        Jacobi_Preconditioner() = default;
+
+        /**
+         * Build from the diagonal of A.  Zero entries are treated as one.
+         */
+        explicit Jacobi_Preconditioner( const VectorN<ValueT>& diagonal )
+        {
+            compute( diagonal );
+        }
+
+        /**
+         * Build from the diagonal of A.  Zero entries are treated as one.
+         */
+        void compute( const VectorN<ValueT>& diagonal )
+        {
+            m_inv_diag.data().resize( diagonal.size() );
+            for( size_t i = 0; i < diagonal.size(); i++ )
+            {
+                m_inv_diag[i] = ( diagonal[i] == ValueT( 0 ) ) ? ValueT( 1 ) : ValueT( 1 ) / diagonal[i];
+            }
+        }
+
+        /**
+         * Build from the diagonal of a dense matrix
+         */
+        void compute( const MatrixN<ValueT>& A )
+        {
+            VectorN<ValueT> diagonal( std::min( A.rows(), A.cols() ) );
+            for( size_t i = 0; i < diagonal.size(); i++ )
+            {
+                diagonal[i] = A( i, i );
+            }
+            compute( diagonal );
+        }
+
+        /**
+         * z = D^-1 r
+         */
+        void apply( const VectorN<ValueT>& r,
+                    VectorN<ValueT>&       z ) const
+        {
+            if( m_inv_diag.size() != r.size() )
+            {
+                std::copy( r.begin(), r.end(), z.begin() );
+                return;
+            }
+            for( size_t i = 0; i < r.size(); i++ )
+            {
+                z[i] = m_inv_diag[i] * r[i];
+            }
+        }
+
+    private:
+
+        /// @brief Inverted diagonal
+        VectorN<ValueT> m_inv_diag;
+
+}; // End of Jacobi_Preconditioner class
+
+/**
+ * Zero fill-in incomplete Cholesky preconditioner, IC(0).
+ *
+ * The factor L keeps the sparsity pattern of the lower triangle of A, so A need not be
+ * dense in practice; only its nonzero entries are stored.  z = (L L^T)^-1 r is applied with
+ * one forward and one backward sweep.
+ */
+template <typename ValueT>
+class Incomplete_Cholesky_Preconditioner
+{
+    public:
+
+        /**
+         * Default Constructor.  Behaves like the identity until compute() is called.
+         */
+        Incomplete_Cholesky_Preconditioner() = default;
+
+        /**
+         * Factor the nonzero pattern of A.  A must be square and symmetric; only its lower
+         * triangle is read.  The optional shift is added to the diagonal first, which is the
+         * usual remedy when the plain factorization breaks down.
+         */
+        Result<void> compute( const MatrixN<ValueT>& A,
+                              ValueT                 diagonal_shift = 0 )
+        {
+            const size_t n = A.rows();
+            if( A.cols() != n )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Incomplete Cholesky requires a square matrix. Actual: " +
+                                      std::to_string( A.rows() ) + " x " + std::to_string( A.cols() ) );
+            }
+
+            // Gather the strictly-lower pattern in compressed-row form
+            m_row_start.assign( n + 1, 0 );
+            m_col_index.clear();
+            m_values.clear();
+            for( size_t r = 0; r < n; r++ )
+            {
+                for( size_t c = 0; c < r; c++ )
+                {
+                    if( A( r, c ) != ValueT( 0 ) )
+                    {
+                        m_col_index.push_back( c );
+                        m_values.push_back( A( r, c ) );
+                    }
+                }
+                m_row_start[r+1] = m_col_index.size();
+            }
+            m_diag.data().resize( n );
+
+            // Row-by-row factorization restricted to the pattern
+            for( size_t i = 0; i < n; i++ )
+            {
+                for( size_t e = m_row_start[i]; e < m_row_start[i+1]; e++ )
+                {
+                    const size_t k = m_col_index[e];
+                    m_values[e]    = ( m_values[e] - sparse_dot( i, k, k ) ) / m_diag[k];
+                }
+
+                const ValueT d = A( i, i ) + diagonal_shift - sparse_dot( i, i, i );
+                if( !( d > ValueT( 0 ) ) )
+                {
+                    m_diag.data().clear();
+                    return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                          "Incomplete Cholesky broke down at row " + std::to_string( i ) +
+                                          ". Try a positive diagonal shift." );
+                }
+                m_diag[i] = std::sqrt( d );
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * z = (L L^T)^-1 r
+         */
+        void apply( const VectorN<ValueT>& r,
+                    VectorN<ValueT>&       z ) const
+        {
+            const size_t n = m_diag.size();
+            if( n != r.size() )
+            {
+                std::copy( r.begin(), r.end(), z.begin() );
+                return;
+            }
+
+            // Forward:  L y = r
+            for( size_t i = 0; i < n; i++ )
+            {
+                ValueT s = r[i];
+                for( size_t e = m_row_start[i]; e < m_row_start[i+1]; e++ )
+                {
+                    s -= m_values[e] * z[m_col_index[e]];
+                }
+                z[i] = s / m_diag[i];
+            }
+
+            // Backward:  L^T z = y, walking the rows of L as columns of L^T
+            for( size_t i = n; i-- > 0; )
+            {
+                z[i] /= m_diag[i];
+                const ValueT zi = z[i];
+                for( size_t e = m_row_start[i]; e < m_row_start[i+1]; e++ )
+                {
+                    z[m_col_index[e]] -= m_values[e] * zi;
+                }
+            }
+        }
+
+    private:
+
+        /**
+         * Sum of L(a,j) * L(b,j) over the shared pattern with j < limit
+         */
+        ValueT sparse_dot( size_t a,
+                           size_t b,
+                           size_t limit ) const
+        {
+            ValueT s = 0;
+            size_t ea = m_row_start[a];
+            size_t eb = m_row_start[b];
+            while( ea < m_row_start[a+1] && eb < m_row_start[b+1] )
+            {
+                const size_t ca = m_col_index[ea];
+                const size_t cb = m_col_index[eb];
+                if( ca >= limit || cb >= limit )
+                {
+                    break;
+                }
+                if( ca == cb )
+                {
+                    s += m_values[ea++] * m_values[eb++];
+                }
+                else if( ca < cb )
+                {
+                    ea++;
+                }
+                else
+                {
+                    eb++;
+                }
+            }
+            return s;
+        }
+
+        /// @brief Compressed-row start offsets of the strictly-lower factor
+        std::vector<size_t> m_row_start;
+
+        /// @brief Column of each stored factor entry
+        std::vector<size_t> m_col_index;
+
+        /// @brief Strictly-lower factor entries
+        std::vector<ValueT> m_values;
+
+        /// @brief Factor diagonal
+        VectorN<ValueT> m_diag;
+
+}; // End of Incomplete_Cholesky_Preconditioner class
+
+} // End of tmns::math::linalg namespace
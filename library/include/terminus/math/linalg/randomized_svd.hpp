@@ -0,0 +1,282 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    randomized_svd.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/workspace_solvers.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/parallel_for.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace tmns::math::linalg {
+
+/**
+ * Controls for randomized_svd()
+ */
+struct Randomized_SVD_Options
+{
+    /// @brief Extra sketch columns beyond the requested rank
+    size_t oversampling { 10 };
+
+    /// @brief Subspace (power) iterations.  Raise for slowly decaying spectra.
+    size_t power_iterations { 2 };
+
+    /// @brief Seed for the Gaussian test matrix.  The same seed always gives the same result.
+    uint64_t seed { 42 };
+
+    /// @brief Number of worker threads for the sketch products.  Zero uses the hardware concurrency.
+    size_t num_threads { 0 };
+}; // End of Randomized_SVD_Options struct
+
+namespace detail {
+
+/**
+ * Yt = ( A * Xt^T )^T, i.e. each row of Yt is A applied to the matching row of Xt.
+ * Parallel over the rows of A.
+ */
+template <typename ValueT>
+void sketch_rows( const MatrixN<ValueT>& A,
+                  const MatrixN<ValueT>& Xt,
+                  MatrixN<ValueT>&       Yt,
+                  size_t                 num_threads )
+{
+    const size_t m = A.rows();
+    const size_t n = A.cols();
+    const size_t l = Xt.rows();
+    Yt.set_size( l, m );
+
+    const ValueT* a  = A.data();
+    const ValueT* xt = Xt.data();
+    ValueT*       yt = Yt.data();
+    parallel_for( m, num_threads, 64, [&]( size_t begin, size_t end, size_t )
+    {
+        for( size_t i = begin; i < end; i++ )
+        {
+            const ValueT* a_row = a + i * n;
+            for( size_t c = 0; c < l; c++ )
+            {
+                const ValueT* x_row = xt + c * n;
+                ValueT s = 0;
+                for( size_t j = 0; j < n; j++ )
+                {
+                    s += a_row[j] * x_row[j];
+                }
+                yt[c * m + i] = s;
+            }
+        }
+    });
+}
+
+/**
+ * B = Qt * A.  Parallel over blocks of columns of A so workers never share output.
+ */
+template <typename ValueT>
+void sketch_cols( const MatrixN<ValueT>& A,
+                  const MatrixN<ValueT>& Qt,
+                  MatrixN<ValueT>&       B,
+                  size_t                 num_threads )
+{
+    const size_t m = A.rows();
+    const size_t n = A.cols();
+    const size_t l = Qt.rows();
+    B.set_size( l, n );
+    std::fill( B.data(), B.data() + l * n, ValueT( 0 ) );
+
+    const ValueT* a  = A.data();
+    const ValueT* qt = Qt.data();
+    ValueT*       b  = B.data();
+    parallel_for( n, num_threads, 256, [&]( size_t begin, size_t end, size_t )
+    {
+        for( size_t i = 0; i < m; i++ )
+        {
+            const ValueT* a_row = a + i * n;
+            for( size_t c = 0; c < l; c++ )
+            {
+                const ValueT q     = qt[c * m + i];
+                ValueT*      b_row = b + c * n;
+                for( size_t j = begin; j < end; j++ )
+                {
+                    b_row[j] += q * a_row[j];
+                }
+            }
+        }
+    });
+}
+
+/**
+ * Orthonormalize the rows of Qt in place with twice-applied modified Gram-Schmidt.
+ * Rows which are numerically dependent on earlier rows are set to zero.
+ */
+template <typename ValueT>
+void orthonormalize_rows( MatrixN<ValueT>& Qt )
+{
+    const size_t l   = Qt.rows();
+    const size_t len = Qt.cols();
+    ValueT*      q   = Qt.data();
+
+    for( size_t c = 0; c < l; c++ )
+    {
+        ValueT* row = q + c * len;
+        ValueT  original = 0;
+        for( size_t i = 0; i < len; i++ )
+        {
+            original += row[i] * row[i];
+        }
+        original = std::sqrt( original );
+
+        for( int pass = 0; pass < 2; pass++ )
+        {
+            for( size_t p = 0; p < c; p++ )
+            {
+                const ValueT* prev = q + p * len;
+                ValueT d = 0;
+                for( size_t i = 0; i < len; i++ )
+                {
+                    d += prev[i] * row[i];
+                }
+                for( size_t i = 0; i < len; i++ )
+                {
+                    row[i] -= d * prev[i];
+                }
+            }
+        }
+
+        ValueT norm = 0;
+        for( size_t i = 0; i < len; i++ )
+        {
+            norm += row[i] * row[i];
+        }
+        norm = std::sqrt( norm );
+
+        const ValueT scale = ( norm > original * std::numeric_limits<ValueT>::epsilon() * ValueT( 100 ) && norm > 0 )
+                             ? ValueT( 1 ) / norm : ValueT( 0 );
+        for( size_t i = 0; i < len; i++ )
+        {
+            row[i] *= scale;
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Compute the k largest singular triplets of A with a randomized range finder
+ * (Halko, Martinsson & Tropp).
+ *
+ * A Gaussian sketch of k + oversampling columns captures the dominant range of A, a few
+ * power iterations sharpen it, and the small projected matrix is decomposed exactly.  The
+ * cost is O(m n k) rather than the O(m n min(m,n)) of a full decomposition.  The products
+ * with A are split across threads; results do not depend on the thread count.
+ *
+ * @param A Input matrix (m x n)
+ * @param k Number of singular triplets, 1 <= k <= min(m,n)
+ * @param U Left singular vectors (m x k)
+ * @param S Singular values, descending (k)
+ * @param V Right singular vectors (n x k)
+ *
+ * Only float and double are supported.
+ */
+template <typename ValueT>
+Result<void> randomized_svd( const MatrixN<ValueT>&        A,
+                             size_t                        k,
+                             MatrixN<ValueT>&              U,
+                             VectorN<ValueT>&              S,
+                             MatrixN<ValueT>&              V,
+                             const Randomized_SVD_Options& options = Randomized_SVD_Options() )
+{
+    const size_t m = A.rows();
+    const size_t n = A.cols();
+    const size_t min_dim = std::min( m, n );
+    if( k == 0 || k > min_dim )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Requested rank " + std::to_string( k ) + " is not in [1, " +
+                              std::to_string( min_dim ) + "]" );
+    }
+    const size_t l = std::min( k + options.oversampling, min_dim );
+
+    // Gaussian test matrix, generated serially so the result is reproducible
+    MatrixN<ValueT> omega_t( l, n );
+    {
+        std::mt19937_64 rng( options.seed );
+        std::normal_distribution<ValueT> dist( ValueT( 0 ), ValueT( 1 ) );
+        std::generate( omega_t.data(), omega_t.data() + l * n, [&](){ return dist( rng ); } );
+    }
+
+    // Range finder with power iterations
+    MatrixN<ValueT> Qt, Zt;
+    detail::sketch_rows( A, omega_t, Qt, options.num_threads );
+    detail::orthonormalize_rows( Qt );
+    for( size_t iter = 0; iter < options.power_iterations; iter++ )
+    {
+        detail::sketch_cols( A, Qt, Zt, options.num_threads );
+        detail::orthonormalize_rows( Zt );
+        detail::sketch_rows( A, Zt, Qt, options.num_threads );
+        detail::orthonormalize_rows( Qt );
+    }
+
+    // Project and decompose the small l x n matrix
+    MatrixN<ValueT> B;
+    detail::sketch_cols( A, Qt, B, options.num_threads );
+
+    SVD_Solver<ValueT> solver( l, n );
+    auto res = solver.factor( B );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+
+    VectorN<ValueT> S_full;
+    MatrixN<ValueT> Ub, Vb;
+    solver.singular_values( S_full );
+    solver.matrix_u( Ub );
+    solver.matrix_v( Vb );
+
+    // Lift back:  U = Q * Ub,  truncated to k
+    S.data().assign( S_full.begin(), S_full.begin() + k );
+    U.set_size( m, k );
+    V.set_size( n, k );
+    for( size_t i = 0; i < m; i++ )
+    {
+        for( size_t r = 0; r < k; r++ )
+        {
+            ValueT s = 0;
+            for( size_t c = 0; c < l; c++ )
+            {
+                s += Qt( c, i ) * Ub( c, r );
+            }
+            U( i, r ) = s;
+        }
+    }
+    for( size_t j = 0; j < n; j++ )
+    {
+        for( size_t r = 0; r < k; r++ )
+        {
+            V( j, r ) = Vb( j, r );
+        }
+    }
+    return outcome::ok();
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,520 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    recursive_least_squares.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/triangular_solve.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <string>
+
+namespace tmns::math::linalg {
+
+/**
+ * Controls for Recursive_Least_Squares
+ */
+struct Recursive_Least_Squares_Options
+{
+    /// @brief Exponential forgetting factor in (0,1].  Each new row scales the weight of all older data by this.
+    double forgetting_factor { 1 };
+
+    /// @brief Number of most recent rows kept in the fit.  Zero keeps every row.
+    size_t window_size { 0 };
+
+    /// @brief Ridge prior delta * ||x||^2.  A positive value makes solution() available before n rows arrive.
+    double prior_weight { 0 };
+}; // End of Recursive_Least_Squares_Options struct
+
+/**
+ * Incremental solver for min sum_i w_i ( a_i^T x - b_i )^2 over a stream of rows.
+ *
+ * The upper triangular factor R (R^T R = A^T W A) and z = Q^T b are kept instead of the
+ * rows themselves.  Each new row is folded into R with n Givens rotations in O(n^2), older
+ * rows can be discounted with exponential forgetting, and with a finite window the oldest
+ * row is removed again with a LINPACK-style Cholesky downdate.  solution() is a single
+ * O(n^2) back substitution.  After construction no call allocates.
+ *
+ * Options are checked by check_options().  Prefer create(), which reports invalid options.
+ * A solver constructed directly with invalid options fails every add_observation() and
+ * solution() call with the same error.
+ */
+template <typename ValueT>
+class Recursive_Least_Squares
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Check that the forgetting factor lies in (0,1] and the prior weight is non-negative
+         */
+        static Result<void> check_options( const Recursive_Least_Squares_Options& options )
+        {
+            if( !( options.forgetting_factor > 0 && options.forgetting_factor <= 1 ) )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Forgetting factor must be in (0,1], got "
+                                      + std::to_string( options.forgetting_factor ) );
+            }
+            if( !( options.prior_weight >= 0 ) )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Prior weight must be non-negative, got "
+                                      + std::to_string( options.prior_weight ) );
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Construct a solver, rejecting invalid options
+         *
+         * @param num_parameters Number of unknowns n
+         * @param options Forgetting, window and prior settings
+         */
+        static Result<Recursive_Least_Squares> create( size_t                                 num_parameters,
+                                                       const Recursive_Least_Squares_Options& options = Recursive_Least_Squares_Options() )
+        {
+            auto res = check_options( options );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<Recursive_Least_Squares>( num_parameters, options );
+        }
+
+        /**
+         * Constructor
+         *
+         * @param num_parameters Number of unknowns n
+         * @param options Forgetting, window and prior settings
+         */
+        explicit Recursive_Least_Squares( size_t                                 num_parameters,
+                                          const Recursive_Least_Squares_Options& options = Recursive_Least_Squares_Options() )
+          : m_options( options ),
+            m_n( num_parameters ),
+            m_R( num_parameters, num_parameters ),
+            m_z( num_parameters ),
+            m_work( num_parameters ),
+            m_cos( num_parameters ),
+            m_sin( num_parameters ),
+            m_window_rows( options.window_size, num_parameters ),
+            m_window_rhs( options.window_size ),
+            m_window_weights( options.window_size ),
+            m_valid_options( !check_options( options ).has_error() )
+        {
+            if( m_valid_options )
+            {
+                m_sqrt_forget  = std::sqrt( ValueT( m_options.forgetting_factor ) );
+                m_window_decay = std::pow( ValueT( m_options.forgetting_factor ),
+                                           ValueT( m_options.window_size ) );
+                m_prior_weight = ValueT( m_options.prior_weight );
+            }
+            reset();
+        }
+
+        /**
+         * Discard all observations and return to the prior
+         */
+        void reset()
+        {
+            std::fill( m_R.data(), m_R.data() + m_n * m_n, ValueT( 0 ) );
+            std::fill( m_z.begin(), m_z.end(), ValueT( 0 ) );
+            m_prior_scale = m_prior_weight;
+            const ValueT diag = std::sqrt( m_prior_scale );
+            for( size_t i = 0; i < m_n; i++ )
+            {
+                m_R( i, i ) = diag;
+            }
+            m_rss        = 0;
+            m_count      = 0;
+            m_window_pos = 0;
+        }
+
+        /**
+         * Add one observation a^T x = b with the given weight.
+         */
+        Result<void> add_observation( std::span<const ValueT> row,
+                                      ValueT                  rhs,
+                                      ValueT                  weight = ValueT( 1 ) )
+        {
+            if( !m_valid_options )
+            {
+                return check_options( m_options );
+            }
+            if( row.size() != m_n )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Observation has " + std::to_string( row.size() )
+                                      + " entries, expected " + std::to_string( m_n ) );
+            }
+            if( !( weight >= 0 ) )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Observation weight must be non-negative" );
+            }
+
+            apply_forgetting();
+
+            const size_t window = m_options.window_size;
+            if( window > 0 )
+            {
+                // Remove the row falling out of the window, then overwrite its slot
+                if( m_count >= window )
+                {
+                    const ValueT* old_row = &m_window_rows( m_window_pos, 0 );
+                    const ValueT  scale   = std::sqrt( m_window_weights[m_window_pos] * m_window_decay );
+                    if( !downdate( old_row, m_window_rhs[m_window_pos], scale ) )
+                    {
+                        rebuild_from_window();
+                    }
+                }
+                std::copy( row.begin(), row.end(), &m_window_rows( m_window_pos, 0 ) );
+                m_window_rhs[m_window_pos]     = rhs;
+                m_window_weights[m_window_pos] = weight;
+                m_window_pos = ( m_window_pos + 1 ) % window;
+            }
+
+            update( row.data(), rhs, std::sqrt( weight ) );
+            m_count++;
+            return outcome::ok();
+        }
+
+        /**
+         * Add one observation a^T x = b with the given weight.
+         */
+        Result<void> add_observation( const VectorN<ValueT>& row,
+                                      ValueT                 rhs,
+                                      ValueT                 weight = ValueT( 1 ) )
+        {
+            return add_observation( std::span<const ValueT>( row.data() ), rhs, weight );
+        }
+
+        /**
+         * Add a block of observations A x = b, one row at a time.  Forgetting and the window
+         * count each row as a separate observation.
+         */
+        Result<void> add_observations( const MatrixN<ValueT>& A,
+                                       const VectorN<ValueT>& b )
+        {
+            if( A.rows() != b.size() || A.cols() != m_n )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Observation block is " + std::to_string( A.rows() ) + " x "
+                                      + std::to_string( A.cols() ) + " with " + std::to_string( b.size() )
+                                      + " right-hand sides, expected n = " + std::to_string( m_n ) );
+            }
+            for( size_t r = 0; r < A.rows(); r++ )
+            {
+                auto res = add_observation( std::span<const ValueT>( A.data() + r * m_n, m_n ), b[r] );
+                if( res.has_error() )
+                {
+                    return res.error();
+                }
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Solve R x = z into an existing vector.  Fails until R has full rank.
+         */
+        Result<void> solution( VectorN<ValueT>& x ) const
+        {
+            if( !m_valid_options )
+            {
+                return check_options( m_options );
+            }
+            for( size_t i = 0; i < m_n; i++ )
+            {
+                if( m_R( i, i ) == ValueT( 0 ) )
+                {
+                    return outcome::fail( error::Error_Code::UNINITIALIZED,
+                                          "Recursive_Least_Squares is rank deficient after "
+                                          + std::to_string( m_count ) + " observations" );
+                }
+            }
+            if( x.size() != m_n )
+            {
+                x.data().resize( m_n );
+            }
+            std::copy( m_z.begin(), m_z.end(), x.begin() );
+            trsv( Triangle::UPPER, Transpose::NO_TRANSPOSE, Diagonal::NON_UNIT,
+                  m_n, m_R.data(), m_n, x.data().data() );
+            return outcome::ok();
+        }
+
+        /**
+         * Solve R x = z, returning a new vector
+         */
+        Result<VectorN<ValueT>> solution() const
+        {
+            VectorN<ValueT> x( m_n );
+            auto res = solution( x );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<VectorN<ValueT>>( std::move( x ) );
+        }
+
+        /**
+         * Weighted residual sum of squares of the current fit, excluding the prior
+         */
+        ValueT residual_sum_of_squares() const
+        {
+            return m_rss;
+        }
+
+        /**
+         * Upper triangular factor with R^T R = A^T W A (+ prior)
+         */
+        const MatrixN<ValueT>& matrix_r() const
+        {
+            return m_R;
+        }
+
+        /**
+         * Number of observations currently in the fit
+         */
+        size_t observation_count() const
+        {
+            return m_options.window_size > 0 ? std::min( m_count, m_options.window_size ) : m_count;
+        }
+
+        /**
+         * Number of unknowns
+         */
+        size_t num_parameters() const
+        {
+            return m_n;
+        }
+
+        /**
+         * Get the configured options
+         */
+        const Recursive_Least_Squares_Options& options() const
+        {
+            return m_options;
+        }
+
+    private:
+
+        /**
+         * Scale all existing information by the forgetting factor
+         */
+        void apply_forgetting()
+        {
+            if( m_options.forgetting_factor == 1 )
+            {
+                return;
+            }
+            ValueT* r = m_R.data();
+            for( size_t i = 0; i < m_n * m_n; i++ )
+            {
+                r[i] *= m_sqrt_forget;
+            }
+            for( auto& v : m_z )
+            {
+                v *= m_sqrt_forget;
+            }
+            m_rss         *= m_sqrt_forget * m_sqrt_forget;
+            m_prior_scale *= m_sqrt_forget * m_sqrt_forget;
+        }
+
+        /**
+         * Fold scale * [row, rhs] into R and z with Givens rotations (LINPACK dchud)
+         */
+        void update( const ValueT* row,
+                     ValueT        rhs,
+                     ValueT        scale )
+        {
+            ValueT* x = m_work.data().data();
+            for( size_t k = 0; k < m_n; k++ )
+            {
+                x[k] = scale * row[k];
+            }
+            ValueT y = scale * rhs;
+
+            for( size_t j = 0; j < m_n; j++ )
+            {
+                if( x[j] == ValueT( 0 ) )
+                {
+                    continue;
+                }
+                ValueT*      r_row = &m_R( j, 0 );
+                const ValueT r     = std::hypot( r_row[j], x[j] );
+                const ValueT c     = r_row[j] / r;
+                const ValueT s     = x[j] / r;
+                r_row[j] = r;
+                for( size_t k = j + 1; k < m_n; k++ )
+                {
+                    const ValueT t = c * r_row[k] + s * x[k];
+                    x[k]     = c * x[k] - s * r_row[k];
+                    r_row[k] = t;
+                }
+                const ValueT t = c * m_z[j] + s * y;
+                y      = c * y - s * m_z[j];
+                m_z[j] = t;
+            }
+            m_rss += y * y;
+        }
+
+        /**
+         * Remove scale * [row, rhs] from R and z (LINPACK dchdd).  Returns false, leaving the
+         * state untouched, if the downdate would make R^T R indefinite.
+         */
+        bool downdate( const ValueT* row,
+                       ValueT        rhs,
+                       ValueT        scale )
+        {
+            // Solve R^T p = x
+            ValueT* p = m_work.data().data();
+            for( size_t k = 0; k < m_n; k++ )
+            {
+                p[k] = scale * row[k];
+            }
+            trsv( Triangle::UPPER, Transpose::TRANSPOSE, Diagonal::NON_UNIT, m_n, m_R.data(), m_n, p );
+
+            ValueT norm2 = 0;
+            for( size_t k = 0; k < m_n; k++ )
+            {
+                norm2 += p[k] * p[k];
+            }
+            if( !( norm2 < ValueT( 1 ) ) )
+            {
+                return false;
+            }
+
+            // Rotations which zero p against alpha, generated from the bottom up
+            ValueT alpha = std::sqrt( ValueT( 1 ) - norm2 );
+            for( size_t i = m_n; i-- > 0; )
+            {
+                const ValueT s = alpha + std::abs( p[i] );
+                const ValueT a = alpha / s;
+                const ValueT b = p[i] / s;
+                const ValueT nrm = std::sqrt( a * a + b * b );
+                m_cos[i] = a / nrm;
+                m_sin[i] = b / nrm;
+                alpha    = s * nrm;
+            }
+
+            for( size_t j = 0; j < m_n; j++ )
+            {
+                ValueT xx = 0;
+                for( size_t i = j + 1; i-- > 0; )
+                {
+                    const ValueT t = m_cos[i] * xx + m_sin[i] * m_R( i, j );
+                    m_R( i, j ) = m_cos[i] * m_R( i, j ) - m_sin[i] * xx;
+                    xx = t;
+                }
+            }
+
+            ValueT zeta = scale * rhs;
+            for( size_t i = 0; i < m_n; i++ )
+            {
+                m_z[i] = ( m_z[i] - m_sin[i] * zeta ) / m_cos[i];
+                zeta   = m_cos[i] * zeta - m_sin[i] * m_z[i];
+            }
+            m_rss = std::max( ValueT( 0 ), m_rss - zeta * zeta );
+            return true;
+        }
+
+        /**
+         * Recover from a failed downdate by refactoring the rows still in the window.  Only
+         * reached when rounding has made the oldest row look larger than the data itself.
+         */
+        void rebuild_from_window()
+        {
+            const size_t window = m_options.window_size;
+            std::fill( m_R.data(), m_R.data() + m_n * m_n, ValueT( 0 ) );
+            std::fill( m_z.begin(), m_z.end(), ValueT( 0 ) );
+            const ValueT diag = std::sqrt( m_prior_scale );
+            for( size_t i = 0; i < m_n; i++ )
+            {
+                m_R( i, i ) = diag;
+            }
+            m_rss = 0;
+
+            // Oldest row first, skipping the one being dropped.  Forgetting has already been
+            // applied for the incoming row, so the newest kept row has aged one step.
+            const ValueT forget = ValueT( m_options.forgetting_factor );
+            ValueT age_weight   = m_window_decay;
+            for( size_t k = 1; k < window; k++ )
+            {
+                age_weight /= forget;
+                const size_t slot = ( m_window_pos + k ) % window;
+                update( &m_window_rows( slot, 0 ),
+                        m_window_rhs[slot],
+                        std::sqrt( m_window_weights[slot] * age_weight ) );
+            }
+        }
+
+        /// @brief Configuration
+        Recursive_Least_Squares_Options m_options;
+
+        /// @brief Number of unknowns
+        size_t m_n;
+
+        /// @brief Upper triangular factor
+        MatrixN<ValueT> m_R;
+
+        /// @brief Rotated right-hand side Q^T b
+        VectorN<ValueT> m_z;
+
+        /// @brief Scratch row for updates and downdates
+        VectorN<ValueT> m_work;
+
+        /// @brief Downdate rotation cosines and sines
+        VectorN<ValueT> m_cos;
+        VectorN<ValueT> m_sin;
+
+        /// @brief Rows, right-hand sides and weights inside the sliding window (ring buffer)
+        MatrixN<ValueT> m_window_rows;
+        VectorN<ValueT> m_window_rhs;
+        VectorN<ValueT> m_window_weights;
+
+        /// @brief Next ring buffer slot to write
+        size_t m_window_pos { 0 };
+
+        /// @brief Observations added since the last reset()
+        size_t m_count { 0 };
+
+        /// @brief Weighted residual sum of squares
+        ValueT m_rss { 0 };
+
+        /// @brief Current weight of the ridge prior after forgetting
+        ValueT m_prior_scale { 0 };
+
+        /// @brief sqrt( forgetting factor )
+        ValueT m_sqrt_forget { 1 };
+
+        /// @brief forgetting factor ^ window size, the age weight of a row leaving the window
+        ValueT m_window_decay { 1 };
+
+        /// @brief Ridge prior weight, zero when the options are invalid
+        ValueT m_prior_weight { 0 };
+
+        /// @brief Set when m_options passed check_options()
+        bool m_valid_options { false };
+
+}; // End of Recursive_Least_Squares class
+
+} // End of tmns::math::linalg namespace
@@ -20,6 +20,11 @@
 #include <terminus/math/types/type_deduction.hpp>
 #include <terminus/math/vector/vectorn.hpp>
 
+// C++ Libraries
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 namespace tmns::math::linalg {
 
 Result<VectorN<double>> solve_symmetric( const MatrixN<double>& A,
@@ -45,17 +50,109 @@ Result<VectorN<typename Promote_Type<typename AMatrixT::value_type,
 }
 
 /**
- * x = solve(A,b) - Computes the solution to a real system of linear equations:
+ * x = solve(A,b) - Computes the minimum-norm solution to a real linear least squares problem:
  *
  * A*x=b
  *
- * Based on the LAPACK GESV routines, this solution is computed using LU decomposition and
- * back/forward substitution.
- *
- * Computes the minimum-norm solution to a real linear least squares problem.
+ * The solution is applied from the SVD as V * ( S^-1 .* ( U^T b ) ), discarding singular
+ * values at or below eps, without ever forming the pseudo-inverse.  To solve repeatedly
+ * against the same A, factor once with SVD_Solver and call its solve() per right-hand side.
  */
 Result<VectorN<double>> solve( const MatrixN<double>& mat_A,
                                const VectorN<double>& vec_b,
                                double                 eps = 0.00000001 );
 
+/**
+ * X = solve(A,B) - Minimum-norm least squares solution for every column of B, sharing a
+ * single decomposition of A.
+ */
+Result<MatrixN<double>> solve( const MatrixN<double>& mat_A,
+                               const MatrixN<double>& mat_B,
+                               double                 eps = 0.00000001 );
+
+/**
+ * Controls for solve_mixed_precision()
+ */
+struct Mixed_Precision_Options
+{
+    /// @brief Maximum number of refinement steps before falling back to a double factorization
+    size_t max_iterations { 30 };
+
+    /// @brief Condition estimate above which the float factorization is not trusted
+    double max_condition { 1e6 };
+
+    /// @brief Factor with Cholesky instead of LU.  A must be symmetric positive definite.
+    bool symmetric { false };
+
+    /// @brief Worker threads for the residual products.  Zero uses the hardware concurrency.
+    size_t num_threads { 0 };
+}; // End of Mixed_Precision_Options struct
+
+/**
+ * Diagnostics returned by solve_mixed_precision()
+ */
+struct Mixed_Precision_Info
+{
+    /// @brief Number of refinement steps applied
+    size_t iterations { 0 };
+
+    /// @brief Infinity norm of the final residual b - Ax
+    double residual_norm { 0 };
+
+    /// @brief 1-norm condition estimate of A from the factorization which produced x
+    double condition_estimate { 0 };
+
+    /// @brief Set when the float path was abandoned for a double factorization
+    bool used_fallback { false };
+}; // End of Mixed_Precision_Info struct
+
+/**
+ * Solve Ax=b by factoring A in single precision and refining x in double precision.
+ *
+ * The factorization costs O(n^3) in float, which halves the memory traffic and doubles the
+ * SIMD width compared with double.  Each refinement step then costs O(n^2): the residual
+ * b - Ax is accumulated in extended (long double) precision and the correction is solved
+ * with the float factors.  For well conditioned systems this reaches double accuracy in a
+ * few steps.
+ *
+ * If the float factorization fails, its condition estimate exceeds max_condition, or the
+ * refinement does not converge, A is refactored in double and solved directly.  The info
+ * result reports which path produced x.
+ */
+Result<Mixed_Precision_Info> solve_mixed_precision( const MatrixN<double>&         A,
+                                                    const VectorN<double>&         b,
+                                                    VectorN<double>&               x,
+                                                    const Mixed_Precision_Options& options = Mixed_Precision_Options() );
+
+/**
+ * Mixed precision solve for any matrix and vector types.  The refinement runs in the
+ * promoted value type of A and b, which must be no wider than double.
+ */
+template <typename AMatrixT,
+          typename BVectorT>
+Result<VectorN<typename Promote_Type<typename Promote_Type<typename AMatrixT::value_type,
+                                                           typename BVectorT::value_type>::type,
+                                     double>::type>>
+    solve_mixed_precision( const AMatrixT&                A,
+                           const BVectorT&                b,
+                           const Mixed_Precision_Options& options = Mixed_Precision_Options() )
+{
+    using real_type = typename Promote_Type<typename Promote_Type<typename AMatrixT::value_type,
+                                                                  typename BVectorT::value_type>::type,
+                                            double>::type;
+    static_assert( std::is_same_v<real_type,double>,
+                   "solve_mixed_precision() refines in double precision" );
+
+    MatrixN<double> Abuf = A;
+    VectorN<double> bbuf = b;
+    VectorN<double> x;
+
+    auto res = solve_mixed_precision( Abuf, bbuf, x, options );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<VectorN<double>>( std::move( x ) );
+}
+
 } // End of tmns::math::linalg
\ No newline at end of file
@@ -21,6 +21,11 @@
 // Boost Libraries
 #include <boost/numeric/conversion/cast.hpp>
 
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <utility>
+
 namespace tmns::math::linalg {
 
 namespace detail {
@@ -137,6 +142,242 @@ int rank( const Matrix_Base<MatrixT>&   A,
     return nr;
 }
 
+/**
+ * Cached singular value decomposition A = U * diag(S) * V^T.
+ *
+ * The factors are computed once by compute_svd(), and every derived quantity (rank,
+ * nullity, null space, range, condition number, pseudo-inverse) is answered from them on
+ * demand.  Use this instead of the free rank() / nullity() / nullspace() helpers whenever
+ * more than one of them is needed for the same matrix.
+ *
+ * Thresholds follow the free functions:  a negative value selects the default
+ * 0.5 * sqrt( m + n + 1 ) * S[0] * epsilon.
+ */
+template <typename ValueT>
+class SVD_Result
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor.  Represents an empty (0 x 0) decomposition.
+         */
+        SVD_Result() = default;
+
+        /**
+         * Construct from complete SVD factors.
+         *
+         * @param U Left singular vectors (m x m)
+         * @param S Singular values, descending (min(m,n))
+         * @param V Right singular vectors (n x n), stored as columns
+         */
+        SVD_Result( MatrixN<ValueT> U,
+                    VectorN<ValueT> S,
+                    MatrixN<ValueT> V )
+            : m_U( std::move( U ) ),
+              m_S( std::move( S ) ),
+              m_V( std::move( V ) )
+        {
+        }
+
+        /**
+         * Number of rows of the decomposed matrix
+         */
+        size_t rows() const
+        {
+            return m_U.rows();
+        }
+
+        /**
+         * Number of columns of the decomposed matrix
+         */
+        size_t cols() const
+        {
+            return m_V.rows();
+        }
+
+        /**
+         * Left singular vectors (m x m)
+         */
+        const MatrixN<ValueT>& matrix_u() const
+        {
+            return m_U;
+        }
+
+        /**
+         * Singular values in descending order
+         */
+        const VectorN<ValueT>& singular_values() const
+        {
+            return m_S;
+        }
+
+        /**
+         * Right singular vectors (n x n), stored as columns
+         */
+        const MatrixN<ValueT>& matrix_v() const
+        {
+            return m_V;
+        }
+
+        /**
+         * Default rank threshold for this decomposition
+         */
+        ValueT default_threshold() const
+        {
+            if( m_S.size() == 0 )
+            {
+                return ValueT( 0 );
+            }
+            return ValueT( 0.5 * std::sqrt( double( rows() ) + double( cols() ) + 1. )
+                           * m_S[0]
+                           * std::numeric_limits<ValueT>::epsilon() );
+        }
+
+        /**
+         * Number of singular values above the threshold
+         */
+        size_t rank( ValueT thresh = -1 ) const
+        {
+            const ValueT th = resolve_threshold( thresh );
+            size_t nr = 0;
+            for( size_t j = 0; j < m_S.size(); j++ )
+            {
+                if( m_S[j] > th )
+                {
+                    nr++;
+                }
+            }
+            return nr;
+        }
+
+        /**
+         * Dimension of the null space, cols() - rank()
+         */
+        size_t nullity( ValueT thresh = -1 ) const
+        {
+            return cols() - rank( thresh );
+        }
+
+        /**
+         * Orthonormal basis of the null space as columns (n x nullity).  Returns a 0 x 0
+         * matrix if the null space is trivial.
+         */
+        MatrixN<ValueT> nullspace( ValueT thresh = -1 ) const
+        {
+            const size_t nr  = rank( thresh );
+            const size_t nty = cols() - nr;
+            if( nty == 0 )
+            {
+                return MatrixN<ValueT>( 0, 0 );
+            }
+
+            // Singular values are sorted, so the null vectors are the trailing columns of V
+            MatrixN<ValueT> basis( cols(), nty );
+            for( size_t r = 0; r < cols(); r++ )
+            {
+                for( size_t c = 0; c < nty; c++ )
+                {
+                    basis( r, c ) = m_V( r, nr + c );
+                }
+            }
+            return basis;
+        }
+
+        /**
+         * Orthonormal basis of the range (column space) as columns (m x rank)
+         */
+        MatrixN<ValueT> range( ValueT thresh = -1 ) const
+        {
+            const size_t nr = rank( thresh );
+            MatrixN<ValueT> basis( rows(), nr );
+            for( size_t r = 0; r < rows(); r++ )
+            {
+                for( size_t c = 0; c < nr; c++ )
+                {
+                    basis( r, c ) = m_U( r, c );
+                }
+            }
+            return basis;
+        }
+
+        /**
+         * 2-norm condition number, S[0] / S[min(m,n)-1].  Infinite for singular matrices.
+         */
+        ValueT condition_number() const
+        {
+            if( m_S.size() == 0 )
+            {
+                return ValueT( 0 );
+            }
+            const ValueT smallest = m_S[m_S.size() - 1];
+            if( smallest == ValueT( 0 ) )
+            {
+                return std::numeric_limits<ValueT>::infinity();
+            }
+            return m_S[0] / smallest;
+        }
+
+        /**
+         * Moore-Penrose pseudo-inverse V * diag(1/S) * U^T (n x m), discarding singular
+         * values at or below the threshold.
+         */
+        MatrixN<ValueT> pseudo_inverse( ValueT thresh = -1 ) const
+        {
+            const size_t nr = rank( thresh );
+            MatrixN<ValueT> pinv( cols(), rows() );
+            for( size_t k = 0; k < nr; k++ )
+            {
+                const ValueT inv_s = ValueT( 1 ) / m_S[k];
+                for( size_t r = 0; r < cols(); r++ )
+                {
+                    const ValueT v = m_V( r, k ) * inv_s;
+                    for( size_t c = 0; c < rows(); c++ )
+                    {
+                        pinv( r, c ) += v * m_U( c, k );
+                    }
+                }
+            }
+            return pinv;
+        }
+
+    private:
+
+        ValueT resolve_threshold( ValueT thresh ) const
+        {
+            return thresh >= 0 ? thresh : default_threshold();
+        }
+
+        /// @brief Left singular vectors
+        MatrixN<ValueT> m_U;
+
+        /// @brief Singular values
+        VectorN<ValueT> m_S;
+
+        /// @brief Right singular vectors
+        MatrixN<ValueT> m_V;
+
+}; // End of SVD_Result class
+
+/**
+ * Compute the complete SVD of A once and wrap it for repeated queries.
+ */
+template <typename MatrixT>
+Result<SVD_Result<typename MatrixT::value_type>> compute_svd( const Matrix_Base<MatrixT>& A )
+{
+    using value_type = typename MatrixT::value_type;
+    MatrixN<value_type> U, V;
+    VectorN<value_type> S;
+    auto res = complete_svd( MatrixN<value_type>( A.impl() ), U, S, V );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<SVD_Result<value_type>>( std::move( U ), std::move( S ), std::move( V ) );
+}
+
 /**
  * Solve for the rank of a matrix.
  */
@@ -144,12 +385,12 @@ template <class MatrixT>
 int rank( const Matrix_Base<MatrixT>& A,
           typename MatrixT::value_type thresh = -1 )
 {
-    using value_type = typename MatrixT::value_type;
-    MatrixN<value_type> U, V;
-    VectorN<value_type> S;
-    complete_svd( A.impl(), U, S, V );
-    V = transpose(V);
-    return rank( A, U, S, V, thresh );
+    auto svd_res = compute_svd( A );
+    if( svd_res.has_error() )
+    {
+        return 0;
+    }
+    return static_cast<int>( svd_res.value().rank( thresh ) );
 }
 
 }  // End of tmns::math::linalg
\ No newline at end of file
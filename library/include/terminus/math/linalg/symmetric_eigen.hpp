@@ -0,0 +1,696 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    symmetric_eigen.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <string>
+
+namespace tmns::math::linalg {
+
+/**
+ * Eigen-decomposition of dense symmetric matrices, A = V * diag(d) * V^T.
+ *
+ * Uses Householder reduction to tridiagonal form followed by the implicit QL algorithm
+ * (the EISPACK tred2/tql2 pair).  Eigenvalues are returned in ascending order and the
+ * eigenvectors are the matching columns of V.  Only the lower triangle of A is read.
+ *
+ * The solver keeps its work arrays, so decomposing many matrices of the same size does
+ * not reallocate.
+ */
+template <typename ValueT>
+class Symmetric_Eigen_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor
+         */
+        Symmetric_Eigen_Solver() = default;
+
+        /**
+         * Constructor which preallocates storage for an n x n matrix
+         */
+        explicit Symmetric_Eigen_Solver( size_t n )
+            : m_vectors( n, n ),
+              m_values( n ),
+              m_off_diag( n )
+        {
+        }
+
+        /**
+         * Decompose A.  If compute_vectors is false, only the eigenvalues are produced, which
+         * skips accumulating the orthogonal transforms.
+         */
+        Result<void> compute( const MatrixN<ValueT>& A,
+                              bool                   compute_vectors = true )
+        {
+            const size_t n = A.rows();
+            if( A.cols() != n )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Eigen-decomposition requires a square matrix. Actual: " +
+                                      std::to_string( A.rows() ) + " x " + std::to_string( A.cols() ) );
+            }
+
+            m_vectors.set_size( n, n );
+            if( m_values.size() != n )
+            {
+                m_values.data().resize( n );
+                m_off_diag.data().resize( n );
+            }
+            std::copy( A.data(), A.data() + n * n, m_vectors.data() );
+
+            m_has_vectors = false;
+            m_valid       = false;
+            if( n == 0 )
+            {
+                m_valid = true;
+                return outcome::ok();
+            }
+
+            tridiagonalize( n, compute_vectors );
+            if( !tridiagonal_ql( n, compute_vectors ) )
+            {
+                return outcome::fail( error::Error_Code::UNKNOWN,
+                                      "Implicit QL failed to converge for a " + std::to_string( n ) +
+                                      " x " + std::to_string( n ) + " matrix" );
+            }
+            m_has_vectors = compute_vectors;
+            m_valid       = true;
+            return outcome::ok();
+        }
+
+        /**
+         * Eigenvalues in ascending order
+         */
+        const VectorN<ValueT>& eigenvalues() const
+        {
+            return m_values;
+        }
+
+        /**
+         * Eigenvectors stored as columns, matching eigenvalues().  Only meaningful if
+         * compute() was called with compute_vectors set.
+         */
+        const MatrixN<ValueT>& eigenvectors() const
+        {
+            return m_vectors;
+        }
+
+        /**
+         * Check if a valid decomposition is stored
+         */
+        bool is_computed() const
+        {
+            return m_valid;
+        }
+
+        /**
+         * Check if the stored decomposition includes eigenvectors
+         */
+        bool has_eigenvectors() const
+        {
+            return m_has_vectors;
+        }
+
+    private:
+
+        /**
+         * Householder reduction to symmetric tridiagonal form (tred2).  On exit the diagonal
+         * is in m_values, the sub-diagonal in m_off_diag[1..n-1] and, if requested, the
+         * accumulated transform in m_vectors.
+         */
+        void tridiagonalize( size_t n,
+                             bool   accumulate )
+        {
+            ValueT* V = m_vectors.data();
+            auto&   d = m_values;
+            auto&   e = m_off_diag;
+
+            for( size_t j = 0; j < n; j++ )
+            {
+                d[j] = V[(n-1)*n+j];
+            }
+
+            for( size_t i = n - 1; i > 0; i-- )
+            {
+                ValueT scale = 0;
+                ValueT h     = 0;
+                for( size_t k = 0; k < i; k++ )
+                {
+                    scale += std::fabs( d[k] );
+                }
+
+                if( scale == ValueT( 0 ) )
+                {
+                    e[i] = d[i-1];
+                    for( size_t j = 0; j < i; j++ )
+                    {
+                        d[j]       = V[(i-1)*n+j];
+                        V[i*n+j]   = 0;
+                        V[j*n+i]   = 0;
+                    }
+                }
+                else
+                {
+                    // Generate the Householder vector
+                    for( size_t k = 0; k < i; k++ )
+                    {
+                        d[k] /= scale;
+                        h    += d[k] * d[k];
+                    }
+                    ValueT f = d[i-1];
+                    ValueT g = std::sqrt( h );
+                    if( f > 0 )
+                    {
+                        g = -g;
+                    }
+                    e[i]   = scale * g;
+                    h      = h - f * g;
+                    d[i-1] = f - g;
+                    for( size_t j = 0; j < i; j++ )
+                    {
+                        e[j] = 0;
+                    }
+
+                    // Apply the similarity transform to the remaining columns
+                    for( size_t j = 0; j < i; j++ )
+                    {
+                        f          = d[j];
+                        V[j*n+i]   = f;
+                        g          = e[j] + V[j*n+j] * f;
+                        for( size_t k = j + 1; k + 1 <= i; k++ )
+                        {
+                            g    += V[k*n+j] * d[k];
+                            e[k] += V[k*n+j] * f;
+                        }
+                        e[j] = g;
+                    }
+                    f = 0;
+                    for( size_t j = 0; j < i; j++ )
+                    {
+                        e[j] /= h;
+                        f    += e[j] * d[j];
+                    }
+                    const ValueT hh = f / ( h + h );
+                    for( size_t j = 0; j < i; j++ )
+                    {
+                        e[j] -= hh * d[j];
+                    }
+                    for( size_t j = 0; j < i; j++ )
+                    {
+                        f = d[j];
+                        g = e[j];
+                        for( size_t k = j; k + 1 <= i; k++ )
+                        {
+                            V[k*n+j] -= ( f * e[k] + g * d[k] );
+                        }
+                        d[j]     = V[(i-1)*n+j];
+                        V[i*n+j] = 0;
+                    }
+                }
+                d[i] = h;
+            }
+
+            if( !accumulate )
+            {
+                // The diagonal of the reduced matrix was left on the diagonal of V
+                for( size_t j = 0; j < n; j++ )
+                {
+                    d[j] = V[j*n+j];
+                }
+                e[0] = 0;
+                return;
+            }
+
+            // Accumulate the transforms
+            for( size_t i = 0; i + 1 < n; i++ )
+            {
+                V[(n-1)*n+i] = V[i*n+i];
+                V[i*n+i]     = 1;
+                const ValueT h = d[i+1];
+                if( h != ValueT( 0 ) )
+                {
+                    for( size_t k = 0; k <= i; k++ )
+                    {
+                        d[k] = V[k*n+i+1] / h;
+                    }
+                    for( size_t j = 0; j <= i; j++ )
+                    {
+                        ValueT g = 0;
+                        for( size_t k = 0; k <= i; k++ )
+                        {
+                            g += V[k*n+i+1] * V[k*n+j];
+                        }
+                        for( size_t k = 0; k <= i; k++ )
+                        {
+                            V[k*n+j] -= g * d[k];
+                        }
+                    }
+                }
+                for( size_t k = 0; k <= i; k++ )
+                {
+                    V[k*n+i+1] = 0;
+                }
+            }
+            for( size_t j = 0; j < n; j++ )
+            {
+                d[j]         = V[(n-1)*n+j];
+                V[(n-1)*n+j] = 0;
+            }
+            V[(n-1)*n+n-1] = 1;
+            e[0] = 0;
+        }
+
+        /**
+         * Implicit QL iterations on the tridiagonal matrix (tql2), followed by an ascending
+         * sort.  Returns false if an eigenvalue fails to converge.
+         */
+        bool tridiagonal_ql( size_t n,
+                             bool   accumulate )
+        {
+            ValueT* V = m_vectors.data();
+            auto&   d = m_values;
+            auto&   e = m_off_diag;
+
+            for( size_t i = 1; i < n; i++ )
+            {
+                e[i-1] = e[i];
+            }
+            e[n-1] = 0;
+
+            const ValueT eps = std::numeric_limits<ValueT>::epsilon();
+            const size_t max_iterations = 30 * n;
+            ValueT f    = 0;
+            ValueT tst1 = 0;
+            for( size_t l = 0; l < n; l++ )
+            {
+                // Look for a small sub-diagonal element
+                tst1 = std::max( tst1, std::fabs( d[l] ) + std::fabs( e[l] ) );
+                size_t m = l;
+                while( m + 1 < n && std::fabs( e[m] ) > eps * tst1 )
+                {
+                    m++;
+                }
+
+                if( m > l )
+                {
+                    size_t iter = 0;
+                    do
+                    {
+                        if( ++iter > max_iterations )
+                        {
+                            return false;
+                        }
+
+                        // Compute the implicit shift
+                        ValueT g = d[l];
+                        ValueT p = ( d[l+1] - g ) / ( ValueT( 2 ) * e[l] );
+                        ValueT r = std::hypot( p, ValueT( 1 ) );
+                        if( p < 0 )
+                        {
+                            r = -r;
+                        }
+                        d[l]   = e[l] / ( p + r );
+                        d[l+1] = e[l] * ( p + r );
+                        const ValueT dl1 = d[l+1];
+                        ValueT h = g - d[l];
+                        for( size_t i = l + 2; i < n; i++ )
+                        {
+                            d[i] -= h;
+                        }
+                        f += h;
+
+                        // Implicit QL transformation
+                        p = d[m];
+                        ValueT c  = 1;
+                        ValueT c2 = c;
+                        ValueT c3 = c;
+                        const ValueT el1 = e[l+1];
+                        ValueT s  = 0;
+                        ValueT s2 = 0;
+                        for( size_t i = m; i-- > l; )
+                        {
+                            c3 = c2;
+                            c2 = c;
+                            s2 = s;
+                            g  = c * e[i];
+                            h  = c * p;
+                            r  = std::hypot( p, e[i] );
+                            e[i+1] = s * r;
+                            s = e[i] / r;
+                            c = p / r;
+                            p = c * d[i] - s * g;
+                            d[i+1] = h + s * ( c * g + s * d[i] );
+
+                            if( accumulate )
+                            {
+                                for( size_t k = 0; k < n; k++ )
+                                {
+                                    h            = V[k*n+i+1];
+                                    V[k*n+i+1]   = s * V[k*n+i] + c * h;
+                                    V[k*n+i]     = c * V[k*n+i] - s * h;
+                                }
+                            }
+                        }
+                        p    = -s * s2 * c3 * el1 * e[l] / dl1;
+                        e[l] = s * p;
+                        d[l] = c * p;
+                    }
+                    while( std::fabs( e[l] ) > eps * tst1 );
+                }
+                d[l] = d[l] + f;
+                e[l] = 0;
+            }
+
+            // Sort ascending, carrying the eigenvectors along
+            for( size_t i = 0; i + 1 < n; i++ )
+            {
+                size_t k = i;
+                ValueT p = d[i];
+                for( size_t j = i + 1; j < n; j++ )
+                {
+                    if( d[j] < p )
+                    {
+                        k = j;
+                        p = d[j];
+                    }
+                }
+                if( k != i )
+                {
+                    d[k] = d[i];
+                    d[i] = p;
+                    if( accumulate )
+                    {
+                        for( size_t j = 0; j < n; j++ )
+                        {
+                            std::swap( V[j*n+i], V[j*n+k] );
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        /// @brief Eigenvectors (columns), also used as the reduction work array
+        MatrixN<ValueT> m_vectors;
+
+        /// @brief Eigenvalues
+        VectorN<ValueT> m_values;
+
+        /// @brief Off-diagonal work array
+        VectorN<ValueT> m_off_diag;
+
+        /// @brief Decomposition state
+        bool m_valid { false };
+        bool m_has_vectors { false };
+
+}; // End of Symmetric_Eigen_Solver class
+
+/**
+ * Compute the eigenvalues and eigenvectors of a dense symmetric matrix.
+ *
+ * @param A Symmetric matrix.  Only the lower triangle is read.
+ * @param values Eigenvalues, ascending.
+ * @param vectors Matching eigenvectors as columns.
+ */
+template <typename ValueT>
+Result<void> symmetric_eigen( const MatrixN<ValueT>& A,
+                              VectorN<ValueT>&       values,
+                              MatrixN<ValueT>&       vectors )
+{
+    Symmetric_Eigen_Solver<ValueT> solver;
+    auto res = solver.compute( A, true );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    values  = solver.eigenvalues();
+    vectors = solver.eigenvectors();
+    return outcome::ok();
+}
+
+/**
+ * Compute only the eigenvalues (ascending) of a dense symmetric matrix.
+ */
+template <typename ValueT>
+Result<VectorN<ValueT>> symmetric_eigenvalues( const MatrixN<ValueT>& A )
+{
+    Symmetric_Eigen_Solver<ValueT> solver;
+    auto res = solver.compute( A, false );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<VectorN<ValueT>>( solver.eigenvalues() );
+}
+
+namespace detail {
+
+/**
+ * Cyclic Jacobi eigen-decomposition of a small row-major symmetric matrix held on the stack.
+ * Eigenvalues are written to d in ascending order and, if V is non-null, eigenvectors to the
+ * columns of V.
+ */
+template <typename ValueT,
+          size_t   N>
+void jacobi_eigen( std::array<ValueT,N*N>  a,
+                   std::array<ValueT,N>&   d,
+                   std::array<ValueT,N*N>* V )
+{
+    if( V )
+    {
+        V->fill( ValueT( 0 ) );
+        for( size_t i = 0; i < N; i++ )
+        {
+            (*V)[i*N+i] = 1;
+        }
+    }
+
+    ValueT norm = 0;
+    for( const auto& v : a )
+    {
+        norm += v * v;
+    }
+    const ValueT tol = std::numeric_limits<ValueT>::epsilon() * std::numeric_limits<ValueT>::epsilon() * norm;
+
+    for( size_t sweep = 0; sweep < 50; sweep++ )
+    {
+        ValueT off = 0;
+        for( size_t p = 0; p < N; p++ )
+        {
+            for( size_t q = p + 1; q < N; q++ )
+            {
+                off += a[p*N+q] * a[p*N+q];
+            }
+        }
+        if( off <= tol )
+        {
+            break;
+        }
+
+        for( size_t p = 0; p + 1 < N; p++ )
+        {
+            for( size_t q = p + 1; q < N; q++ )
+            {
+                const ValueT apq = a[p*N+q];
+                if( apq == ValueT( 0 ) )
+                {
+                    continue;
+                }
+
+                // Rotation angle which annihilates a(p,q)
+                const ValueT theta = ( a[q*N+q] - a[p*N+p] ) / ( ValueT( 2 ) * apq );
+                const ValueT t     = ( theta >= 0 ? ValueT( 1 ) : ValueT( -1 ) ) /
+                                     ( std::fabs( theta ) + std::sqrt( theta * theta + ValueT( 1 ) ) );
+                const ValueT c     = ValueT( 1 ) / std::sqrt( t * t + ValueT( 1 ) );
+                const ValueT s     = t * c;
+
+                for( size_t k = 0; k < N; k++ )
+                {
+                    const ValueT akp = a[k*N+p];
+                    const ValueT akq = a[k*N+q];
+                    a[k*N+p] = c * akp - s * akq;
+                    a[k*N+q] = s * akp + c * akq;
+                }
+                for( size_t k = 0; k < N; k++ )
+                {
+                    const ValueT apk = a[p*N+k];
+                    const ValueT aqk = a[q*N+k];
+                    a[p*N+k] = c * apk - s * aqk;
+                    a[q*N+k] = s * apk + c * aqk;
+                }
+                if( V )
+                {
+                    for( size_t k = 0; k < N; k++ )
+                    {
+                        const ValueT vkp = (*V)[k*N+p];
+                        const ValueT vkq = (*V)[k*N+q];
+                        (*V)[k*N+p] = c * vkp - s * vkq;
+                        (*V)[k*N+q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+    }
+
+    for( size_t i = 0; i < N; i++ )
+    {
+        d[i] = a[i*N+i];
+    }
+
+    // Sort ascending
+    for( size_t i = 0; i + 1 < N; i++ )
+    {
+        size_t k = i;
+        for( size_t j = i + 1; j < N; j++ )
+        {
+            if( d[j] < d[k] )
+            {
+                k = j;
+            }
+        }
+        if( k != i )
+        {
+            std::swap( d[i], d[k] );
+            if( V )
+            {
+                for( size_t j = 0; j < N; j++ )
+                {
+                    std::swap( (*V)[j*N+i], (*V)[j*N+k] );
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Closed-form eigenvalues of a symmetric 3x3 matrix (Smith, 1961), ascending
+ */
+template <typename ValueT>
+std::array<ValueT,3> eigenvalues_3x3( const std::array<ValueT,9>& a )
+{
+    const ValueT p1 = a[1] * a[1] + a[2] * a[2] + a[5] * a[5];
+    if( p1 == ValueT( 0 ) )
+    {
+        std::array<ValueT,3> d { a[0], a[4], a[8] };
+        std::sort( d.begin(), d.end() );
+        return d;
+    }
+
+    const ValueT q  = ( a[0] + a[4] + a[8] ) / ValueT( 3 );
+    const ValueT b0 = a[0] - q;
+    const ValueT b4 = a[4] - q;
+    const ValueT b8 = a[8] - q;
+    const ValueT p2 = b0 * b0 + b4 * b4 + b8 * b8 + ValueT( 2 ) * p1;
+    const ValueT p  = std::sqrt( p2 / ValueT( 6 ) );
+
+    // r = det( (A - qI) / p ) / 2
+    const ValueT det = b0 * ( b4 * b8 - a[5] * a[5] ) -
+                       a[1] * ( a[1] * b8 - a[5] * a[2] ) +
+                       a[2] * ( a[1] * a[5] - b4 * a[2] );
+    const ValueT r   = std::clamp( det / ( ValueT( 2 ) * p * p * p ), ValueT( -1 ), ValueT( 1 ) );
+    const ValueT phi = std::acos( r ) / ValueT( 3 );
+
+    const ValueT largest  = q + ValueT( 2 ) * p * std::cos( phi );
+    const ValueT smallest = q + ValueT( 2 ) * p * std::cos( phi + ValueT( 2 ) * std::numbers::pi_v<ValueT> / ValueT( 3 ) );
+    return { smallest, ValueT( 3 ) * q - largest - smallest, largest };
+}
+
+} // End of detail namespace
+
+/**
+ * Eigenvalues (ascending) of a fixed-size symmetric matrix.  Runs entirely on the stack;
+ * 2x2 and 3x3 use closed forms, larger sizes use cyclic Jacobi.
+ */
+template <typename ValueT,
+          size_t   N>
+    requires ( N > 0 )
+Vector_<ValueT,N> symmetric_eigenvalues( const Matrix<ValueT,N,N>& A )
+{
+    std::array<ValueT,N*N> a;
+    std::copy( A.begin(), A.end(), a.begin() );
+
+    Vector_<ValueT,N> values;
+    if constexpr ( N == 1 )
+    {
+        values[0] = a[0];
+    }
+    else if constexpr ( N == 2 )
+    {
+        const ValueT mean = ( a[0] + a[3] ) / ValueT( 2 );
+        const ValueT r    = std::hypot( ( a[0] - a[3] ) / ValueT( 2 ), a[2] );
+        values[0] = mean - r;
+        values[1] = mean + r;
+    }
+    else if constexpr ( N == 3 )
+    {
+        values.data() = detail::eigenvalues_3x3<ValueT>( a );
+    }
+    else
+    {
+        detail::jacobi_eigen<ValueT,N>( a, values.data(), nullptr );
+    }
+    return values;
+}
+
+/**
+ * Eigenvalues (ascending) and eigenvectors (columns) of a fixed-size symmetric matrix.
+ * Runs entirely on the stack; 2x2 uses a closed-form rotation, larger sizes cyclic Jacobi.
+ */
+template <typename ValueT,
+          size_t   N>
+    requires ( N > 0 )
+void symmetric_eigen( const Matrix<ValueT,N,N>& A,
+                      Vector_<ValueT,N>&        values,
+                      Matrix<ValueT,N,N>&       vectors )
+{
+    std::array<ValueT,N*N> a;
+    std::copy( A.begin(), A.end(), a.begin() );
+
+    if constexpr ( N == 2 )
+    {
+        const ValueT mean  = ( a[0] + a[3] ) / ValueT( 2 );
+        const ValueT r     = std::hypot( ( a[0] - a[3] ) / ValueT( 2 ), a[2] );
+        const ValueT theta = std::atan2( ValueT( 2 ) * a[2], a[0] - a[3] ) / ValueT( 2 );
+        const ValueT c     = std::cos( theta );
+        const ValueT s     = std::sin( theta );
+        values[0] = mean - r;
+        values[1] = mean + r;
+        vectors( 0, 0 ) = -s;  vectors( 0, 1 ) = c;
+        vectors( 1, 0 ) =  c;  vectors( 1, 1 ) = s;
+    }
+    else
+    {
+        std::array<ValueT,N*N> V;
+        detail::jacobi_eigen<ValueT,N>( a, values.data(), &V );
+        std::copy( V.begin(), V.end(), vectors.begin() );
+    }
+}
+
+} // End of tmns::math::linalg namespace
@@ -0,0 +1,362 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    triangular_solve.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+
+/**
+ * Triangular solve kernels shared by inverse(), LU/Cholesky solves and covariance
+ * propagation.  Everything here works on raw row-major storage so the matrix headers can
+ * include it without a dependency cycle.
+ */
+namespace tmns::math::linalg {
+
+/**
+ * Which triangle of A holds the factor
+ */
+enum class Triangle
+{
+    LOWER,
+    UPPER
+}; // End of Triangle enum
+
+/**
+ * Whether the diagonal of A is stored or implicitly one
+ */
+enum class Diagonal
+{
+    NON_UNIT,
+    UNIT
+}; // End of Diagonal enum
+
+/**
+ * Solve with A or with A^T
+ */
+enum class Transpose
+{
+    NO_TRANSPOSE,
+    TRANSPOSE
+}; // End of Transpose enum
+
+namespace detail {
+
+/// @brief Rows of B per block.  Keeps a block of solved rows in L1/L2 while it updates the rows below.
+constexpr size_t TRSM_ROW_BLOCK = 64;
+
+/// @brief Columns of B per panel.  Bounds the working set of one row slice.
+constexpr size_t TRSM_COL_BLOCK = 256;
+
+/**
+ * Strided view of op(A) so one kernel serves both A and A^T
+ */
+template <typename ValueT>
+struct Tri_View
+{
+    const ValueT* a;
+    size_t        row_stride;
+    size_t        col_stride;
+
+    ValueT operator()( size_t r, size_t c ) const
+    {
+        return a[r * row_stride + c * col_stride];
+    }
+}; // End of Tri_View struct
+
+/**
+ * B[i, cols] -= alpha * B[k, cols].  The contiguous inner loop is what the compiler vectorizes.
+ */
+template <typename ValueT>
+inline void row_axpy( ValueT*       dst,
+                      const ValueT* src,
+                      ValueT        alpha,
+                      size_t        count )
+{
+    for( size_t j = 0; j < count; j++ )
+    {
+        dst[j] -= alpha * src[j];
+    }
+}
+
+/**
+ * Blocked forward substitution:  op(A) X = B with op(A) lower triangular.
+ */
+template <typename ValueT>
+void trsm_lower( const Tri_View<ValueT>& A,
+                 Diagonal                diag,
+                 size_t                  n,
+                 size_t                  nrhs,
+                 ValueT*                 B,
+                 size_t                  ldb )
+{
+    for( size_t jb = 0; jb < nrhs; jb += TRSM_COL_BLOCK )
+    {
+        const size_t nc = std::min( TRSM_COL_BLOCK, nrhs - jb );
+        for( size_t ib = 0; ib < n; ib += TRSM_ROW_BLOCK )
+        {
+            const size_t ie = std::min( ib + TRSM_ROW_BLOCK, n );
+
+            // Subtract the contribution of every solved block above
+            for( size_t kb = 0; kb < ib; kb += TRSM_ROW_BLOCK )
+            {
+                const size_t ke = std::min( kb + TRSM_ROW_BLOCK, ib );
+                for( size_t i = ib; i < ie; i++ )
+                {
+                    ValueT* b_row = B + i * ldb + jb;
+                    for( size_t k = kb; k < ke; k++ )
+                    {
+                        row_axpy( b_row, B + k * ldb + jb, A( i, k ), nc );
+                    }
+                }
+            }
+
+            // Solve the diagonal block
+            for( size_t i = ib; i < ie; i++ )
+            {
+                ValueT* b_row = B + i * ldb + jb;
+                for( size_t k = ib; k < i; k++ )
+                {
+                    row_axpy( b_row, B + k * ldb + jb, A( i, k ), nc );
+                }
+                if( diag == Diagonal::NON_UNIT )
+                {
+                    const ValueT inv = ValueT( 1 ) / A( i, i );
+                    for( size_t j = 0; j < nc; j++ )
+                    {
+                        b_row[j] *= inv;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Blocked back substitution:  op(A) X = B with op(A) upper triangular.
+ */
+template <typename ValueT>
+void trsm_upper( const Tri_View<ValueT>& A,
+                 Diagonal                diag,
+                 size_t                  n,
+                 size_t                  nrhs,
+                 ValueT*                 B,
+                 size_t                  ldb )
+{
+    const size_t num_blocks = ( n + TRSM_ROW_BLOCK - 1 ) / TRSM_ROW_BLOCK;
+    for( size_t jb = 0; jb < nrhs; jb += TRSM_COL_BLOCK )
+    {
+        const size_t nc = std::min( TRSM_COL_BLOCK, nrhs - jb );
+        for( size_t blk = num_blocks; blk-- > 0; )
+        {
+            const size_t ib = blk * TRSM_ROW_BLOCK;
+            const size_t ie = std::min( ib + TRSM_ROW_BLOCK, n );
+
+            // Subtract the contribution of every solved block below
+            for( size_t kb = ie; kb < n; kb += TRSM_ROW_BLOCK )
+            {
+                const size_t ke = std::min( kb + TRSM_ROW_BLOCK, n );
+                for( size_t i = ib; i < ie; i++ )
+                {
+                    ValueT* b_row = B + i * ldb + jb;
+                    for( size_t k = kb; k < ke; k++ )
+                    {
+                        row_axpy( b_row, B + k * ldb + jb, A( i, k ), nc );
+                    }
+                }
+            }
+
+            // Solve the diagonal block
+            for( size_t i = ie; i-- > ib; )
+            {
+                ValueT* b_row = B + i * ldb + jb;
+                for( size_t k = i + 1; k < ie; k++ )
+                {
+                    row_axpy( b_row, B + k * ldb + jb, A( i, k ), nc );
+                }
+                if( diag == Diagonal::NON_UNIT )
+                {
+                    const ValueT inv = ValueT( 1 ) / A( i, i );
+                    for( size_t j = 0; j < nc; j++ )
+                    {
+                        b_row[j] *= inv;
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Solve op(A) X = B in place for a block of right-hand sides (TRSM).
+ *
+ * A is an n x n row-major triangle with leading dimension lda; only the selected triangle
+ * is read.  B is n x nrhs row-major with leading dimension ldb and is overwritten with X.
+ * No singularity check is made, so callers must know the diagonal is non-zero.
+ *
+ * Rows of B are processed in blocks so each solved block is reused from cache for all the
+ * rows below it, and every inner loop runs along a contiguous row of B.
+ */
+template <typename ValueT>
+void trsm( Triangle      uplo,
+           Transpose     trans,
+           Diagonal      diag,
+           size_t        n,
+           size_t        nrhs,
+           const ValueT* A,
+           size_t        lda,
+           ValueT*       B,
+           size_t        ldb )
+{
+    if( n == 0 || nrhs == 0 )
+    {
+        return;
+    }
+
+    // op(A)(r,c) is A(c,r) under transpose, which also swaps the triangle
+    const bool transpose = ( trans == Transpose::TRANSPOSE );
+    const detail::Tri_View<ValueT> view { A, transpose ? 1 : lda, transpose ? lda : 1 };
+    const bool lower = ( uplo == Triangle::LOWER ) != transpose;
+
+    if( lower )
+    {
+        detail::trsm_lower( view, diag, n, nrhs, B, ldb );
+    }
+    else
+    {
+        detail::trsm_upper( view, diag, n, nrhs, B, ldb );
+    }
+}
+
+/**
+ * Solve op(A) x = b in place for a single right-hand side (TRSV).
+ *
+ * Without a transpose each step is a dot product along a row of A; with a transpose each
+ * step is an axpy along a row of A.  Either way A is streamed in storage order.
+ */
+template <typename ValueT>
+void trsv( Triangle      uplo,
+           Transpose     trans,
+           Diagonal      diag,
+           size_t        n,
+           const ValueT* A,
+           size_t        lda,
+           ValueT*       x )
+{
+    const bool unit = ( diag == Diagonal::UNIT );
+    if( trans == Transpose::NO_TRANSPOSE )
+    {
+        if( uplo == Triangle::LOWER )
+        {
+            for( size_t i = 0; i < n; i++ )
+            {
+                const ValueT* a_row = A + i * lda;
+                ValueT s = x[i];
+                for( size_t k = 0; k < i; k++ )
+                {
+                    s -= a_row[k] * x[k];
+                }
+                x[i] = unit ? s : s / a_row[i];
+            }
+        }
+        else
+        {
+            for( size_t i = n; i-- > 0; )
+            {
+                const ValueT* a_row = A + i * lda;
+                ValueT s = x[i];
+                for( size_t k = i + 1; k < n; k++ )
+                {
+                    s -= a_row[k] * x[k];
+                }
+                x[i] = unit ? s : s / a_row[i];
+            }
+        }
+    }
+    else
+    {
+        // A^T lower when A is upper:  finish x[k], then push it into the rows after it
+        if( uplo == Triangle::UPPER )
+        {
+            for( size_t k = 0; k < n; k++ )
+            {
+                const ValueT* a_row = A + k * lda;
+                if( !unit )
+                {
+                    x[k] /= a_row[k];
+                }
+                detail::row_axpy( x + k + 1, a_row + k + 1, x[k], n - k - 1 );
+            }
+        }
+        else
+        {
+            for( size_t k = n; k-- > 0; )
+            {
+                const ValueT* a_row = A + k * lda;
+                if( !unit )
+                {
+                    x[k] /= a_row[k];
+                }
+                detail::row_axpy( x, a_row, x[k], k );
+            }
+        }
+    }
+}
+
+/**
+ * Solve op(A) X = B in place for any contiguous row-major matrix types.
+ */
+template <typename AMatrixT,
+          typename BMatrixT>
+    requires requires( const AMatrixT& a, BMatrixT& b )
+    {
+        { a.data() } -> std::convertible_to<const typename AMatrixT::value_type*>;
+        { b.data() } -> std::convertible_to<typename BMatrixT::value_type*>;
+        a.rows();
+        b.cols();
+    }
+void triangular_solve( const AMatrixT& A,
+                       BMatrixT&       B,
+                       Triangle        uplo,
+                       Transpose       trans = Transpose::NO_TRANSPOSE,
+                       Diagonal        diag  = Diagonal::NON_UNIT )
+{
+    trsm( uplo, trans, diag, A.rows(), B.cols(), A.data(), A.cols(), B.data(), B.cols() );
+}
+
+/**
+ * Solve op(A) x = b in place for a contiguous vector type (VectorN or Vector_).
+ */
+template <typename AMatrixT,
+          typename BVectorT>
+    requires requires( const AMatrixT& a, BVectorT& b )
+    {
+        { a.data() } -> std::convertible_to<const typename AMatrixT::value_type*>;
+        { b.data().data() } -> std::convertible_to<typename BVectorT::value_type*>;
+        a.rows();
+    }
+void triangular_solve( const AMatrixT& A,
+                       BVectorT&       b,
+                       Triangle        uplo,
+                       Transpose       trans = Transpose::NO_TRANSPOSE,
+                       Diagonal        diag  = Diagonal::NON_UNIT )
+{
+    trsv( uplo, trans, diag, A.rows(), A.data(), A.cols(), b.data().data() );
+}
+
+} // End of tmns::math::linalg namespace
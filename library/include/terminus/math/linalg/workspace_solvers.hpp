@@ -0,0 +1,295 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    workspace_solvers.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <memory>
+
+namespace tmns::math::linalg {
+
+/**
+ * Stateful solver for symmetric (semi-)definite systems Ax=b.
+ *
+ * The solver owns its factorization and work arrays.  Once it has been factored at a
+ * given size, subsequent calls to factor() and solve() at that same size do not touch
+ * the heap, provided the output vector passed to solve() is already the right size.
+ * This is intended for inner optimization loops which solve thousands of systems with
+ * identical dimensions.
+ *
+ * A moved-from solver holds no factorization.  solve() reports an error until factor()
+ * is called again.
+ *
+ * Only float and double are instantiated.
+ */
+template <typename ValueT>
+class Symmetric_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor.  Storage is allocated on the first call to factor().
+         */
+        Symmetric_Solver();
+
+        /**
+         * Constructor which preallocates storage for an n x n system.
+         */
+        explicit Symmetric_Solver( size_t n );
+
+        /**
+         * Destructor
+         */
+        ~Symmetric_Solver();
+
+        Symmetric_Solver( Symmetric_Solver&& rhs ) noexcept;
+        Symmetric_Solver& operator = ( Symmetric_Solver&& rhs ) noexcept;
+
+        /**
+         * Compute the LDL^T factorization of A.  A must be square and symmetric.
+         */
+        Result<void> factor( const MatrixN<ValueT>& A );
+
+        /**
+         * Solve Ax=b using the stored factorization.  x is only resized if its size does
+         * not match the factored system.
+         */
+        Result<void> solve( const VectorN<ValueT>& b,
+                            VectorN<ValueT>&       x ) const;
+
+        /**
+         * Solve Ax=b using the stored factorization, returning a new vector.
+         */
+        Result<VectorN<ValueT>> solve( const VectorN<ValueT>& b ) const;
+
+        /**
+         * Get the dimension of the currently allocated system
+         */
+        size_t size() const;
+
+        /**
+         * Check if a valid factorization is stored
+         */
+        bool is_factored() const;
+
+    private:
+
+        struct Impl;
+
+        /// @brief Eigen-backed implementation
+        std::unique_ptr<Impl> m_impl;
+
+}; // End of Symmetric_Solver class
+
+/**
+ * Stateful solver for the (possibly overdetermined) least squares problem min ||Ax-b||.
+ *
+ * Uses a column-pivoted Householder QR.  Storage is sized for the m x n system on the first
+ * call and reused afterwards, including the scratch space solve() transforms the
+ * right-hand side in.  solve() is therefore not const, and one solver must not be used
+ * from several threads at once.  A moved-from solver holds no factorization.
+ *
+ * Only float and double are instantiated.
+ */
+template <typename ValueT>
+class Least_Squares_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor.  Storage is allocated on the first call to factor().
+         */
+        Least_Squares_Solver();
+
+        /**
+         * Constructor which preallocates storage for an m x n system.
+         */
+        Least_Squares_Solver( size_t rows,
+                              size_t cols );
+
+        /**
+         * Destructor
+         */
+        ~Least_Squares_Solver();
+
+        Least_Squares_Solver( Least_Squares_Solver&& rhs ) noexcept;
+        Least_Squares_Solver& operator = ( Least_Squares_Solver&& rhs ) noexcept;
+
+        /**
+         * Compute the QR factorization of A.
+         */
+        Result<void> factor( const MatrixN<ValueT>& A );
+
+        /**
+         * Solve min ||Ax-b|| using the stored factorization.  x is only resized if its size
+         * does not match the number of columns of A.
+         */
+        Result<void> solve( const VectorN<ValueT>& b,
+                            VectorN<ValueT>&       x );
+
+        /**
+         * Solve min ||Ax-b|| using the stored factorization, returning a new vector.
+         */
+        Result<VectorN<ValueT>> solve( const VectorN<ValueT>& b );
+
+        /**
+         * Numerical rank revealed by the pivoted QR
+         */
+        size_t rank() const;
+
+        /**
+         * Get the number of rows in the currently allocated system
+         */
+        size_t rows() const;
+
+        /**
+         * Get the number of columns in the currently allocated system
+         */
+        size_t cols() const;
+
+        /**
+         * Check if a valid factorization is stored
+         */
+        bool is_factored() const;
+
+    private:
+
+        struct Impl;
+
+        /// @brief Eigen-backed implementation
+        std::unique_ptr<Impl> m_impl;
+
+}; // End of Least_Squares_Solver class
+
+/**
+ * Stateful thin singular value decomposition.
+ *
+ * After factor(), the singular values and singular vectors can be copied into caller-owned
+ * buffers, and solve() applies the truncated pseudo-inverse to a right-hand side.  As with
+ * the other solvers, repeated use at the same size does not reallocate.  solve() works in
+ * the solver's scratch space, so it is not const, and one solver must not be used from
+ * several threads at once.  A moved-from solver holds no decomposition.
+ *
+ * Only float and double are instantiated.
+ */
+template <typename ValueT>
+class SVD_Solver
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /**
+         * Default Constructor.  Storage is allocated on the first call to factor().
+         */
+        SVD_Solver();
+
+        /**
+         * Constructor which preallocates storage for an m x n decomposition.
+         */
+        SVD_Solver( size_t rows,
+                    size_t cols );
+
+        /**
+         * Destructor
+         */
+        ~SVD_Solver();
+
+        SVD_Solver( SVD_Solver&& rhs ) noexcept;
+        SVD_Solver& operator = ( SVD_Solver&& rhs ) noexcept;
+
+        /**
+         * Decompose A = U * diag(S) * V^T
+         */
+        Result<void> factor( const MatrixN<ValueT>& A );
+
+        /**
+         * Solve min ||Ax-b|| with the pseudo-inverse, zeroing singular values <= eps.
+         */
+        Result<void> solve( const VectorN<ValueT>& b,
+                            VectorN<ValueT>&       x,
+                            ValueT                 eps = ValueT( 1e-8 ) );
+
+        /**
+         * Solve min ||Ax-b|| with the pseudo-inverse, returning a new vector.
+         */
+        Result<VectorN<ValueT>> solve( const VectorN<ValueT>& b,
+                                       ValueT                 eps = ValueT( 1e-8 ) );
+
+        /**
+         * Solve min ||AX-B|| for every column of B at once, zeroing singular values <= eps.
+         * X is resized to cols() x B.cols() only when its shape differs.
+         */
+        Result<void> solve( const MatrixN<ValueT>& B,
+                            MatrixN<ValueT>&       X,
+                            ValueT                 eps = ValueT( 1e-8 ) );
+
+        /**
+         * Solve min ||AX-B|| for every column of B, returning a new matrix.
+         */
+        Result<MatrixN<ValueT>> solve( const MatrixN<ValueT>& B,
+                                       ValueT                 eps = ValueT( 1e-8 ) );
+
+        /**
+         * Copy the singular values (descending) into S.  S is empty before factor().
+         */
+        void singular_values( VectorN<ValueT>& S ) const;
+
+        /**
+         * Copy the thin left singular vectors (m x min(m,n)) into U.  U is empty before factor().
+         */
+        void matrix_u( MatrixN<ValueT>& U ) const;
+
+        /**
+         * Copy the thin right singular vectors (n x min(m,n)) into V.  V is empty before factor().
+         */
+        void matrix_v( MatrixN<ValueT>& V ) const;
+
+        /**
+         * Get the number of rows in the currently allocated system
+         */
+        size_t rows() const;
+
+        /**
+         * Get the number of columns in the currently allocated system
+         */
+        size_t cols() const;
+
+        /**
+         * Check if a valid factorization is stored
+         */
+        bool is_factored() const;
+
+    private:
+
+        struct Impl;
+
+        /// @brief Eigen-backed implementation
+        std::unique_ptr<Impl> m_impl;
+
+}; // End of SVD_Solver class
+
+} // End of tmns::math::linalg namespace
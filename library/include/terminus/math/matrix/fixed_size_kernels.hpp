@@ -0,0 +1,277 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    fixed_size_kernels.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <utility>
+
+/**
+ * Closed-form, fully unrolled kernels for the small fixed-size matrices (up to 4x4) used
+ * by geometry and calibration code.  They work on row-major raw storage, never allocate and
+ * are constexpr, so Matrix<T,N,M> can dispatch to them through requires clauses and they can
+ * be checked at compile time.
+ */
+namespace tmns::math::kernels {
+
+/**
+ * Dimensions handled by the unrolled kernels
+ */
+template <size_t N>
+concept Small_Dimension = ( N >= 1 && N <= 4 );
+
+/**
+ * Square sizes with closed-form determinant and inverse
+ */
+template <size_t N>
+concept Small_Square = ( N >= 2 && N <= 4 );
+
+namespace detail {
+
+/**
+ * Dot product of row r of A (R x K) with column c of B (K x C), unrolled over K
+ */
+template <size_t K,
+          size_t C,
+          typename ValueT,
+          size_t... Ks>
+constexpr ValueT dot_row_col( const ValueT* a_row,
+                              const ValueT* b,
+                              size_t        c,
+                              std::index_sequence<Ks...> )
+{
+    return ( ( a_row[Ks] * b[Ks * C + c] ) + ... );
+}
+
+} // End of detail namespace
+
+/**
+ * out = A * B with A R x K and B K x C.  out must not alias A or B.
+ */
+template <size_t R,
+          size_t K,
+          size_t C,
+          typename ValueT>
+    requires ( Small_Dimension<R> && Small_Dimension<K> && Small_Dimension<C> )
+constexpr void multiply( const ValueT* a,
+                         const ValueT* b,
+                         ValueT*       out )
+{
+    [&]<size_t... Is>( std::index_sequence<Is...> )
+    {
+        ( ( out[Is] = detail::dot_row_col<K,C>( a + ( Is / C ) * K, b, Is % C,
+                                                std::make_index_sequence<K>() ) ), ... );
+    }( std::make_index_sequence<R * C>() );
+}
+
+/**
+ * y = A * x with A R x C.  y must not alias x.
+ */
+template <size_t R,
+          size_t C,
+          typename ValueT>
+    requires ( Small_Dimension<R> && Small_Dimension<C> )
+constexpr void multiply_vector( const ValueT* a,
+                                const ValueT* x,
+                                ValueT*       y )
+{
+    multiply<R,C,1>( a, x, y );
+}
+
+/**
+ * out = A^T with A R x C.  out must not alias A.
+ */
+template <size_t R,
+          size_t C,
+          typename ValueT>
+    requires ( Small_Dimension<R> && Small_Dimension<C> )
+constexpr void transpose( const ValueT* a,
+                          ValueT*       out )
+{
+    [&]<size_t... Is>( std::index_sequence<Is...> )
+    {
+        ( ( out[Is] = a[( Is % R ) * C + Is / R] ), ... );
+    }( std::make_index_sequence<R * C>() );
+}
+
+/**
+ * Sum of the diagonal of an N x N matrix
+ */
+template <size_t N,
+          typename ValueT>
+constexpr ValueT trace( const ValueT* a )
+{
+    return [&]<size_t... Is>( std::index_sequence<Is...> )
+    {
+        return ( a[Is * ( N + 1 )] + ... );
+    }( std::make_index_sequence<N>() );
+}
+
+/**
+ * Determinant of a 2x2, 3x3 or 4x4 matrix
+ */
+template <size_t N,
+          typename ValueT>
+    requires ( N == 2 )
+constexpr ValueT determinant( const ValueT* a )
+{
+    return a[0] * a[3] - a[1] * a[2];
+}
+
+/**
+ * Determinant of a 3x3 matrix by cofactor expansion along the first row
+ */
+template <size_t N,
+          typename ValueT>
+    requires ( N == 3 )
+constexpr ValueT determinant( const ValueT* a )
+{
+    return a[0] * ( a[4] * a[8] - a[5] * a[7] )
+         + a[1] * ( a[5] * a[6] - a[3] * a[8] )
+         + a[2] * ( a[3] * a[7] - a[4] * a[6] );
+}
+
+/**
+ * Determinant of a 4x4 matrix from the 2x2 minors of its top and bottom row pairs
+ */
+template <size_t N,
+          typename ValueT>
+    requires ( N == 4 )
+constexpr ValueT determinant( const ValueT* a )
+{
+    const ValueT s0 = a[0] * a[5]  - a[4]  * a[1];
+    const ValueT s1 = a[0] * a[6]  - a[4]  * a[2];
+    const ValueT s2 = a[0] * a[7]  - a[4]  * a[3];
+    const ValueT s3 = a[1] * a[6]  - a[5]  * a[2];
+    const ValueT s4 = a[1] * a[7]  - a[5]  * a[3];
+    const ValueT s5 = a[2] * a[7]  - a[6]  * a[3];
+    const ValueT c5 = a[10] * a[15] - a[14] * a[11];
+    const ValueT c4 = a[9]  * a[15] - a[13] * a[11];
+    const ValueT c3 = a[9]  * a[14] - a[13] * a[10];
+    const ValueT c2 = a[8]  * a[15] - a[12] * a[11];
+    const ValueT c1 = a[8]  * a[14] - a[12] * a[10];
+    const ValueT c0 = a[8]  * a[13] - a[12] * a[9];
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+/**
+ * Inverse of a 2x2 matrix as adjugate / determinant.
+ *
+ * @return False, leaving out untouched, if the determinant is exactly zero.
+ */
+template <size_t N,
+          typename ValueT>
+    requires ( N == 2 )
+constexpr bool inverse( const ValueT* a,
+                        ValueT*       out )
+{
+    const ValueT det = determinant<2>( a );
+    if( det == ValueT( 0 ) )
+    {
+        return false;
+    }
+    const ValueT inv = ValueT( 1 ) / det;
+    const ValueT a0  = a[0];
+    out[0] =  a[3] * inv;
+    out[1] = -a[1] * inv;
+    out[2] = -a[2] * inv;
+    out[3] =  a0   * inv;
+    return true;
+}
+
+/**
+ * Inverse of a 3x3 matrix as adjugate / determinant.  out must not alias a.
+ *
+ * @return False, leaving out untouched, if the determinant is exactly zero.
+ */
+template <size_t N,
+          typename ValueT>
+    requires ( N == 3 )
+constexpr bool inverse( const ValueT* a,
+                        ValueT*       out )
+{
+    const ValueT b0 = a[4] * a[8] - a[5] * a[7];
+    const ValueT b3 = a[5] * a[6] - a[3] * a[8];
+    const ValueT b6 = a[3] * a[7] - a[4] * a[6];
+    const ValueT det = a[0] * b0 + a[1] * b3 + a[2] * b6;
+    if( det == ValueT( 0 ) )
+    {
+        return false;
+    }
+    const ValueT inv = ValueT( 1 ) / det;
+    out[0] = b0 * inv;
+    out[1] = ( a[2] * a[7] - a[1] * a[8] ) * inv;
+    out[2] = ( a[1] * a[5] - a[2] * a[4] ) * inv;
+    out[3] = b3 * inv;
+    out[4] = ( a[0] * a[8] - a[2] * a[6] ) * inv;
+    out[5] = ( a[2] * a[3] - a[0] * a[5] ) * inv;
+    out[6] = b6 * inv;
+    out[7] = ( a[1] * a[6] - a[0] * a[7] ) * inv;
+    out[8] = ( a[0] * a[4] - a[1] * a[3] ) * inv;
+    return true;
+}
+
+/**
+ * Inverse of a 4x4 matrix as adjugate / determinant, sharing the 2x2 minors with the
+ * determinant.  out must not alias a.
+ *
+ * @return False, leaving out untouched, if the determinant is exactly zero.
+ */
+template <size_t N,
+          typename ValueT>
+    requires ( N == 4 )
+constexpr bool inverse( const ValueT* a,
+                        ValueT*       out )
+{
+    const ValueT s0 = a[0] * a[5]  - a[4]  * a[1];
+    const ValueT s1 = a[0] * a[6]  - a[4]  * a[2];
+    const ValueT s2 = a[0] * a[7]  - a[4]  * a[3];
+    const ValueT s3 = a[1] * a[6]  - a[5]  * a[2];
+    const ValueT s4 = a[1] * a[7]  - a[5]  * a[3];
+    const ValueT s5 = a[2] * a[7]  - a[6]  * a[3];
+    const ValueT c5 = a[10] * a[15] - a[14] * a[11];
+    const ValueT c4 = a[9]  * a[15] - a[13] * a[11];
+    const ValueT c3 = a[9]  * a[14] - a[13] * a[10];
+    const ValueT c2 = a[8]  * a[15] - a[12] * a[11];
+    const ValueT c1 = a[8]  * a[14] - a[12] * a[10];
+    const ValueT c0 = a[8]  * a[13] - a[12] * a[9];
+
+    const ValueT det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if( det == ValueT( 0 ) )
+    {
+        return false;
+    }
+    const ValueT inv = ValueT( 1 ) / det;
+
+    out[0]  = (  a[5]  * c5 - a[6]  * c4 + a[7]  * c3 ) * inv;
+    out[1]  = ( -a[1]  * c5 + a[2]  * c4 - a[3]  * c3 ) * inv;
+    out[2]  = (  a[13] * s5 - a[14] * s4 + a[15] * s3 ) * inv;
+    out[3]  = ( -a[9]  * s5 + a[10] * s4 - a[11] * s3 ) * inv;
+    out[4]  = ( -a[4]  * c5 + a[6]  * c2 - a[7]  * c1 ) * inv;
+    out[5]  = (  a[0]  * c5 - a[2]  * c2 + a[3]  * c1 ) * inv;
+    out[6]  = ( -a[12] * s5 + a[14] * s2 - a[15] * s1 ) * inv;
+    out[7]  = (  a[8]  * s5 - a[10] * s2 + a[11] * s1 ) * inv;
+    out[8]  = (  a[4]  * c4 - a[5]  * c2 + a[7]  * c0 ) * inv;
+    out[9]  = ( -a[0]  * c4 + a[1]  * c2 - a[3]  * c0 ) * inv;
+    out[10] = (  a[12] * s4 - a[13] * s2 + a[15] * s0 ) * inv;
+    out[11] = ( -a[8]  * s4 + a[9]  * s2 - a[11] * s0 ) * inv;
+    out[12] = ( -a[4]  * c3 + a[5]  * c1 - a[6]  * c0 ) * inv;
+    out[13] = (  a[0]  * c3 - a[1]  * c1 + a[2]  * c0 ) * inv;
+    out[14] = ( -a[12] * s3 + a[13] * s1 - a[14] * s0 ) * inv;
+    out[15] = (  a[8]  * s3 - a[9]  * s1 + a[10] * s0 ) * inv;
+    return true;
+}
+
+} // End of tmns::math::kernels namespace
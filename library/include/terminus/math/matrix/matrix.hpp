@@ -26,7 +26,9 @@
 
 // Terminus Libraries
 #include <terminus/log/utility.hpp>
+#include <terminus/math/linalg/triangular_solve.hpp>
 #include <terminus/math/types/fundamental_types.hpp>
+#include <terminus/math/matrix/fixed_size_kernels.hpp>
 #include <terminus/math/matrix/matrix_base.hpp>
 #include <terminus/math/matrix/matrix_col.hpp>
 #include <terminus/math/matrix/matrix_row.hpp>
@@ -363,14 +365,22 @@ class Matrix : public Matrix_Base<Matrix<ElementT,RowsN,ColsN> >
             return std::move( output );
         }
 
+        /**
+         * Sum of the diagonal elements
+         */
+        value_type trace() const requires( RowsN == ColsN )
+        {
+            return kernels::trace<RowsN>( m_data.data() );
+        }
+
         /**
          * Get the Determinant
          *
-         * Optimized for 2x2 matrices
+         * Closed form for 2x2, 3x3 and 4x4 matrices
          */
-        value_type determinant() const requires( RowsN == 2 && ColsN == 2 )
+        value_type determinant() const requires( RowsN == ColsN && kernels::Small_Square<RowsN> )
         {
-            return m_data[0] * m_data[3] - m_data[1] * m_data[2];
+            return kernels::determinant<RowsN>( m_data.data() );
         }
 
         /**
@@ -444,6 +454,21 @@ class Matrix : public Matrix_Base<Matrix<ElementT,RowsN,ColsN> >
             return result;
         }
 
+        /**
+         * Inverse Matrix
+         *
+         * Closed-form adjugate for 2x2, 3x3 and 4x4 matrices, without any temporaries
+         */
+        Matrix inverse() const requires( RowsN == ColsN && kernels::Small_Square<RowsN> )
+        {
+            Matrix result;
+            if( !kernels::inverse<RowsN>( m_data.data(), result.m_data.data() ) )
+            {
+                throw std::runtime_error( "Matrix is singular in inverse()" );
+            }
+            return result;
+        }
+
         /**
          * Inverse Matrix
          */
@@ -497,31 +522,11 @@ class Matrix : public Matrix_Base<Matrix<ElementT,RowsN,ColsN> >
                 inverse_mat( i, pm(i) ) = value_type(1);
             }
 
-            // Divide by the lower-triangular term
-            for( size_t i = 0; i < sz; ++i ){
-            for( size_t j = 0; j < sz; ++j ){
-                value_type t = inverse_mat( i, j );
-                if( t != zero )
-                {
-                    for( size_t k = i+1; k < sz; ++k )
-                    {
-                        inverse_mat( k, j ) -= buf( k, i ) * t;
-                    }
-                }
-            }} // End of lower-triangle division
-
-            // Divide by the upper-triangular term
-            for ( ssize_t i = static_cast<ssize_t>(sz - 1); i >= 0; --i ){
-            for ( ssize_t j = static_cast<ssize_t>(sz - 1); j >= 0; --j ){
-                value_type t = inverse_mat(i,j) /= buf(i,i);
-                if( t != zero )
-                {
-                    for( ssize_t k = i-1; k >= 0; --k )
-                    {
-                        inverse_mat(k,j) -= buf(k,i) * t;
-                    }
-                }
-            }}
+            // Apply L^-1 then U^-1 to the permuted identity in place
+            linalg::trsm( linalg::Triangle::LOWER, linalg::Transpose::NO_TRANSPOSE, linalg::Diagonal::UNIT,
+                          sz, sz, buf.data(), sz, inverse_mat.data(), sz );
+            linalg::trsm( linalg::Triangle::UPPER, linalg::Transpose::NO_TRANSPOSE, linalg::Diagonal::NON_UNIT,
+                          sz, sz, buf.data(), sz, inverse_mat.data(), sz );
 
             return inverse_mat;
         }
@@ -16,9 +16,11 @@
 #pragma once
 
 // Terminus Libraries
+#include <terminus/math/linalg/triangular_solve.hpp>
 #include <terminus/math/types/functors.hpp>
 #include <terminus/math/types/math_functors.hpp>
 #include <terminus/math/vector/vector_transpose.hpp>
+#include <terminus/math/matrix/fixed_size_kernels.hpp>
 #include <terminus/math/matrix/matrix_col.hpp>
 #include <terminus/math/matrix/matrix_functors.hpp>
 #include <terminus/math/matrix/matrix_vector_product.hpp>
@@ -295,6 +297,40 @@ Matrix_Unary_Functor<MatrixT, Arg_Val_Quotient_Functor<ScalarT>>
     return elem_quot( m, s );
 }
 
+/**
+ * Product of two small fixed-size matrices, evaluated immediately with unrolled kernels
+ */
+template <typename T,
+          size_t   RowsN,
+          size_t   InnerN,
+          size_t   ColsN>
+Matrix<T,RowsN,ColsN> operator * ( const Matrix<T,RowsN,InnerN>& m1,
+                                   const Matrix<T,InnerN,ColsN>& m2 )
+    requires ( kernels::Small_Dimension<RowsN> &&
+               kernels::Small_Dimension<InnerN> &&
+               kernels::Small_Dimension<ColsN> )
+{
+    Matrix<T,RowsN,ColsN> result;
+    kernels::multiply<RowsN,InnerN,ColsN>( m1.data(), m2.data(), result.data() );
+    return result;
+}
+
+/**
+ * Product of a small fixed-size matrix and vector, evaluated immediately with unrolled kernels
+ */
+template <typename T,
+          size_t   RowsN,
+          size_t   ColsN>
+Vector_<T,RowsN> operator * ( const Matrix<T,RowsN,ColsN>& m,
+                              const Vector_<T,ColsN>&      v )
+    requires ( kernels::Small_Dimension<RowsN> &&
+               kernels::Small_Dimension<ColsN> )
+{
+    Vector_<T,RowsN> result;
+    kernels::multiply_vector<RowsN,ColsN>( m.data(), v.data().data(), result.data().data() );
+    return result;
+}
+
 /**
  * Product of a matrix and a vector
  */
@@ -355,22 +391,13 @@ Matrix<typename Product_Type<typename Vector1T::value_type,
 }
 
 /**
- * Matrix Inverse (2x2 case)
+ * Matrix Inverse (2x2, 3x3 and 4x4 closed form)
  */
-template <typename T>
-Matrix<T, 2, 2> inverse( const Matrix<T,2,2>& m)
+template <typename T,
+          size_t   N>
+Matrix<T,N,N> inverse( const Matrix<T,N,N>& m ) requires kernels::Small_Square<N>
 {
-    T const* d = m.data();
-    T det = d[0]*d[3] - d[1]*d[2];
-    if( det == T(0) )
-    {
-        throw std::runtime_error( "Matrix is singular in inverse()" );
-    }
-    Matrix<T, 2, 2> out( { d[3]/det,
-                           -d[1]/det,
-                           -d[2]/det,
-                           d[0]/det } );
-    return out;
+    return m.inverse();
 }
 
 /**
@@ -428,37 +455,11 @@ Matrix<typename MatrixT::value_type> inverse( const Matrix_Base<MatrixT>& m )
         inverse( i, pm(i) ) = value_type(1);
     }
 
-    // Divide by the lower-triangular term
-    for( size_t i=0; i<size; ++i )
-    {
-        for( size_t j=0; j<size; ++j )
-        {
-            value_type t = inverse(i,j);
-            if( t != zero )
-            {
-                for( size_t k = i + 1; k < size; ++k )
-                {
-                    inverse(k,j) -= buf(k,i) * t;
-                }
-            }
-        }
-    }
-
-    // Divide by the upper-triangular term
-    for( ssize_t i=static_cast<ssize_t>(size-1); i>=0; --i )
-    {
-        for( ssize_t j=static_cast<ssize_t>(size-1); j>=0; --j )
-        {
-            value_type t = inverse(i,j) /= buf(i,i);
-            if( t != zero )
-            {
-                for( ssize_t k=i-1; k>=0; --k )
-                {
-                    inverse(k,j) -= buf(k,i) * t;
-                }
-            }
-        }
-    }
+    // Apply L^-1 then U^-1 to the permuted identity in place
+    linalg::trsm( linalg::Triangle::LOWER, linalg::Transpose::NO_TRANSPOSE, linalg::Diagonal::UNIT,
+                  size, size, buf.data(), size, inverse.data(), size );
+    linalg::trsm( linalg::Triangle::UPPER, linalg::Transpose::NO_TRANSPOSE, linalg::Diagonal::NON_UNIT,
+                  size, size, buf.data(), size, inverse.data(), size );
 
     return inverse;
   }
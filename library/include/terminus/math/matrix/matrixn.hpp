@@ -15,6 +15,7 @@
 #pragma once
 
 // Terminus Libraries
+#include <terminus/math/linalg/triangular_solve.hpp>
 #include <terminus/math/matrix/matrix.hpp>
 #include <terminus/math/matrix/sub_matrix.hpp>
 #include <terminus/math/vector/sub_vector.hpp>
@@ -455,31 +456,11 @@ class Matrix<ElementT,0,0> : public Matrix_Base<Matrix<ElementT,0,0> >
                 inverse_mat( i, pm(i) ) = value_type(1);
             }
 
-            // Divide by the lower-triangular term
-            for( size_t i = 0; i < sz; ++i ){
-            for( size_t j = 0; j < sz; ++j ){
-                value_type t = inverse_mat( i, j );
-                if( t != zero )
-                {
-                    for( size_t k = i+1; k < sz; ++k )
-                    {
-                        inverse_mat( k, j ) -= buf( k, i ) * t;
-                    }
-                }
-            }} // End of lower-triangle division
-
-            // Divide by the upper-triangular term
-            for ( ssize_t i = static_cast<ssize_t>(sz - 1); i >= 0; --i ){
-            for ( ssize_t j = static_cast<ssize_t>(sz - 1); j >= 0; --j ){
-                value_type t = inverse_mat(i,j) /= buf(i,i);
-                if( t != zero )
-                {
-                    for( ssize_t k = i-1; k >= 0; --k )
-                    {
-                        inverse_mat(k,j) -= buf(k,i) * t;
-                    }
-                }
-            }}
+            // Apply L^-1 then U^-1 to the permuted identity in place
+            linalg::trsm( linalg::Triangle::LOWER, linalg::Transpose::NO_TRANSPOSE, linalg::Diagonal::UNIT,
+                          sz, sz, buf.data(), sz, inverse_mat.data(), sz );
+            linalg::trsm( linalg::Triangle::UPPER, linalg::Transpose::NO_TRANSPOSE, linalg::Diagonal::NON_UNIT,
+                          sz, sz, buf.data(), sz, inverse_mat.data(), sz );
 
             return inverse_mat;
         }
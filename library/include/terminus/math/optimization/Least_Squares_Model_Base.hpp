@@ -16,9 +16,15 @@
 
 // Terminus Libraries
 #include <terminus/math/matrix.hpp>
+#include <terminus/math/optimization/autodiff.hpp>
+#include <terminus/math/optimization/finite_difference.hpp>
+#include <terminus/math/optimization/jacobian_sparsity.hpp>
 #include <terminus/math/optimization/lm_enums.hpp>
 #include <terminus/math/vector/vectorn.hpp>
 
+// C++ Libraries
+#include <atomic>
+
 namespace tmns::math::optimize {
 
 /**
@@ -58,6 +64,22 @@ namespace tmns::math::optimize {
  * - The jacobian_type must implement several matrix-like methods such as scalar multiplication
  *   on the left.  You get this for free in the usual case when jacobian_type is just Matrix<foo>.
  *
+ * - Alternatively, template operator() on the domain's scalar type, e.g.
+ *
+ *       template <typename T> VectorN<T> operator()( const VectorN<T>& x ) const;
+ *
+ *   and call the math functions unqualified (using std::sin; ... sin(x(0))).  The default
+ *   jacobian() then evaluates the model once on Jet values and reads off the exact
+ *   derivatives instead of differencing n+1 evaluations.
+ *
+ * - If each output only depends on a few parameters, define a method
+ *
+ *       const Jacobian_Sparsity& jacobian_sparsity() const;
+ *
+ *   returning the nonzero pattern.  The finite-difference jacobian() then perturbs whole
+ *   groups of structurally orthogonal parameters at once (see Jacobian_Sparsity::coloring),
+ *   and sparse_jacobian() assembles the same values in compressed-row form.
+ *
  * - In addition, depending on the application, you may want to also define:
  *
  *     - Defines a method: jacobian_type jacobian( domain_type const& x ) const;
@@ -93,36 +115,105 @@ class Least_Squares_Model_Base
          *
          * Note that this numerical derivative assumes that the result_type and jacobian_type
          * types behave like vector and matrix objects, respectively.
+         *
+         * If the model's operator() is templated on its scalar type (see Autodiff_Model), the
+         * exact Jacobian is instead computed from a single evaluation on Jet values.
         */
         template <typename DomainT>
         MatrixN<double> jacobian( const DomainT& x ) const
         {
-            tmns::log::trace( ADD_CURRENT_LOC(),
-                              "Start of Method ",
-                              x.to_log_string() );
-            // Get nominal function value
-            auto h0 = impl().operator()(x);
-
-            // Jacobian is #params x #outputs
-            MatrixN<double> H( h0.size(), x.size() );
-
-            /**
-             * For each param dimension, add epsilon and re-evaluate h() to
-             * get numerical derivative w.r.t. that parameter
-             */
-            for( unsigned i=0; i<x.size(); ++i )
+            if constexpr ( Autodiff_Model<ImplT,DomainT> )
+            {
+                MatrixN<double> H;
+                autodiff_jacobian( impl(), x, H );
+                return H;
+            }
+            else
             {
-                DomainT xi = x;
+                // Get nominal function value
+                return jacobian( x, impl().operator()(x) );
+            }
+        }
 
-                // Variable step size, depending on parameter value
-                double epsilon = 1e-7 + std::fabs( xi(i) * 1e-7 );
-                xi(i) += epsilon;
+        /**
+         * As jacobian( x ), reusing the nominal value h0 = model( x ) which the caller has
+         * already evaluated, so the finite differences need one less model evaluation.
+         */
+        template <typename DomainT,
+                  typename ResultT>
+        MatrixN<double> jacobian( const DomainT& x,
+                                  const ResultT& h0 ) const
+        {
+            if constexpr ( Autodiff_Model<ImplT,DomainT> )
+            {
+                MatrixN<double> H;
+                autodiff_jacobian( impl(), x, H );
+                return H;
+            }
+            else
+            {
+                // Jacobian is #params x #outputs
+                MatrixN<double> H( h0.size(), x.size() );
+                if constexpr ( Sparse_Jacobian_Model<ImplT> )
+                {
+                    const Jacobian_Sparsity& pattern = impl().jacobian_sparsity();
+                    auto res = colored_finite_difference_jacobian( impl(), x, h0, pattern, pattern.coloring(),
+                                                                   H, m_jacobian_threads );
+                    if( res.has_value() )
+                    {
+                        return H;
+                    }
 
-                // Evaluate function with this step and compute the derivative w.r.t. parameter i
-                VectorN<double> hi = impl().operator()(xi);
-                select_col(H,i) = this->difference( hi, h0 ) / epsilon;
+                    // Reported once per model type, not once per outer iteration
+                    static std::atomic<bool> warned { false };
+                    if( !warned.exchange( true ) )
+                    {
+                        tmns::log::warn( ADD_CURRENT_LOC(), "Falling back to dense finite differences: ",
+                                         res.error().message() );
+                    }
+                }
+                finite_difference_jacobian( impl(), x, h0, H, m_jacobian_threads );
+                return H;
             }
-            return H;
+        }
+
+        /**
+         * Jacobian in compressed-row form for models declaring jacobian_sparsity(), from
+         * colored finite differences.  Needs one model evaluation per color plus one.
+         */
+        template <typename DomainT>
+        Result<Sparse_Jacobian> sparse_jacobian( const DomainT& x ) const
+            requires Sparse_Jacobian_Model<ImplT>
+        {
+            const Jacobian_Sparsity& pattern = impl().jacobian_sparsity();
+            const auto h0 = impl().operator()(x);
+
+            Sparse_Jacobian J( pattern );
+            auto res = colored_finite_difference_jacobian( impl(), x, h0, pattern, pattern.coloring(),
+                                                           J, m_jacobian_threads );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            return outcome::ok<Sparse_Jacobian>( std::move( J ) );
+        }
+
+        /**
+         * Number of threads the finite-difference jacobian() spreads its model evaluations
+         * over.  Zero uses the hardware concurrency.  The default of 1 keeps everything on the
+         * calling thread; anything else requires operator() to be safe to call concurrently.
+         */
+        void set_jacobian_threads( size_t num_threads )
+        {
+            m_jacobian_threads = num_threads;
+        }
+
+        /**
+         * Number of threads used by the finite-difference jacobian()
+         */
+        size_t jacobian_threads() const
+        {
+            return m_jacobian_threads;
         }
 
         /**
@@ -138,6 +229,11 @@ class Least_Squares_Model_Base
             return ( a - b );
         }
 
+    private:
+
+        /// @brief Worker threads for the finite-difference Jacobian
+        size_t m_jacobian_threads { 1 };
+
 }; // End of Least_Squares_Model_Base
 
 } // End of tmns::math::optimize
\ No newline at end of file
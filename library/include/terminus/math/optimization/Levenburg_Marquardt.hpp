@@ -15,10 +15,21 @@
 #pragma once
 
 // Terminus Libraries
+#include <terminus/math/linalg/fixed_size_solvers.hpp>
+#include <terminus/math/linalg/normal_equations.hpp>
 #include <terminus/math/linalg/solvers.hpp>
 #include <terminus/math/matrix/matrix_operations.hpp>
 #include <terminus/math/optimization/least_squares_model_base.hpp>
 #include <terminus/math/optimization/lm_enums.hpp>
+#include <terminus/math/optimization/residual_block_model_base.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <limits>
+#include <type_traits>
 
 namespace tmns::math::optimize {
 
@@ -48,17 +59,208 @@ namespace tmns::math::optimize {
 #define MATH_LM_REL_TOL (1e-16)
 #define MATH_LM_MAX_ITER (100)
 
-template <typename ImplT>
+/**
+ * Work done by one Levenberg-Marquardt solve
+ */
+struct LM_Statistics
+{
+    /// @brief Outer iterations, each of which linearizes the model once
+    size_t outer_iterations { 0 };
+
+    /// @brief Damped solves, including rejected steps
+    size_t inner_iterations { 0 };
+
+    /// @brief Calls to the model's operator() made by the solver itself.  Evaluations made
+    ///        inside jacobian() for finite differences are not included.
+    size_t model_evaluations { 0 };
+
+    /// @brief Calls to the model's jacobian() (or block normal equations)
+    size_t jacobian_evaluations { 0 };
+
+    /// @brief Residual norm at the seed
+    double initial_norm { 0 };
+
+    /// @brief Residual norm at the returned solution
+    double final_norm { 0 };
+}; // End of LM_Statistics struct
+
+/**
+ * What one outer iteration of levenberg_marquardt() did, handed to the telemetry callback
+ * at the end of the iteration.  Evaluation counts are running totals for the solve, the
+ * phase timings cover this iteration alone.
+ */
+struct LM_Iteration_Telemetry
+{
+    /// @brief Outer iteration, starting at 1
+    size_t iteration { 0 };
+
+    /// @brief Damped solves in this iteration, including rejected steps
+    size_t inner_iterations { 0 };
+
+    /// @brief Damping of the last step tried
+    double lambda { 0 };
+
+    /// @brief Residual norm at the start of the iteration
+    double norm_start { 0 };
+
+    /// @brief Residual norm at the last step tried
+    double norm_try { 0 };
+
+    /// @brief Norm of the last step tried
+    double step_norm { 0 };
+
+    /// @brief False if the inner loop short-circuited and the parameters did not move
+    bool accepted { false };
+
+    /// @brief Model evaluations made by the solver so far
+    size_t model_evaluations { 0 };
+
+    /// @brief Jacobian evaluations made by the solver so far
+    size_t jacobian_evaluations { 0 };
+
+    /// @brief Time spent evaluating the model at trial steps
+    std::chrono::nanoseconds model_time { 0 };
+
+    /// @brief Time spent forming the Jacobian.  Residual block models linearize and reduce
+    ///        in one pass, which is reported here.
+    std::chrono::nanoseconds jacobian_time { 0 };
+
+    /// @brief Time spent reducing the Jacobian to the normal equations
+    std::chrono::nanoseconds normal_equations_time { 0 };
+
+    /// @brief Time spent damping and solving the normal equations
+    std::chrono::nanoseconds solve_time { 0 };
+}; // End of LM_Iteration_Telemetry struct
+
+/**
+ * Default telemetry.  levenberg_marquardt() recognizes it and compiles out the clock reads
+ * and the record entirely.
+ */
+struct LM_No_Telemetry
+{
+    void operator()( const LM_Iteration_Telemetry& ) const {}
+}; // End of LM_No_Telemetry struct
+
+/**
+ * Telemetry which logs each iteration at debug level.  Only scalars are formatted.
+ */
+struct LM_Log_Telemetry
+{
+    void operator()( const LM_Iteration_Telemetry& record ) const
+    {
+        tmns::log::debug( "LM: iteration ", record.iteration,
+                          ", inner iterations ", record.inner_iterations,
+                          ", lambda ", record.lambda,
+                          ", norm ", record.norm_start, " -> ", record.norm_try,
+                          ", step ", record.step_norm,
+                          ( record.accepted ? "" : ", short-circuited" ) );
+    }
+}; // End of LM_Log_Telemetry struct
+
+/**
+ * Anything which can be called with each iteration's record
+ */
+template <typename TelemetryT>
+concept LM_Telemetry = std::invocable<TelemetryT&, const LM_Iteration_Telemetry&>;
+
+namespace detail {
+
+/**
+ * True unless the telemetry is the default no-op
+ */
+template <typename TelemetryT>
+inline constexpr bool lm_telemetry_enabled = !std::is_same_v<std::remove_cvref_t<TelemetryT>, LM_No_Telemetry>;
+
+/**
+ * Run func, adding its wall time to elapsed when EnabledV is set.  Otherwise this is a
+ * plain call, with no clock reads.
+ */
+template <bool EnabledV, typename FuncT>
+decltype(auto) lm_timed( std::chrono::nanoseconds& elapsed,
+                         FuncT&&                   func )
+{
+    if constexpr ( EnabledV )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        auto result = func();
+        elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start );
+        return result;
+    }
+    else
+    {
+        return func();
+    }
+}
+
+/**
+ * Unscaled Gauss-Newton normal equations J^T J and J^T error at x, where h0 = model( x ).
+ * Residual block models scatter their block Jacobians straight into them.  Otherwise the
+ * measurement Jacobian is formed and reduced in one fused pass, without forming its
+ * transpose.  h0 is handed to the Jacobian whenever the model accepts it, so the finite
+ * differences do not evaluate the model at x again.
+ */
+template <bool TimedV, typename ImplT>
+Result<void> gauss_newton_normal_equations( const ImplT&                        model,
+                                            const typename ImplT::domain_type& x,
+                                            const typename ImplT::result_type& h0,
+                                            const typename ImplT::result_type& error,
+                                            MatrixN<double>&                    hessian,
+                                            VectorN<double>&                    del_J,
+                                            LM_Iteration_Telemetry&             record )
+{
+    if constexpr ( Residual_Block_Model<ImplT> )
+    {
+        return lm_timed<TimedV>( record.jacobian_time, [&]()
+        {
+            return model.normal_equations( x, h0, error, hessian, del_J );
+        });
+    }
+    else
+    {
+        auto J = lm_timed<TimedV>( record.jacobian_time, [&]()
+        {
+            if constexpr ( requires { model.jacobian( x, h0 ); } )
+            {
+                return model.jacobian( x, h0 );
+            }
+            else
+            {
+                return model.jacobian( x );
+            }
+        });
+        return lm_timed<TimedV>( record.normal_equations_time, [&]()
+        {
+            return linalg::normal_equations<double>( J, error, hessian, del_J );
+        });
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Solve for the parameters, recording the work done in statistics and handing a record
+ * of every outer iteration to telemetry.
+ *
+ * The model is evaluated once at the seed and once per trial step.  The value at an
+ * accepted step is carried into the next outer iteration and reused as the nominal value
+ * of the Jacobian, so nothing is evaluated twice at the same point.
+ */
+template <typename ImplT, LM_Telemetry TelemetryT>
 Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Model_Base<ImplT>& least_squares_model,
                                                          const typename ImplT::domain_type&     seed,
                                                          const typename ImplT::result_type&     observation,
                                                          LM_STATUS_CODE&                        status,
+                                                         LM_Statistics&                         statistics,
+                                                         TelemetryT&&                           telemetry,
                                                          double                                 abs_tolerance  = MATH_LM_ABS_TOL,
                                                          double                                 rel_tolerance  = MATH_LM_REL_TOL,
                                                          double                                 max_iterations = MATH_LM_MAX_ITER)
 {
+    constexpr bool TELEMETRY = detail::lm_telemetry_enabled<TelemetryT>;
+
     // Initialize the status
-    status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+    status     = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+    statistics = LM_Statistics();
 
     const ImplT& model = least_squares_model.impl();
     bool   done   = false;
@@ -66,19 +268,19 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
     double lambda = 0.1;
 
     typename ImplT::domain_type x_try, x = seed;
+    MatrixN<double> hessian;
+    VectorN<double> del_J;
     typename ImplT::result_type h        = model(x);
     typename ImplT::result_type error    = model.difference(observation, h);
+    typename ImplT::result_type h_try, error_try;
     double norm_start = error.magnitude();
-
-    tmns::log::debug( "LM: initial guess for the model is ", seed.to_log_string() );
-    tmns::log::trace( "LM: starting error ", error.to_log_string() );
-    tmns::log::debug( "LM: starting norm is: ", norm_start );
+    statistics.model_evaluations++;
+    statistics.initial_norm = norm_start;
 
     // Solution may already be good enough
     if( norm_start < abs_tolerance )
     {
         status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-        tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
         done = true;
     }
 
@@ -87,92 +289,101 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
     {
         bool shortCircuit = false;
         outer_iter++;
-        tmns::log::debug( "LM: outer iteration ", outer_iter, "   x = ", x.to_log_string() );
-
-        // Compute the value, derivative, and hessian of the cost function
-        // at the current point.  These remain valid until the parameter
-        // vector changes.
 
-        // expected measurement with new x
-        h = model(x);
+        [[maybe_unused]] LM_Iteration_Telemetry record;
 
-        // Difference between observed and predicted and error (2-norm of difference)
-        error = model.difference( observation, h );
+        // Compute the derivative and hessian of the cost function at the current point.
+        // h and error already hold the model at x, either from the seed or carried over
+        // from the accepted step, and remain valid until the parameter vector changes.
         norm_start = error.magnitude();
-        tmns::log::debug( ADD_CURRENT_LOC(),
-                          "LM: outer iteration starting robust norm: ",
-                          norm_start );
 
-        // @todo:  Fix matrix multiplication problem.
-
-        // Measurement Jacobian
-        typename ImplT::jacobian_type J = model.jacobian(x);
-
-        MatrixN<double> JT = transpose( J );
-        VectorN<double> JTE = (JT * error);
-        VectorN<double> RJ = Rinv * JTE;
-        VectorN<double> del_J = -1.0 * RJ;
-
-        // Hessian of cost function (using Gauss-Newton approximation)
-        MatrixN<double> TJ = transpose( J );
-        MatrixN<double> TJJ = TJ * J;
-
-        MatrixN<double> hessian = Rinv * TJJ;
-        tmns::log::trace( ADD_CURRENT_LOC(), "hessian: ", hessian.to_log_string() );
+        // Gradient and Hessian of cost function (using Gauss-Newton approximation)
+        auto normal_res = detail::gauss_newton_normal_equations<TELEMETRY>( model, x, h, error, hessian, del_J, record );
+        statistics.jacobian_evaluations++;
+        if( normal_res.has_error() )
+        {
+            return normal_res.error();
+        }
+        for( size_t i = 0; i < del_J.size(); i++ )
+        {
+            del_J[i] *= -Rinv;
+        }
+        std::transform( hessian.data(), hessian.data() + hessian.rows() * hessian.cols(),
+                        hessian.data(), [=]( double v ){ return Rinv * v; } );
 
         int64_t iterations = 0;
         double norm_try = norm_start + 1.0;
         while( norm_try > norm_start )
         {
-            tmns::log::trace( ADD_CURRENT_LOC(), "Norm Try: ", norm_try, ", Norm Start: ", norm_start );
-            // Increase diagonal elements to dynamically mix gradient
-            // descent and Gauss-Newton.
-            Matrix<double> hessian_lm = hessian;
-            for( unsigned i = 0; i < hessian_lm.rows(); ++i )
+            if constexpr ( TELEMETRY )
             {
-                hessian_lm(i,i) += hessian_lm(i,i)*lambda + lambda;
+                record.lambda = lambda;
             }
 
-            // Solve for update
-            typename ImplT::domain_type delta_x;
-            if( hessian_lm.rows() <= 2 && hessian_lm.determinant() > 0.0 )
-            {
-                // Direct method is more efficient for small matrices, also
-                // here we avoid calling LAPACK which we've seen misbehave
-                // in this situation in a multi-threaded environment.
-                delta_x = hessian_lm.inverse() * del_J;
-            }
-            else
+            auto solve_res = detail::lm_timed<TELEMETRY>( record.solve_time, [&]() -> Result<typename ImplT::domain_type>
             {
-                try
+                // Increase diagonal elements to dynamically mix gradient
+                // descent and Gauss-Newton.
+                Matrix<double> hessian_lm = hessian;
+                for( unsigned i = 0; i < hessian_lm.rows(); ++i )
                 {
-                    // By construction, hessian_lm is symmetric and positive-definite.
-                    auto solve_res = linalg::solve_symmetric( hessian_lm, del_J );
-                    delta_x = solve_res.value();
+                    hessian_lm(i,i) += hessian_lm(i,i)*lambda + lambda;
                 }
-                catch ( const std::exception& e )
+
+                // Solve for update
+                typename ImplT::domain_type delta_x;
+                if( hessian_lm.rows() <= 2 && hessian_lm.determinant() > 0.0 )
                 {
-                    // If lambda is very small, the matrix becomes numerically
-                    // singular. In that case use the more general least_squares solver.
-                    auto solve_res = linalg::solve( hessian_lm, del_J );
-                    if( solve_res.has_error() )
+                    // Direct method is more efficient for small matrices, also
+                    // here we avoid calling LAPACK which we've seen misbehave
+                    // in this situation in a multi-threaded environment.
+                    delta_x = hessian_lm.inverse() * del_J;
+                }
+                else
+                {
+                    try
+                    {
+                        // By construction, hessian_lm is symmetric and positive-definite.
+                        auto symmetric_res = linalg::solve_symmetric( hessian_lm, del_J );
+                        delta_x = symmetric_res.value();
+                    }
+                    catch ( const std::exception& e )
                     {
-                        return solve_res.error();
+                        // If lambda is very small, the matrix becomes numerically
+                        // singular. In that case use the more general least_squares solver.
+                        auto general_res = linalg::solve( hessian_lm, del_J );
+                        if( general_res.has_error() )
+                        {
+                            return general_res.error();
+                        }
+                        delta_x = general_res.value();
                     }
-                    delta_x = solve_res.value();
                 }
+                return delta_x;
+            });
+            if( solve_res.has_error() )
+            {
+                return solve_res.error();
             }
+            const auto& delta_x = solve_res.value();
 
             // update parameter vector
             x_try = x - delta_x;
 
-            typename ImplT::result_type h_try = model(x_try);
+            h_try = detail::lm_timed<TELEMETRY>( record.model_time, [&]()
+            {
+                return model(x_try);
+            });
+            statistics.model_evaluations++;
 
-            typename ImplT::result_type error_try = model.difference(observation, h_try);
+            error_try = model.difference(observation, h_try);
             norm_try = error_try.magnitude();
 
-            tmns::log::debug( ADD_CURRENT_LOC(), "LM: inner iteration ", iterations, " error is ", error_try.to_log_string() );
-            tmns::log::trace( ADD_CURRENT_LOC(), "\tLM: inner iteration ", iterations, " norm is ", norm_try );
+            if constexpr ( TELEMETRY )
+            {
+                record.norm_try  = norm_try;
+                record.step_norm = delta_x.magnitude();
+            }
 
             if( norm_try > norm_start )
             {
@@ -181,13 +392,12 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
             }
 
             ++iterations; // Sanity check on iterations in this loop
+            statistics.inner_iterations++;
             if( iterations > 5 )
             {
-                tmns::log::debug( "\n****LM: too many inner iterations - short circuiting" );
                 shortCircuit = true;
                 norm_try     = norm_start;
             }
-            tmns::log::debug( "\tlambda = ", lambda );
         }
 
         // Percentage change convergence criterion. Only if we did not do a short-circuit,
@@ -195,7 +405,6 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
         if( !shortCircuit && ( ( norm_start - norm_try ) / norm_start ) < rel_tolerance )
         {
             status = LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO RELATIVE TOLERANCE" );
             done = true;
         }
 
@@ -203,14 +412,12 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
         if( norm_try < abs_tolerance )
         {
             status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
             done = true;
         }
 
         // Max iterations convergence criterion
         if( outer_iter >= max_iterations )
         {
-            tmns::log::debug( "REACHED MAX ITERATIONS!" );
             done = true;
         }
 
@@ -219,7 +426,20 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
         // better p, so don't update it.
         if( !shortCircuit )
         {
-            x = x_try;
+            x     = x_try;
+            h     = h_try;
+            error = error_try;
+        }
+
+        if constexpr ( TELEMETRY )
+        {
+            record.iteration            = outer_iter;
+            record.inner_iterations     = iterations;
+            record.norm_start           = norm_start;
+            record.accepted             = !shortCircuit;
+            record.model_evaluations    = statistics.model_evaluations;
+            record.jacobian_evaluations = statistics.jacobian_evaluations;
+            telemetry( record );
         }
 
         // Take trial error as new error
@@ -227,13 +447,46 @@ Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Mod
 
         // Decrease lambda
         lambda /= 10;
-        tmns::log::debug( "lambda = ", lambda, "\nLM: end of outer iteration ",
-                          outer_iter, " with error ", norm_try );
     }
-    tmns::log::debug( "LM: finished with: ", outer_iter );
+    statistics.outer_iterations = outer_iter;
+    statistics.final_norm       = error.magnitude();
     return x;
 } // End levenberg_marquardt
 
+/**
+ * As above, without telemetry
+ */
+template <typename ImplT>
+Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Model_Base<ImplT>& least_squares_model,
+                                                         const typename ImplT::domain_type&     seed,
+                                                         const typename ImplT::result_type&     observation,
+                                                         LM_STATUS_CODE&                        status,
+                                                         LM_Statistics&                         statistics,
+                                                         double                                 abs_tolerance  = MATH_LM_ABS_TOL,
+                                                         double                                 rel_tolerance  = MATH_LM_REL_TOL,
+                                                         double                                 max_iterations = MATH_LM_MAX_ITER)
+{
+    return levenberg_marquardt( least_squares_model, seed, observation, status, statistics,
+                                LM_No_Telemetry(), abs_tolerance, rel_tolerance, max_iterations );
+}
+
+/**
+ * As above, without the statistics
+ */
+template <typename ImplT>
+Result<typename ImplT::domain_type> levenberg_marquardt( const Least_Squares_Model_Base<ImplT>& least_squares_model,
+                                                         const typename ImplT::domain_type&     seed,
+                                                         const typename ImplT::result_type&     observation,
+                                                         LM_STATUS_CODE&                        status,
+                                                         double                                 abs_tolerance  = MATH_LM_ABS_TOL,
+                                                         double                                 rel_tolerance  = MATH_LM_REL_TOL,
+                                                         double                                 max_iterations = MATH_LM_MAX_ITER)
+{
+    LM_Statistics statistics;
+    return levenberg_marquardt( least_squares_model, seed, observation, status, statistics,
+                                abs_tolerance, rel_tolerance, max_iterations );
+}
+
 
 /**
  * As the similar class above, but with fixed matrix sizes and no logging.
@@ -264,49 +517,122 @@ class Least_Squares_Model_Base_Fixed
         template <class DomainT>
         Matrix<double, NO, NI> jacobian( DomainT const& x ) const
         {
-            // Get nominal function value
-            //std::cout << "x; = " << x << std::endl;
-            //std::cout << "impl().operator()(x); = " << impl().operator()(x) << std::endl;
-            Vector_<double, NO> h0 = impl().operator()(x);
-            //Vector<double> h0 = impl().operator()(x);
-            //std::cout << "h0 = " << h0 << std::endl;
-
-            // Jacobian is #params x #outputs
-            Matrix<double, NO, NI> H;
-            //std::cout << "H = " << H << std::endl;
-
-            // For each param dimension, add epsilon and re-evaluate h() to
-            // get numerical derivative w.r.t. that parameter
-            Vector_<double, NO> hi;
-            for( unsigned i = 0; i < x.size(); ++i )
+            if constexpr ( Autodiff_Model<ImplT,DomainT> )
             {
-                DomainT xi = x;
-
-                // Variable step size, depending on parameter value
-                double epsilon = 1e-7 + fabs(xi(i)*1e-7);
-                xi(i) += epsilon;
+                Matrix<double, NO, NI> H;
+                autodiff_jacobian( impl(), x, H );
+                return H;
+            }
+            else
+            {
+                // Get nominal function value
+                return jacobian( x, Vector_<double, NO>( impl().operator()(x) ) );
+            }
+        }
 
-                // Evaluate function with this step and compute the derivative w.r.t. parameter i
-                hi = impl().operator()(xi);
-                //Vector<double> hi = impl().operator()(xi);
-                //std::cout << "hi = " << hi << std::endl;
-                select_col(H,i) = this->difference(hi,h0)/epsilon;
+        /**
+         * As jacobian( x ), reusing the nominal value h0 = model( x )
+         */
+        template <class DomainT,
+                  class ResultT>
+        Matrix<double, NO, NI> jacobian( DomainT const& x,
+                                         ResultT const& h0 ) const
+        {
+            Matrix<double, NO, NI> H;
+            if constexpr ( Autodiff_Model<ImplT,DomainT> )
+            {
+                autodiff_jacobian( impl(), x, H );
+            }
+            else
+            {
+                // Jacobian is #params x #outputs
+                finite_difference_jacobian( impl(), x, h0, H, m_jacobian_threads );
             }
-            //std::cout << "H = " << H << std::endl;
             return H;
         }
 
+        /**
+         * Number of threads for the finite-difference jacobian().  See Least_Squares_Model_Base.
+         */
+        void set_jacobian_threads( size_t num_threads )
+        {
+            m_jacobian_threads = num_threads;
+        }
+
+        /**
+         * Number of threads used by the finite-difference jacobian()
+         */
+        size_t jacobian_threads() const
+        {
+            return m_jacobian_threads;
+        }
+
         template <class T>
         T difference( const T& a,
                       const T& b ) const
         {
             return ( a - b );
         }
+
+    private:
+
+        /// @brief Worker threads for the finite-difference Jacobian
+        size_t m_jacobian_threads { 1 };
+
 }; // End LeastSquaresModelBaseSQ
 
 
+namespace detail {
+
+/**
+ * Scaled gradient -scale * J^T e and Gauss-Newton Hessian scale * J^T J of a fixed-size
+ * problem, on the stack, from one pass over J.
+ */
+template <int      NO,
+          int      NI,
+          typename ErrorT>
+void fixed_normal_equations( const Matrix<double, NO, NI>& J,
+                             const ErrorT&                 error,
+                             double                        scale,
+                             Matrix<double, NI, NI>&       hessian,
+                             Vector_<double, NI>&          del_J )
+{
+    std::array<double, NO> e;
+    for( size_t r = 0; r < NO; r++ )
+    {
+        e[r] = error[r];
+    }
+
+    double* H = hessian.data();
+    double* g = del_J.data().data();
+    std::fill( H, H + NI * NI, 0.0 );
+    std::fill( g, g + NI, 0.0 );
+    linalg::accumulate_normal_equations( J.data(), NI, e.data(), 0, NO, H, g );
+
+    for( size_t i = 0; i < NI; i++ )
+    {
+        g[i] *= -scale;
+        for( size_t k = i; k < NI; k++ )
+        {
+            const double v = scale * H[i * NI + k];
+            H[i * NI + k] = v;
+            H[k * NI + i] = v;
+        }
+    }
+}
+
+} // End of detail namespace
+
 /**
- * As the similar function above, but with a fixed, square matrix size.
+ * As the similar function above, but with compile-time sizes.
+ *
+ * Every intermediate is a fixed-size Matrix or Vector_, the normal equations are formed in
+ * place and the damped system is solved with the unrolled stack Cholesky from
+ * fixed_size_solvers.hpp (falling back to the unrolled LU), so an iteration performs no
+ * heap allocation, no logging and throws nothing, provided the model's own operator() and
+ * jacobian() don't.  A damped system which is numerically singular is treated like a
+ * rejected step and retried with a larger lambda.  As in levenberg_marquardt(), the model
+ * value at an accepted step is carried forward and reused by the Jacobian.
  */
 template <typename ImplT,
           int      NI,
@@ -315,137 +641,100 @@ Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squar
                                                                const typename ImplT::domain_type&                   seed,
                                                                const typename ImplT::result_type&                   observation,
                                                                LM_STATUS_CODE&                                      status,
+                                                               LM_Statistics&                                       statistics,
                                                                double abs_tolerance = MATH_LM_ABS_TOL,
                                                                double rel_tolerance = MATH_LM_REL_TOL,
                                                                double max_iterations = MATH_LM_MAX_ITER) {
 
-    status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+    using domain_type = typename ImplT::domain_type;
+    using result_type = typename ImplT::result_type;
+
+    status     = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+    statistics = LM_Statistics();
 
     const ImplT& model = least_squares_model.impl();
     bool   done   = false;
     double Rinv   = 10;
     double lambda = 0.1;
 
-    typename ImplT::domain_type x_try, x = seed;
-    typename ImplT::result_type h = model(x);
-    typename ImplT::result_type error = model.difference(observation, h);
+    domain_type x_try, x = seed;
+    result_type h = model(x);
+    result_type error = model.difference(observation, h);
+    result_type h_try, error_try;
     double norm_start = error.magnitude();
-
-    tmns::log::debug( "LM: initial guess for the model is ", seed.to_log_string() );
-    tmns::log::debug( "LM: starting error ", error.to_log_string() );
-    tmns::log::debug( "LM: starting norm is: ", norm_start );
+    statistics.model_evaluations++;
+    statistics.initial_norm = norm_start;
 
     // Solution may already be good enough
     if( norm_start < abs_tolerance )
     {
         status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-        tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
         done = true;
     }
 
-    typename ImplT::jacobian_type J;
-    Matrix<double, NI, NO> J_trans;
-    Matrix<double, NI, NI> J_trans_J;
-    Vector_<double, NI> del_J;
-    Matrix<double, NI, NI> hessian, hessian_lm, hessian_lm_inv;
+    Matrix<double, NO, NI> J;
+    Matrix<double, NI, NI> hessian, hessian_lm;
+    Vector_<double, NI>    del_J, delta_x;
 
-    tmns::log::debug( "Start of loops" );
     int outer_iter = 0;
     while( !done )
     {
         bool shortCircuit = false;
         outer_iter++;
-        tmns::log::debug( "LM: outer iteration ", outer_iter, "   x = ", x.to_log_string() );
-
-        // Compute the value, derivative, and hessian of the cost function
-        // at the current point.  These remain valid until the parameter
-        // vector changes.
-
-        // expected measurement with new x
-        h = model(x);
 
-        // Difference between observed and predicted and error (2-norm of difference)
-        error = model.difference( observation, h );
+        // Compute the derivative and hessian of the cost function at the current point.
+        // h and error already hold the model at x.
         norm_start = error.magnitude();
-        tmns::log::debug( ADD_CURRENT_LOC(),
-                          "LM: outer iteration starting robust norm: ",
-                          norm_start );
 
         // Measurement Jacobian
-        J = model.jacobian(x);
-
-        tmns::log::trace( "J: ", J.to_log_string() );
-
-        J_trans = transpose( J );
-        tmns::log::trace( "J Transpose: ", J_trans.to_log_string() );
-
-        del_J = -1.0 * Rinv * ( J_trans * error );
-        //Vector<double> del_J = -1.0 * Rinv * (J_trans * error);
-        //std::cout << "del_J = " << del_J << std::endl;
-
-        // Hessian of cost function (using Gauss-Newton approximation)
-        J_trans_J = J_trans * J;
-        //std::cout << "J_trans_J = " << J_trans_J << std::endl;
-        hessian = Rinv * J_trans_J;
-        //Matrix<double> hessian = Rinv * J_trans_J;
+        if constexpr ( requires { model.jacobian( x, h ); } )
+        {
+            J = model.jacobian( x, h );
+        }
+        else
+        {
+            J = model.jacobian( x );
+        }
+        statistics.jacobian_evaluations++;
 
-        //std::cout << "hessian = " << hessian << std::endl;
+        // Gradient and Hessian of cost function (using Gauss-Newton approximation)
+        detail::fixed_normal_equations<NO, NI>( J, error, Rinv, hessian, del_J );
 
         int iterations = 0;
         double norm_try = norm_start+1.0;
         while (norm_try > norm_start)
         {
-
             // Increase diagonal elements to dynamically mix gradient
             // descent and Gauss-Newton.
             hessian_lm = hessian;
-            //Matrix<double> hessian_lm = hessian;
-            for( unsigned i = 0; i < hessian_lm.rows(); ++i )
+            for( size_t i = 0; i < NI; ++i )
             {
                 hessian_lm(i,i) += hessian_lm(i,i)*lambda + lambda;
             }
 
-            // Solve for update
-            typename ImplT::domain_type delta_x;
-            if( hessian_lm.rows() <= 2 && hessian_lm.determinant() > 0.0 )
-            {
-                // Direct method is more efficient for small matrices, also
-                // here we avoid calling LAPACK which we've seen misbehave
-                // in this situation in a multi-threaded environment.
-                delta_x = hessian_lm.inverse() * del_J;
-            }
-            else
+            // By construction, hessian_lm is symmetric and positive-definite.  If lambda is
+            // very small it can become numerically indefinite, so fall back to LU.
+            auto solve_status = linalg::cholesky_solve( hessian_lm, del_J, delta_x );
+            if( solve_status != linalg::Solve_Status::SUCCESS )
             {
-                try
-                {
-                    // By construction, hessian_lm is symmetric and positive-definite.
-                    auto solve_res = linalg::solve_symmetric( hessian_lm, del_J );
-                    delta_x = solve_res.value();
-                }
-                catch( const std::exception& e )
-                {
-                    // If lambda is very small, the matrix becomes numerically
-                    // singular. In that case use the more general least_squares solver.
-                    auto solve_res = linalg::solve( hessian_lm, del_J );
-                    if( solve_res.has_error() )
-                    {
-                        return outcome::fail( (error::Error_Code)(solve_res.error().code().value()),
-                                              solve_res.error().message() );
-                    }
-                    delta_x = solve_res.value();
-                }
+                solve_status = linalg::lu_solve( hessian_lm, del_J, delta_x );
             }
 
-            // update parameter vector
-            x_try = x - delta_x;
-
-            typename ImplT::result_type h_try = model(x_try);
+            if( solve_status == linalg::Solve_Status::SUCCESS )
+            {
+                // update parameter vector
+                x_try = x - delta_x;
 
-            typename ImplT::result_type error_try = model.difference(observation, h_try);
-            norm_try = error_try.magnitude();
+                h_try = model(x_try);
+                statistics.model_evaluations++;
 
-            tmns::log::debug( ADD_CURRENT_LOC(), "LM: inner iteration ", iterations, " error is ", error_try.to_log_string() );
-            tmns::log::trace( ADD_CURRENT_LOC(), "\tLM: inner iteration ", iterations, " norm is ", norm_try );
+                error_try = model.difference(observation, h_try);
+                norm_try = error_try.magnitude();
+            }
+            else
+            {
+                norm_try = std::numeric_limits<double>::infinity();
+            }
 
             if( norm_try > norm_start )
             {
@@ -454,14 +743,13 @@ Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squar
             }
 
             ++iterations; // Sanity check on iterations in this loop
+            statistics.inner_iterations++;
 
             if( iterations > 5 )
             {
-                tmns::log::debug( "\n****LM: too many inner iterations - short circuiting" );
                 shortCircuit = true;
                 norm_try     = norm_start;
             }
-            tmns::log::debug( "\tlambda = ", lambda );
         }
 
         // Percentage change convergence criterion. Only if we did not do a short-circuit,
@@ -469,7 +757,6 @@ Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squar
         if( !shortCircuit && ( ( norm_start-norm_try ) / norm_start ) < rel_tolerance )
         {
             status = LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO RELATIVE TOLERANCE" );
             done = true;
         }
 
@@ -477,14 +764,12 @@ Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squar
         if( norm_try < abs_tolerance )
         {
             status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
-            tmns::log::debug( "CONVERGED TO ABSOLUTE TOLERANCE" );
             done = true;
         }
 
         // Max iterations convergence criterion
         if( outer_iter >= max_iterations )
         {
-            tmns::log::debug( "REACHED MAX ITERATIONS!" );
             done = true;
         }
 
@@ -493,7 +778,9 @@ Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squar
         // better p, so don't update it.
         if( !shortCircuit )
         {
-            x = x_try;
+            x     = x_try;
+            h     = h_try;
+            error = error_try;
         }
 
         // Take trial error as new error
@@ -501,13 +788,31 @@ Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squar
 
         // Decrease lambda
         lambda /= 10;
-        tmns::log::debug( "lambda = ", lambda );
-        tmns::log::debug( "LM: end of outer iteration ", outer_iter, " with error ", norm_try );
     }
 
-    tmns::log::debug( "LM: finished with: ", outer_iter );
-    return outcome::ok<typename ImplT::domain_type>( x );
+    statistics.outer_iterations = outer_iter;
+    statistics.final_norm       = error.magnitude();
+    return outcome::ok<domain_type>( x );
 
 } // End levenberg_marquardt
 
+/**
+ * As above, without the statistics
+ */
+template <typename ImplT,
+          int      NI,
+          int      NO>
+Result<typename ImplT::domain_type> levenberg_marquardt_fixed( const Least_Squares_Model_Base_Fixed<ImplT, NI, NO>& least_squares_model,
+                                                               const typename ImplT::domain_type&                   seed,
+                                                               const typename ImplT::result_type&                   observation,
+                                                               LM_STATUS_CODE&                                      status,
+                                                               double abs_tolerance = MATH_LM_ABS_TOL,
+                                                               double rel_tolerance = MATH_LM_REL_TOL,
+                                                               double max_iterations = MATH_LM_MAX_ITER)
+{
+    LM_Statistics statistics;
+    return levenberg_marquardt_fixed( least_squares_model, seed, observation, status, statistics,
+                                      abs_tolerance, rel_tolerance, max_iterations );
+}
+
 } // End of tmns::math::optimize
\ No newline at end of file
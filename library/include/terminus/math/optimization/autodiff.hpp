@@ -0,0 +1,128 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    autodiff.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/types/jet.hpp>
+#include <terminus/math/vector/vector.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <type_traits>
+
+namespace tmns::math::optimize {
+
+/**
+ * Maps a domain type onto the same container of jets.  Fixed-size domains get fixed-size
+ * jets, dynamic domains get dynamic jets.  Specialize this for custom domain types which
+ * should support automatic differentiation.
+ */
+template <typename DomainT>
+struct Jet_Domain {};
+
+template <typename ValueT>
+struct Jet_Domain<VectorN<ValueT>>
+{
+    using jet_type = Jet<ValueT>;
+    using type     = VectorN<jet_type>;
+
+    static type seed( const VectorN<ValueT>& x )
+    {
+        type result( x.size() );
+        for( size_t i = 0; i < x.size(); i++ )
+        {
+            result[i] = jet_type( x[i], i, x.size() );
+        }
+        return result;
+    }
+}; // End of Jet_Domain struct
+
+template <typename ValueT,
+          size_t   N>
+struct Jet_Domain<Vector_<ValueT,N>>
+{
+    using jet_type = Jet<ValueT,N>;
+    using type     = Vector_<jet_type,N>;
+
+    static type seed( const Vector_<ValueT,N>& x )
+    {
+        type result;
+        for( size_t i = 0; i < N; i++ )
+        {
+            result[i] = jet_type( x[i], i );
+        }
+        return result;
+    }
+}; // End of Jet_Domain struct
+
+/**
+ * A model whose operator() is templated on its scalar type, so it can be evaluated on jets.
+ * Models taking only plain scalars fail the check on the result element type and fall back
+ * to finite differences.
+ */
+template <typename ModelT,
+          typename DomainT>
+concept Autodiff_Model = requires( const ModelT& model,
+                                   const typename Jet_Domain<DomainT>::type& x )
+{
+    requires Is_Jet<typename std::remove_cvref_t<decltype( model( x ) )>::value_type>::value;
+};
+
+namespace detail {
+
+/**
+ * Dynamic Jacobians are sized from the first evaluation, fixed-size ones already are
+ */
+template <typename ValueT>
+void resize_jacobian( MatrixN<ValueT>& J,
+                      size_t           rows,
+                      size_t           cols )
+{
+    J.set_size( rows, cols );
+}
+
+template <typename JacobianT>
+void resize_jacobian( JacobianT&, size_t, size_t )
+{
+}
+
+} // End of detail namespace
+
+/**
+ * Evaluate the model once on jets seeded at x and copy the gradients into the rows of
+ * the Jacobian (#outputs x #params).
+ */
+template <typename ModelT,
+          typename DomainT,
+          typename JacobianT>
+    requires Autodiff_Model<ModelT,DomainT>
+void autodiff_jacobian( const ModelT&  model,
+                        const DomainT& x,
+                        JacobianT&     J )
+{
+    const auto h = model( Jet_Domain<DomainT>::seed( x ) );
+    detail::resize_jacobian( J, h.size(), x.size() );
+    for( size_t r = 0; r < h.size(); r++ )
+    {
+        const auto& gradient = h[r].gradient();
+        for( size_t c = 0; c < x.size(); c++ )
+        {
+            J( r, c ) = c < gradient.size() ? gradient[c] : 0;
+        }
+    }
+}
+
+} // End of tmns::math::optimize namespace
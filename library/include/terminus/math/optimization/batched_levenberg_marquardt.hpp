@@ -0,0 +1,163 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    batched_levenberg_marquardt.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/optimization/levenburg_marquardt.hpp>
+#include <terminus/math/parallel_for.hpp>
+
+// C++ Libraries
+#include <span>
+#include <string>
+
+namespace tmns::math::optimize {
+
+/**
+ * Execution and convergence controls for the batched Levenberg-Marquardt solvers
+ */
+struct Batch_LM_Options
+{
+    /// @brief Number of worker threads.  Zero uses the hardware concurrency.
+    size_t num_threads { 0 };
+
+    /// @brief Number of problems handed to a worker at a time
+    size_t grain_size { 64 };
+
+    /// @brief Absolute tolerance passed to every solve
+    double abs_tolerance { MATH_LM_ABS_TOL };
+
+    /// @brief Relative tolerance passed to every solve
+    double rel_tolerance { MATH_LM_REL_TOL };
+
+    /// @brief Maximum outer iterations of every solve
+    double max_iterations { MATH_LM_MAX_ITER };
+}; // End of Batch_LM_Options struct
+
+namespace detail {
+
+/**
+ * Check that the seed, observation, solution and status spans of a batch agree
+ */
+inline Result<void> check_lm_batch_sizes( size_t num_seeds,
+                                          size_t num_observations,
+                                          size_t num_solutions,
+                                          size_t num_status )
+{
+    if( num_observations != num_seeds || num_solutions != num_seeds || num_status != num_seeds )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Batch size mismatch. Seeds: " + std::to_string( num_seeds ) +
+                              ", observations: " + std::to_string( num_observations ) +
+                              ", solutions: " + std::to_string( num_solutions ) +
+                              ", status: " + std::to_string( num_status ) );
+    }
+    return outcome::ok();
+}
+
+} // End of detail namespace
+
+/**
+ * Solve a batch of independent fixed-size problems which share one model,
+ * levenberg_marquardt_fixed( model, seeds[p], observations[p] ) for every p.
+ *
+ * Problems are dealt out grain_size at a time from a shared counter by parallel_for, so
+ * workers which draw problems that converge quickly keep taking more instead of waiting on
+ * a static partition.  Each solve runs entirely on the stack, so workers never contend on
+ * the allocator.  solutions[p] and status[p] receive the result of problem p, independent
+ * of the thread count.
+ *
+ * With more than one thread the model's operator() and jacobian() must be safe to call
+ * concurrently.  Leave the model's own jacobian threads at one, the batch is the parallel
+ * dimension.
+ */
+template <typename ImplT,
+          int      NI,
+          int      NO>
+Result<void> batch_levenberg_marquardt_fixed( const Least_Squares_Model_Base_Fixed<ImplT, NI, NO>& model,
+                                              std::span<const typename ImplT::domain_type>         seeds,
+                                              std::span<const typename ImplT::result_type>         observations,
+                                              std::span<typename ImplT::domain_type>               solutions,
+                                              std::span<LM_STATUS_CODE>                            status,
+                                              const Batch_LM_Options&                              options = Batch_LM_Options() )
+{
+    auto res = detail::check_lm_batch_sizes( seeds.size(), observations.size(), solutions.size(), status.size() );
+    if( res.has_error() )
+    {
+        return res;
+    }
+
+    parallel_for( seeds.size(), options.num_threads, options.grain_size,
+                  [&]( size_t begin, size_t end, size_t )
+    {
+        for( size_t p = begin; p < end; p++ )
+        {
+            auto solution = levenberg_marquardt_fixed( model, seeds[p], observations[p], status[p],
+                                                       options.abs_tolerance,
+                                                       options.rel_tolerance,
+                                                       options.max_iterations );
+            solutions[p] = solution.value();
+        }
+    });
+
+    return outcome::ok();
+}
+
+/**
+ * Dynamic-size counterpart of batch_levenberg_marquardt_fixed().
+ *
+ * A problem whose solve fails (for example a singular damped system) gets
+ * ERROR_STATUS_UNKNOWN and its seed as the solution, and does not affect the rest of the
+ * batch.
+ */
+template <typename ImplT>
+Result<void> batch_levenberg_marquardt( const Least_Squares_Model_Base<ImplT>&       model,
+                                        std::span<const typename ImplT::domain_type> seeds,
+                                        std::span<const typename ImplT::result_type> observations,
+                                        std::span<typename ImplT::domain_type>       solutions,
+                                        std::span<LM_STATUS_CODE>                    status,
+                                        const Batch_LM_Options&                      options = Batch_LM_Options() )
+{
+    auto res = detail::check_lm_batch_sizes( seeds.size(), observations.size(), solutions.size(), status.size() );
+    if( res.has_error() )
+    {
+        return res;
+    }
+
+    parallel_for( seeds.size(), options.num_threads, options.grain_size,
+                  [&]( size_t begin, size_t end, size_t )
+    {
+        for( size_t p = begin; p < end; p++ )
+        {
+            auto solution = levenberg_marquardt( model, seeds[p], observations[p], status[p],
+                                                 options.abs_tolerance,
+                                                 options.rel_tolerance,
+                                                 options.max_iterations );
+            if( solution.has_error() )
+            {
+                status[p]    = LM_STATUS_CODE::ERROR_STATUS_UNKNOWN;
+                solutions[p] = seeds[p];
+            }
+            else
+            {
+                solutions[p] = solution.value();
+            }
+        }
+    });
+
+    return outcome::ok();
+}
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,251 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    block_least_squares_model_base.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/log/utility.hpp>
+#include <terminus/math/optimization/least_squares_model_base.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * One residual block of a two-block-type problem:  a measurement which depends on exactly
+ * one pose block and one landmark block.
+ */
+struct Residual_Block
+{
+    /// @brief Index of the pose block
+    size_t pose { 0 };
+
+    /// @brief Index of the landmark block
+    size_t landmark { 0 };
+}; // End of Residual_Block struct
+
+/**
+ * Base for least squares problems with two kinds of parameter blocks, poses of PoseDim
+ * parameters and landmarks of LandmarkDim parameters, where every measurement of
+ * ResidualDim values depends on one pose and one landmark.  This is the structure of
+ * bundle adjustment, and it is what levenberg_marquardt_schur() exploits.
+ *
+ * The parameter vector stacks all the poses followed by all the landmarks, and the result
+ * vector stacks the residual blocks in declaration order.  The model is also an ordinary
+ * Least_Squares_Model_Base, so small instances can still be handed to levenberg_marquardt().
+ *
+ * Using CRTP, the derived class provides:
+ *
+ * - size_t num_poses() const;
+ * - size_t num_landmarks() const;
+ *
+ * - const std::vector<Residual_Block>& residual_blocks() const;
+ *   declaring which pose and landmark every measurement depends on.
+ *
+ * - block_result_type evaluate_block( size_t               block,
+ *                                     const pose_type&     pose,
+ *                                     const landmark_type& landmark ) const;
+ *   the predicted measurement of one residual block.
+ *
+ * - Optionally,
+ *
+ *       void block_jacobian( size_t                  block,
+ *                            const pose_type&        pose,
+ *                            const landmark_type&    landmark,
+ *                            pose_jacobian_type&     J_pose,
+ *                            landmark_jacobian_type& J_landmark ) const;
+ *
+ *   with the exact derivatives.  The default uses forward differences, which costs
+ *   PoseDim + LandmarkDim + 1 evaluations of the block.
+ */
+template <typename ImplT,
+          size_t   PoseDim,
+          size_t   LandmarkDim,
+          size_t   ResidualDim>
+class Block_Least_Squares_Model_Base : public Least_Squares_Model_Base<ImplT>
+{
+    public:
+
+        /// @brief Stacked residuals
+        using result_type = VectorN<double>;
+
+        /// @brief Stacked poses, then landmarks
+        using domain_type = VectorN<double>;
+
+        /// @brief Dense Jacobian, for use with levenberg_marquardt()
+        using jacobian_type = MatrixN<double>;
+
+        /// @brief Parameters of one pose
+        using pose_type = Vector_<double,PoseDim>;
+
+        /// @brief Parameters of one landmark
+        using landmark_type = Vector_<double,LandmarkDim>;
+
+        /// @brief Measurement of one residual block
+        using block_result_type = Vector_<double,ResidualDim>;
+
+        /// @brief Derivative of one block with respect to its pose
+        using pose_jacobian_type = Matrix<double,ResidualDim,PoseDim>;
+
+        /// @brief Derivative of one block with respect to its landmark
+        using landmark_jacobian_type = Matrix<double,ResidualDim,LandmarkDim>;
+
+        static constexpr size_t POSE_DIM     = PoseDim;
+        static constexpr size_t LANDMARK_DIM = LandmarkDim;
+        static constexpr size_t RESIDUAL_DIM = ResidualDim;
+
+        /**
+         * Length of the stacked parameter vector
+         */
+        size_t num_parameters() const
+        {
+            return this->impl().num_poses() * PoseDim + this->impl().num_landmarks() * LandmarkDim;
+        }
+
+        /**
+         * Length of the stacked result vector
+         */
+        size_t num_residuals() const
+        {
+            return this->impl().residual_blocks().size() * ResidualDim;
+        }
+
+        /**
+         * Offset of a landmark block in the stacked parameter vector
+         */
+        size_t landmark_offset( size_t landmark ) const
+        {
+            return this->impl().num_poses() * PoseDim + landmark * LandmarkDim;
+        }
+
+        /**
+         * Copy one pose out of the stacked parameter vector
+         */
+        pose_type pose( const domain_type& x,
+                        size_t             pose ) const
+        {
+            pose_type result;
+            std::copy_n( x.data().begin() + pose * PoseDim, PoseDim, result.data().begin() );
+            return result;
+        }
+
+        /**
+         * Copy one landmark out of the stacked parameter vector
+         */
+        landmark_type landmark( const domain_type& x,
+                                size_t             landmark ) const
+        {
+            landmark_type result;
+            std::copy_n( x.data().begin() + landmark_offset( landmark ), LandmarkDim, result.data().begin() );
+            return result;
+        }
+
+        /**
+         * Check the declared blocks against the block counts and a stacked parameter vector
+         */
+        Result<void> check_structure( const domain_type& x ) const
+        {
+            if( x.size() != num_parameters() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Parameter vector has " + std::to_string( x.size() )
+                                      + " entries, the model declares " + std::to_string( num_parameters() ) );
+            }
+            const auto& blocks = this->impl().residual_blocks();
+            for( size_t b = 0; b < blocks.size(); b++ )
+            {
+                if( blocks[b].pose >= this->impl().num_poses() ||
+                    blocks[b].landmark >= this->impl().num_landmarks() )
+                {
+                    return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                          "Residual block " + std::to_string( b ) + " references pose "
+                                          + std::to_string( blocks[b].pose ) + " and landmark "
+                                          + std::to_string( blocks[b].landmark ) + " which do not exist" );
+                }
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Evaluate every residual block into the stacked result.
+         *
+         * Throws std::runtime_error if check_structure( x ) fails.
+         */
+        result_type operator()( const domain_type& x ) const
+        {
+            auto res = check_structure( x );
+            if( res.has_error() )
+            {
+                tmns::log::error( res.error().message() );
+                throw std::runtime_error( res.error().message() );
+            }
+            const auto& blocks = this->impl().residual_blocks();
+            result_type h( blocks.size() * ResidualDim );
+            for( size_t b = 0; b < blocks.size(); b++ )
+            {
+                const block_result_type hb = this->impl().evaluate_block( b,
+                                                                          pose( x, blocks[b].pose ),
+                                                                          landmark( x, blocks[b].landmark ) );
+                std::copy_n( hb.data().begin(), ResidualDim, h.data().begin() + b * ResidualDim );
+            }
+            return h;
+        }
+
+        /**
+         * Forward-difference derivatives of one block with respect to its pose and landmark,
+         * with the same steps finite_difference_jacobian() takes on the stacked vector.
+         */
+        void block_jacobian( size_t                  block,
+                             const pose_type&        pose,
+                             const landmark_type&    landmark,
+                             pose_jacobian_type&     J_pose,
+                             landmark_jacobian_type& J_landmark ) const
+        {
+            const block_result_type h0 = this->impl().evaluate_block( block, pose, landmark );
+
+            pose_type pi = pose;
+            for( size_t i = 0; i < PoseDim; i++ )
+            {
+                const double epsilon = finite_difference_step( pose[i] );
+                pi[i] += epsilon;
+                const block_result_type diff = this->impl().difference( this->impl().evaluate_block( block, pi, landmark ), h0 );
+                for( size_t r = 0; r < ResidualDim; r++ )
+                {
+                    J_pose( r, i ) = diff[r] / epsilon;
+                }
+                pi[i] = pose[i];
+            }
+
+            landmark_type li = landmark;
+            for( size_t i = 0; i < LandmarkDim; i++ )
+            {
+                const double epsilon = finite_difference_step( landmark[i] );
+                li[i] += epsilon;
+                const block_result_type diff = this->impl().difference( this->impl().evaluate_block( block, pose, li ), h0 );
+                for( size_t r = 0; r < ResidualDim; r++ )
+                {
+                    J_landmark( r, i ) = diff[r] / epsilon;
+                }
+                li[i] = landmark[i];
+            }
+        }
+
+}; // End of Block_Least_Squares_Model_Base class
+
+} // End of tmns::math::optimize namespace
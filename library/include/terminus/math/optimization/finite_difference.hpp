@@ -0,0 +1,224 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    finite_difference.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/optimization/jacobian_sparsity.hpp>
+#include <terminus/math/parallel_for.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Forward-difference step for a parameter with the given value
+ */
+inline double finite_difference_step( double value )
+{
+    return 1e-7 + std::fabs( value * 1e-7 );
+}
+
+/**
+ * Fill H (#outputs x #params, already sized) with forward differences of the model about x.
+ *
+ * Each column needs one model evaluation.  The columns are shared out over num_threads
+ * workers (zero means the hardware concurrency) with parallel_for.  Every worker perturbs
+ * and restores one entry of its own copy of x, then writes its column straight into H, so
+ * nothing is copied per column and no two workers touch the same entry of H.  With more
+ * than one thread the model's operator() must be safe to call concurrently.
+ *
+ * @param h0  Model value at x, as returned by model( x )
+ */
+template <typename ModelT,
+          typename DomainT,
+          typename ResultT,
+          typename JacobianT>
+void finite_difference_jacobian( const ModelT&  model,
+                                 const DomainT& x,
+                                 const ResultT& h0,
+                                 JacobianT&     H,
+                                 size_t         num_threads = 1 )
+{
+    const size_t num_params  = x.size();
+    const size_t num_workers = resolve_thread_count( num_threads, num_params );
+
+    auto difference_columns = [&]( DomainT& xi,
+                                   size_t   begin,
+                                   size_t   end )
+    {
+        for( size_t i = begin; i < end; i++ )
+        {
+            // Variable step size, depending on parameter value
+            const auto   nominal = xi( i );
+            const double epsilon = finite_difference_step( nominal );
+            xi( i ) += epsilon;
+
+            // Evaluate function with this step and compute the derivative w.r.t. parameter i
+            const ResultT hi   = model( xi );
+            const ResultT diff = model.difference( hi, h0 );
+            for( size_t r = 0; r < diff.size(); r++ )
+            {
+                H( r, i ) = diff[r] / epsilon;
+            }
+            xi( i ) = nominal;
+        }
+    };
+
+    // Serial case stays on the stack for fixed-size domains
+    if( num_workers == 1 )
+    {
+        DomainT xi = x;
+        difference_columns( xi, 0, num_params );
+        return;
+    }
+
+    std::vector<DomainT> workspace( num_workers, x );
+    parallel_for( num_params, num_workers, 1, [&]( size_t begin, size_t end, size_t worker )
+    {
+        difference_columns( workspace[worker], begin, end );
+    });
+}
+
+namespace detail {
+
+/**
+ * Shared driver for the colored finite differences.  store( row, col, value ) receives
+ * every structurally nonzero entry exactly once.
+ */
+template <typename ModelT,
+          typename DomainT,
+          typename ResultT,
+          typename StoreFuncT>
+Result<void> colored_finite_difference( const ModelT&            model,
+                                        const DomainT&           x,
+                                        const ResultT&           h0,
+                                        const Jacobian_Sparsity& pattern,
+                                        const Column_Coloring&   coloring,
+                                        size_t                   num_threads,
+                                        StoreFuncT&&             store )
+{
+    if( pattern.rows() != h0.size() || pattern.cols() != x.size() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Jacobian sparsity pattern is " + std::to_string( pattern.rows() ) + " x "
+                              + std::to_string( pattern.cols() ) + ", model Jacobian is "
+                              + std::to_string( h0.size() ) + " x " + std::to_string( x.size() ) );
+    }
+    if( coloring.color.size() != x.size() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Column coloring has " + std::to_string( coloring.color.size() )
+                              + " columns, expected " + std::to_string( x.size() ) );
+    }
+
+    const auto   col_rows    = pattern.column_rows();
+    const size_t num_colors  = coloring.num_colors();
+    const size_t num_workers = resolve_thread_count( num_threads, num_colors );
+
+    std::vector<DomainT> workspace( num_workers, x );
+    parallel_for( num_colors, num_workers, 1, [&]( size_t begin, size_t end, size_t worker )
+    {
+        DomainT& xi = workspace[worker];
+        std::vector<double> steps;
+        for( size_t color = begin; color < end; color++ )
+        {
+            // Perturb the whole group at once.  No two of its columns share a row.
+            const auto& group = coloring.groups[color];
+            steps.resize( group.size() );
+            for( size_t g = 0; g < group.size(); g++ )
+            {
+                steps[g] = finite_difference_step( x( group[g] ) );
+                xi( group[g] ) += steps[g];
+            }
+
+            const ResultT hi   = model( xi );
+            const ResultT diff = model.difference( hi, h0 );
+            for( size_t g = 0; g < group.size(); g++ )
+            {
+                const size_t col = group[g];
+                for( const auto row : col_rows[col] )
+                {
+                    store( row, col, diff[row] / steps[g] );
+                }
+                xi( col ) = x( col );
+            }
+        }
+    });
+    return outcome::ok();
+}
+
+} // End of detail namespace
+
+/**
+ * Fill a dense H (#outputs x #params, already sized and zeroed) by colored finite differences.
+ *
+ * Every group of structurally orthogonal columns from the coloring is perturbed together, so
+ * this needs coloring.num_colors() evaluations instead of one per parameter.  Each entry is
+ * read back from the single output row the pattern says it affects.  Entries outside the
+ * pattern are left untouched.  The groups are spread over num_threads workers as in
+ * finite_difference_jacobian().
+ *
+ * @param h0  Model value at x, as returned by model( x )
+ */
+template <typename ModelT,
+          typename DomainT,
+          typename ResultT,
+          typename JacobianT>
+Result<void> colored_finite_difference_jacobian( const ModelT&            model,
+                                                 const DomainT&           x,
+                                                 const ResultT&           h0,
+                                                 const Jacobian_Sparsity& pattern,
+                                                 const Column_Coloring&   coloring,
+                                                 JacobianT&               H,
+                                                 size_t                   num_threads = 1 )
+{
+    return detail::colored_finite_difference( model, x, h0, pattern, coloring, num_threads,
+                                              [&]( size_t row, size_t col, double value )
+    {
+        H( row, col ) = value;
+    });
+}
+
+/**
+ * Colored finite differences straight into compressed-row storage.  J is rebuilt on the
+ * pattern if it was built for a different size.
+ */
+template <typename ModelT,
+          typename DomainT,
+          typename ResultT>
+Result<void> colored_finite_difference_jacobian( const ModelT&            model,
+                                                 const DomainT&           x,
+                                                 const ResultT&           h0,
+                                                 const Jacobian_Sparsity& pattern,
+                                                 const Column_Coloring&   coloring,
+                                                 Sparse_Jacobian&         J,
+                                                 size_t                   num_threads = 1 )
+{
+    if( J.rows() != pattern.rows() || J.cols() != pattern.cols() || J.nonzeros() != pattern.nonzeros() )
+    {
+        J = Sparse_Jacobian( pattern );
+    }
+    return detail::colored_finite_difference( model, x, h0, pattern, coloring, num_threads,
+                                              [&]( size_t row, size_t col, double value )
+    {
+        J.values()[J.find( row, col )] = value;
+    });
+}
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,527 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    jacobian_sparsity.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/matrix/matrixn.hpp>
+#include <terminus/math/vector/vectorn.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <concepts>
+#include <atomic>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Column coloring of a Jacobian.  Columns sharing a color never have a nonzero in the same
+ * row, so they can be perturbed together in one finite-difference evaluation.
+ */
+struct Column_Coloring
+{
+    /// @brief Color of each column
+    std::vector<size_t> color;
+
+    /// @brief Columns of each color, in increasing order
+    std::vector<std::vector<size_t>> groups;
+
+    /**
+     * Number of colors, which is the number of perturbed model evaluations needed
+     */
+    size_t num_colors() const
+    {
+        return groups.size();
+    }
+
+}; // End of Column_Coloring struct
+
+/**
+ * Nonzero pattern of a Jacobian (#outputs x #params), stored as the sorted list of
+ * parameters each output depends on.
+ *
+ * coloring() memoizes color_columns() until the next add(), so a model returning the same
+ * pattern from every jacobian_sparsity() call colors it once.  Copies start with an empty
+ * cache.
+ */
+class Jacobian_Sparsity
+{
+    public:
+
+        /**
+         * Default Constructor.  Empty 0 x 0 pattern.
+         */
+        Jacobian_Sparsity() = default;
+
+        /**
+         * Empty pattern of the given size
+         */
+        Jacobian_Sparsity( size_t rows,
+                           size_t cols )
+            : m_cols( cols ),
+              m_row_columns( rows )
+        {
+        }
+
+        /**
+         * Copy Constructor.  Copies the pattern but not the cached coloring.
+         */
+        Jacobian_Sparsity( const Jacobian_Sparsity& rhs )
+            : m_cols( rhs.m_cols ),
+              m_row_columns( rhs.m_row_columns )
+        {
+        }
+
+        /**
+         * Move Constructor.  Moves the pattern but not the cached coloring.
+         */
+        Jacobian_Sparsity( Jacobian_Sparsity&& rhs ) noexcept
+            : m_cols( rhs.m_cols ),
+              m_row_columns( std::move( rhs.m_row_columns ) )
+        {
+            rhs.invalidate_coloring();
+        }
+
+        /**
+         * Copy Assignment
+         */
+        Jacobian_Sparsity& operator = ( const Jacobian_Sparsity& rhs )
+        {
+            if( this != &rhs )
+            {
+                m_cols        = rhs.m_cols;
+                m_row_columns = rhs.m_row_columns;
+                invalidate_coloring();
+            }
+            return (*this);
+        }
+
+        /**
+         * Move Assignment
+         */
+        Jacobian_Sparsity& operator = ( Jacobian_Sparsity&& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                m_cols        = rhs.m_cols;
+                m_row_columns = std::move( rhs.m_row_columns );
+                invalidate_coloring();
+                rhs.invalidate_coloring();
+            }
+            return (*this);
+        }
+
+        /**
+         * Mark J(row,col) as structurally nonzero
+         */
+        Result<void> add( size_t row,
+                          size_t col )
+        {
+            if( row >= rows() || col >= cols() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Jacobian entry (" + std::to_string( row ) + ", " + std::to_string( col )
+                                      + ") is outside the " + std::to_string( rows() ) + " x "
+                                      + std::to_string( cols() ) + " pattern" );
+            }
+            auto& columns = m_row_columns[row];
+            auto  pos     = std::lower_bound( columns.begin(), columns.end(), col );
+            if( pos == columns.end() || *pos != col )
+            {
+                columns.insert( pos, col );
+                invalidate_coloring();
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Mark every listed parameter as affecting output row
+         */
+        Result<void> add( size_t                        row,
+                          std::initializer_list<size_t> cols )
+        {
+            for( const auto col : cols )
+            {
+                auto res = add( row, col );
+                if( res.has_error() )
+                {
+                    return res;
+                }
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Number of outputs
+         */
+        size_t rows() const
+        {
+            return m_row_columns.size();
+        }
+
+        /**
+         * Number of parameters
+         */
+        size_t cols() const
+        {
+            return m_cols;
+        }
+
+        /**
+         * Number of structural nonzeros
+         */
+        size_t nonzeros() const
+        {
+            size_t count = 0;
+            for( const auto& columns : m_row_columns )
+            {
+                count += columns.size();
+            }
+            return count;
+        }
+
+        /**
+         * Sorted parameters output row depends on
+         */
+        const std::vector<size_t>& row_columns( size_t row ) const
+        {
+            return m_row_columns[row];
+        }
+
+        /**
+         * Check if J(row,col) is structurally nonzero
+         */
+        bool contains( size_t row,
+                       size_t col ) const
+        {
+            const auto& columns = m_row_columns[row];
+            return std::binary_search( columns.begin(), columns.end(), col );
+        }
+
+        /**
+         * Outputs each parameter affects, the transpose of the stored pattern
+         */
+        std::vector<std::vector<size_t>> column_rows() const
+        {
+            std::vector<std::vector<size_t>> result( m_cols );
+            for( size_t r = 0; r < rows(); r++ )
+            {
+                for( const auto c : m_row_columns[r] )
+                {
+                    result[c].push_back( r );
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Greedy Curtis-Powell-Reid column coloring.
+         *
+         * Columns are visited in order of decreasing nonzero count (largest first), and each
+         * takes the smallest color not already used by a column sharing one of its rows.
+         * For banded and block-local patterns this is at or near the optimal count.
+         */
+        Column_Coloring color_columns() const
+        {
+            const auto col_rows = column_rows();
+
+            std::vector<size_t> order( m_cols );
+            std::iota( order.begin(), order.end(), size_t( 0 ) );
+            std::stable_sort( order.begin(), order.end(), [&]( size_t a, size_t b )
+            {
+                return col_rows[a].size() > col_rows[b].size();
+            });
+
+            constexpr size_t UNCOLORED = std::numeric_limits<size_t>::max();
+            Column_Coloring coloring;
+            coloring.color.assign( m_cols, UNCOLORED );
+
+            // forbidden[c] == j marks color c as taken by a neighbor of column j
+            std::vector<size_t> forbidden( m_cols + 1, UNCOLORED );
+            for( const auto j : order )
+            {
+                for( const auto r : col_rows[j] )
+                {
+                    for( const auto k : m_row_columns[r] )
+                    {
+                        if( coloring.color[k] != UNCOLORED )
+                        {
+                            forbidden[coloring.color[k]] = j;
+                        }
+                    }
+                }
+                size_t c = 0;
+                while( forbidden[c] == j )
+                {
+                    c++;
+                }
+                coloring.color[j] = c;
+                if( c == coloring.groups.size() )
+                {
+                    coloring.groups.emplace_back();
+                }
+            }
+
+            for( size_t j = 0; j < m_cols; j++ )
+            {
+                coloring.groups[coloring.color[j]].push_back( j );
+            }
+            return coloring;
+        }
+
+        /**
+         * color_columns(), computed on the first call after the pattern last changed.
+         *
+         * Safe to call from several threads at once.  The reference stays valid until the
+         * next add() or assignment.
+         */
+        const Column_Coloring& coloring() const
+        {
+            if( !m_coloring_valid.load( std::memory_order_acquire ) )
+            {
+                std::lock_guard<std::mutex> lock( m_coloring_mutex );
+                if( !m_coloring_valid.load( std::memory_order_relaxed ) )
+                {
+                    m_coloring = color_columns();
+                    m_coloring_valid.store( true, std::memory_order_release );
+                }
+            }
+            return *m_coloring;
+        }
+
+    private:
+
+        /**
+         * Drop the cached coloring.  Only called with exclusive access to the pattern.
+         */
+        void invalidate_coloring()
+        {
+            m_coloring_valid.store( false, std::memory_order_relaxed );
+            m_coloring.reset();
+        }
+
+        /// @brief Number of parameters
+        size_t m_cols { 0 };
+
+        /// @brief Sorted nonzero columns of each row
+        std::vector<std::vector<size_t>> m_row_columns;
+
+        /// @brief Memoized color_columns()
+        mutable std::optional<Column_Coloring> m_coloring;
+
+        /// @brief Set once m_coloring matches the pattern
+        mutable std::atomic<bool> m_coloring_valid { false };
+
+        /// @brief Serializes the first coloring() after a change
+        mutable std::mutex m_coloring_mutex;
+
+}; // End of Jacobian_Sparsity class
+
+/**
+ * Jacobian values in compressed-row form on a fixed Jacobian_Sparsity pattern.
+ *
+ * Provides apply() and apply_transpose(), so it can be handed directly to the matrix-free
+ * least squares solvers in linalg/iterative_solvers.hpp.
+ */
+class Sparse_Jacobian
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = double;
+
+        /**
+         * Default Constructor
+         */
+        Sparse_Jacobian() = default;
+
+        /**
+         * Zero-valued Jacobian on the given pattern
+         */
+        explicit Sparse_Jacobian( const Jacobian_Sparsity& pattern )
+            : m_cols( pattern.cols() ),
+              m_row_start( pattern.rows() + 1, 0 )
+        {
+            for( size_t r = 0; r < pattern.rows(); r++ )
+            {
+                const auto& columns = pattern.row_columns( r );
+                m_col_index.insert( m_col_index.end(), columns.begin(), columns.end() );
+                m_row_start[r+1] = m_col_index.size();
+            }
+            m_values.assign( m_col_index.size(), 0 );
+        }
+
+        /**
+         * Number of outputs
+         */
+        size_t rows() const
+        {
+            return m_row_start.empty() ? 0 : m_row_start.size() - 1;
+        }
+
+        /**
+         * Number of parameters
+         */
+        size_t cols() const
+        {
+            return m_cols;
+        }
+
+        /**
+         * Number of stored entries
+         */
+        size_t nonzeros() const
+        {
+            return m_values.size();
+        }
+
+        /**
+         * Offset of the first stored entry of each row, plus the total at the end
+         */
+        const std::vector<size_t>& row_start() const
+        {
+            return m_row_start;
+        }
+
+        /**
+         * Column of each stored entry
+         */
+        const std::vector<size_t>& col_index() const
+        {
+            return m_col_index;
+        }
+
+        /**
+         * Stored entries in row order
+         */
+        const std::vector<double>& values() const
+        {
+            return m_values;
+        }
+
+        /**
+         * Writable stored entries
+         */
+        std::vector<double>& values()
+        {
+            return m_values;
+        }
+
+        /**
+         * Position of J(row,col) in values(), or nonzeros() if it is not stored
+         */
+        size_t find( size_t row,
+                     size_t col ) const
+        {
+            const auto begin = m_col_index.begin() + m_row_start[row];
+            const auto end   = m_col_index.begin() + m_row_start[row+1];
+            const auto pos   = std::lower_bound( begin, end, col );
+            return ( pos != end && *pos == col ) ? size_t( pos - m_col_index.begin() ) : nonzeros();
+        }
+
+        /**
+         * J(row,col), zero outside the pattern
+         */
+        double operator()( size_t row,
+                           size_t col ) const
+        {
+            const size_t e = find( row, col );
+            return e < nonzeros() ? m_values[e] : 0;
+        }
+
+        /**
+         * Expand to a dense matrix
+         */
+        MatrixN<double> to_dense() const
+        {
+            MatrixN<double> result( rows(), cols() );
+            for( size_t r = 0; r < rows(); r++ )
+            {
+                for( size_t e = m_row_start[r]; e < m_row_start[r+1]; e++ )
+                {
+                    result( r, m_col_index[e] ) = m_values[e];
+                }
+            }
+            return result;
+        }
+
+        /**
+         * y = J * x
+         */
+        void apply( const VectorN<double>& x,
+                    VectorN<double>&       y ) const
+        {
+            for( size_t r = 0; r < rows(); r++ )
+            {
+                double s = 0;
+                for( size_t e = m_row_start[r]; e < m_row_start[r+1]; e++ )
+                {
+                    s += m_values[e] * x[m_col_index[e]];
+                }
+                y[r] = s;
+            }
+        }
+
+        /**
+         * y = J^T * x
+         */
+        void apply_transpose( const VectorN<double>& x,
+                              VectorN<double>&       y ) const
+        {
+            std::fill( y.begin(), y.end(), 0.0 );
+            for( size_t r = 0; r < rows(); r++ )
+            {
+                const double xr = x[r];
+                for( size_t e = m_row_start[r]; e < m_row_start[r+1]; e++ )
+                {
+                    y[m_col_index[e]] += m_values[e] * xr;
+                }
+            }
+        }
+
+    private:
+
+        /// @brief Number of parameters
+        size_t m_cols { 0 };
+
+        /// @brief Compressed-row offsets
+        std::vector<size_t> m_row_start;
+
+        /// @brief Column of each stored entry
+        std::vector<size_t> m_col_index;
+
+        /// @brief Stored entries
+        std::vector<double> m_values;
+
+}; // End of Sparse_Jacobian class
+
+/**
+ * A model which declares the nonzero pattern of its Jacobian through
+ * jacobian_sparsity(), enabling colored finite differences.
+ */
+template <typename ModelT>
+concept Sparse_Jacobian_Model = requires( const ModelT& model )
+{
+    { model.jacobian_sparsity() } -> std::convertible_to<const Jacobian_Sparsity&>;
+};
+
+} // End of tmns::math::optimize namespace
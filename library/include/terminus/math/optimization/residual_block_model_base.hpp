@@ -0,0 +1,689 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    residual_block_model_base.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/log/utility.hpp>
+#include <terminus/math/optimization/finite_difference.hpp>
+#include <terminus/math/optimization/jacobian_sparsity.hpp>
+#include <terminus/math/optimization/least_squares_model_base.hpp>
+#include <terminus/math/parallel_for.hpp>
+#include <terminus/math/types/jet.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * Declaration of one residual block:  how many residuals it produces and which parameter
+ * blocks it reads, in the order they are passed to evaluate_block().
+ */
+struct Residual_Block_Spec
+{
+    /// @brief Number of residuals produced by the block
+    size_t num_residuals { 0 };
+
+    /// @brief Indices of the parameter blocks the block depends on
+    std::vector<size_t> parameter_blocks;
+}; // End of Residual_Block_Spec struct
+
+/**
+ * Where every parameter block and residual block lives in the stacked vectors
+ */
+struct Residual_Block_Layout
+{
+    /// @brief Offset of each parameter block in the domain vector, plus the total at the end
+    std::vector<size_t> parameter_offset;
+
+    /// @brief Offset of each residual block in the result vector, plus the total at the end
+    std::vector<size_t> residual_offset;
+
+    /**
+     * Length of the stacked parameter vector
+     */
+    size_t num_parameters() const
+    {
+        return parameter_offset.empty() ? 0 : parameter_offset.back();
+    }
+
+    /**
+     * Length of the stacked result vector
+     */
+    size_t num_residuals() const
+    {
+        return residual_offset.empty() ? 0 : residual_offset.back();
+    }
+}; // End of Residual_Block_Layout struct
+
+/**
+ * A residual-block model whose evaluate_block() is templated on its scalar type, so block
+ * Jacobians can be computed on jets.
+ */
+template <typename ModelT>
+concept Autodiff_Block_Model = requires( const ModelT&                     model,
+                                         size_t                            block,
+                                         std::span<const Jet<double>* const> parameters,
+                                         std::span<Jet<double>>            residuals )
+{
+    model.evaluate_block( block, parameters, residuals );
+};
+
+/**
+ * A residual-block model which provides exact block Jacobians through block_jacobian()
+ */
+template <typename ModelT>
+concept Analytic_Block_Model = requires( const ModelT&                 model,
+                                         size_t                        block,
+                                         std::span<const double* const> parameters,
+                                         std::span<double>             jacobian )
+{
+    model.block_jacobian( block, parameters, jacobian );
+};
+
+/**
+ * Base for models made of many small residual blocks, each reading a declared subset of
+ * the parameter blocks.
+ *
+ * The domain vector stacks the parameter blocks and the result vector stacks the residual
+ * blocks, both in declaration order, so this is still a Least_Squares_Model_Base and works
+ * with levenberg_marquardt().  Knowing the block structure lets the base evaluate blocks in
+ * parallel, differentiate each one locally and assemble the Jacobian densely, in
+ * compressed-row form, or straight into the normal equations without ever forming J.
+ *
+ * Using CRTP, the derived class provides:
+ *
+ * - const std::vector<size_t>& parameter_block_sizes() const;
+ * - const std::vector<Residual_Block_Spec>& residual_blocks() const;
+ *
+ * - void evaluate_block( size_t                         block,
+ *                        std::span<const double* const> parameters,
+ *                        std::span<double>              residuals ) const;
+ *   where parameters[k] points at the values of the k-th declared parameter block.
+ *
+ * Each block Jacobian is a row-major #residuals x #local parameters matrix, with the
+ * columns of the declared parameter blocks side by side.  It comes from, in order of
+ * preference:
+ *
+ * - block_jacobian( block, parameters, jacobian ), if the derived class defines it.
+ * - Automatic differentiation, if evaluate_block() is templated on the scalar type
+ *   (see Autodiff_Block_Model).
+ * - Forward differences of evaluate_block(), one evaluation per local parameter.
+ *
+ * With more than one block thread, evaluate_block() and block_jacobian() must be safe to
+ * call concurrently.
+ */
+template <typename ImplT>
+class Residual_Block_Model_Base : public Least_Squares_Model_Base<ImplT>
+{
+    public:
+
+        /// @brief Stacked residuals
+        using result_type = VectorN<double>;
+
+        /// @brief Stacked parameter blocks
+        using domain_type = VectorN<double>;
+
+        /// @brief Dense Jacobian
+        using jacobian_type = MatrixN<double>;
+
+        /**
+         * Number of threads blocks are evaluated and differentiated on.  Zero uses the
+         * hardware concurrency.
+         */
+        void set_block_threads( size_t num_threads )
+        {
+            m_block_threads = num_threads;
+        }
+
+        /**
+         * Number of threads blocks are evaluated and differentiated on
+         */
+        size_t block_threads() const
+        {
+            return m_block_threads;
+        }
+
+        /**
+         * Offsets of the parameter and residual blocks
+         */
+        Residual_Block_Layout layout() const
+        {
+            const auto& sizes  = this->impl().parameter_block_sizes();
+            const auto& blocks = this->impl().residual_blocks();
+
+            Residual_Block_Layout result;
+            result.parameter_offset.resize( sizes.size() + 1, 0 );
+            for( size_t k = 0; k < sizes.size(); k++ )
+            {
+                result.parameter_offset[k+1] = result.parameter_offset[k] + sizes[k];
+            }
+            result.residual_offset.resize( blocks.size() + 1, 0 );
+            for( size_t b = 0; b < blocks.size(); b++ )
+            {
+                result.residual_offset[b+1] = result.residual_offset[b] + blocks[b].num_residuals;
+            }
+            return result;
+        }
+
+        /**
+         * Check that every residual block references existing parameter blocks and that x
+         * has the stacked size
+         */
+        Result<void> check_structure( const domain_type& x ) const
+        {
+            const auto& sizes  = this->impl().parameter_block_sizes();
+            const auto& blocks = this->impl().residual_blocks();
+            for( size_t b = 0; b < blocks.size(); b++ )
+            {
+                for( const auto k : blocks[b].parameter_blocks )
+                {
+                    if( k >= sizes.size() )
+                    {
+                        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                              "Residual block " + std::to_string( b ) + " references parameter block "
+                                              + std::to_string( k ) + " of " + std::to_string( sizes.size() ) );
+                    }
+                }
+            }
+            const size_t num_parameters = layout().num_parameters();
+            if( x.size() != num_parameters )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Parameter vector has " + std::to_string( x.size() )
+                                      + " entries, the model declares " + std::to_string( num_parameters ) );
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Evaluate every residual block into the stacked result, in parallel.
+         *
+         * Throws std::runtime_error if check_structure( x ) fails.
+         */
+        result_type operator()( const domain_type& x ) const
+        {
+            require_structure( x );
+            const auto layout_info = layout();
+            const auto& blocks     = this->impl().residual_blocks();
+
+            result_type h( layout_info.num_residuals() );
+            const size_t workers = resolve_thread_count( m_block_threads, blocks.size() );
+            std::vector<std::vector<const double*>> parameters( workers );
+            parallel_for( blocks.size(), workers, BLOCK_GRAIN_SIZE, [&]( size_t begin, size_t end, size_t worker )
+            {
+                auto& params = parameters[worker];
+                for( size_t b = begin; b < end; b++ )
+                {
+                    gather_parameters( layout_info, b, x, params );
+                    this->impl().evaluate_block( b,
+                                                 std::span<const double* const>( params ),
+                                                 std::span<double>( h.data().data() + layout_info.residual_offset[b],
+                                                                    blocks[b].num_residuals ) );
+                }
+            });
+            return h;
+        }
+
+        /**
+         * Nonzero pattern implied by the residual block declarations
+         */
+        Jacobian_Sparsity jacobian_sparsity() const
+        {
+            const auto layout_info = layout();
+            const auto& blocks     = this->impl().residual_blocks();
+
+            Jacobian_Sparsity pattern( layout_info.num_residuals(), layout_info.num_parameters() );
+            for( size_t b = 0; b < blocks.size(); b++ )
+            {
+                for( size_t r = layout_info.residual_offset[b]; r < layout_info.residual_offset[b+1]; r++ )
+                {
+                    for( const auto k : blocks[b].parameter_blocks )
+                    {
+                        for( size_t c = layout_info.parameter_offset[k]; c < layout_info.parameter_offset[k+1]; c++ )
+                        {
+                            (void)pattern.add( r, c );
+                        }
+                    }
+                }
+            }
+            return pattern;
+        }
+
+        /**
+         * Dense Jacobian, with every block differentiated locally and scattered into its
+         * rows.  Blocks own disjoint rows, so they are processed in parallel.
+         *
+         * Throws std::runtime_error if check_structure( x ) fails.
+         */
+        MatrixN<double> jacobian( const domain_type& x ) const
+        {
+            require_structure( x );
+            const auto layout_info = layout();
+            MatrixN<double> H( layout_info.num_residuals(), layout_info.num_parameters() );
+            double*      h    = H.data();
+            const size_t cols = H.cols();
+            linearize( layout_info, x, [&]( size_t row, size_t col, double value )
+            {
+                h[row * cols + col] += value;
+            });
+            return H;
+        }
+
+        /**
+         * Jacobian in compressed-row form on jacobian_sparsity(), scattered from the block
+         * Jacobians
+         */
+        Result<Sparse_Jacobian> sparse_jacobian( const domain_type& x ) const
+        {
+            auto res = check_structure( x );
+            if( res.has_error() )
+            {
+                return res.error();
+            }
+            const auto layout_info = layout();
+            Sparse_Jacobian J( jacobian_sparsity() );
+            linearize( layout_info, x, [&]( size_t row, size_t col, double value )
+            {
+                J.values()[J.find( row, col )] += value;
+            });
+            return outcome::ok<Sparse_Jacobian>( std::move( J ) );
+        }
+
+        /**
+         * Gauss-Newton normal equations JtJ = J^T J and Jte = J^T error, accumulated block by
+         * block without forming J.
+         *
+         * Each block adds its #local x #local outer product into JtJ at the rows and columns
+         * of its parameter blocks.  With several block threads, every worker owns a
+         * contiguous range of blocks and its own dense partial JtJ, and the partials are
+         * added in worker order, row ranges in parallel, so the result does not depend on
+         * scheduling.
+         *
+         * The partials cost 8 n^2 bytes per worker, so the worker count is capped to keep
+         * them within NORMAL_EQUATION_SCRATCH_BYTES.  Large models therefore accumulate on
+         * fewer threads (one, once a single n x n matrix exceeds the budget) rather than
+         * holding a copy of JtJ per thread.  JtJ and Jte are resized if needed.
+         */
+        Result<void> normal_equations( const domain_type&     x,
+                                       const result_type&     error,
+                                       MatrixN<double>&       JtJ,
+                                       VectorN<double>&       Jte ) const
+        {
+            return assemble_normal_equations( x, nullptr, error, JtJ, Jte );
+        }
+
+        /**
+         * As normal_equations( x, error, JtJ, Jte ), reusing the stacked model value
+         * h0 = model( x ) as the nominal value of the finite-difference block Jacobians
+         */
+        Result<void> normal_equations( const domain_type&     x,
+                                       const result_type&     h0,
+                                       const result_type&     error,
+                                       MatrixN<double>&       JtJ,
+                                       VectorN<double>&       Jte ) const
+        {
+            if( h0.size() != layout().num_residuals() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Nominal value has " + std::to_string( h0.size() ) + " entries, the model declares "
+                                      + std::to_string( layout().num_residuals() ) );
+            }
+            return assemble_normal_equations( x, &h0, error, JtJ, Jte );
+        }
+
+    private:
+
+        /**
+         * Throw if check_structure( x ) fails, for the entry points that do not return a Result
+         */
+        void require_structure( const domain_type& x ) const
+        {
+            auto res = check_structure( x );
+            if( res.has_error() )
+            {
+                tmns::log::error( res.error().message() );
+                throw std::runtime_error( res.error().message() );
+            }
+        }
+
+        /**
+         * Shared implementation of normal_equations().  h0 may be null.
+         */
+        Result<void> assemble_normal_equations( const domain_type& x,
+                                                const result_type* h0,
+                                                const result_type& error,
+                                                MatrixN<double>&   JtJ,
+                                                VectorN<double>&   Jte ) const
+        {
+            auto res = check_structure( x );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            const auto layout_info = layout();
+            const auto& blocks     = this->impl().residual_blocks();
+            const size_t n = layout_info.num_parameters();
+            if( error.size() != layout_info.num_residuals() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Residual has " + std::to_string( error.size() ) + " entries, the model declares "
+                                      + std::to_string( layout_info.num_residuals() ) );
+            }
+            if( JtJ.rows() != n || JtJ.cols() != n )
+            {
+                JtJ.set_size( n, n );
+            }
+            if( Jte.size() != n )
+            {
+                Jte = VectorN<double>( n );
+            }
+            std::fill( JtJ.data(), JtJ.data() + n * n, 0.0 );
+            std::fill( Jte.begin(), Jte.end(), 0.0 );
+
+            const size_t max_workers = std::max<size_t>( 1, NORMAL_EQUATION_SCRATCH_BYTES / std::max<size_t>( 1, n * n * sizeof(double) ) );
+            const size_t workers     = std::min( resolve_thread_count( m_block_threads, blocks.size() ), max_workers );
+            std::vector<Block_Workspace> workspace( workers );
+            auto accumulate = [&]( size_t begin, size_t end, Block_Workspace& ws, double* jtj, double* jte )
+            {
+                for( size_t b = begin; b < end; b++ )
+                {
+                    linearize_block( layout_info, b, x,
+                                     h0 ? h0->data().data() + layout_info.residual_offset[b] : nullptr, ws );
+
+                    // Global column of every local column
+                    ws.columns.clear();
+                    for( const auto k : blocks[b].parameter_blocks )
+                    {
+                        for( size_t c = layout_info.parameter_offset[k]; c < layout_info.parameter_offset[k+1]; c++ )
+                        {
+                            ws.columns.push_back( c );
+                        }
+                    }
+
+                    const size_t  m = blocks[b].num_residuals;
+                    const size_t  d = ws.columns.size();
+                    const double* e = error.data().data() + layout_info.residual_offset[b];
+                    for( size_t r = 0; r < m; r++ )
+                    {
+                        const double* row = ws.jacobian.data() + r * d;
+                        for( size_t a = 0; a < d; a++ )
+                        {
+                            if( row[a] == 0.0 )
+                            {
+                                continue;
+                            }
+                            const size_t ga = ws.columns[a];
+                            jte[ga] += row[a] * e[r];
+                            for( size_t c = 0; c < d; c++ )
+                            {
+                                const size_t gc = ws.columns[c];
+                                if( ga <= gc )
+                                {
+                                    jtj[ga * n + gc] += row[a] * row[c];
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            if( workers == 1 )
+            {
+                accumulate( 0, blocks.size(), workspace[0], JtJ.data(), Jte.data().data() );
+            }
+            else
+            {
+                std::vector<std::vector<double>> partial_JtJ( workers, std::vector<double>( n * n, 0.0 ) );
+                std::vector<std::vector<double>> partial_Jte( workers, std::vector<double>( n, 0.0 ) );
+                const size_t blocks_per_worker = ( blocks.size() + workers - 1 ) / workers;
+                parallel_for( workers, workers, 1, [&]( size_t begin, size_t end, size_t )
+                {
+                    for( size_t w = begin; w < end; w++ )
+                    {
+                        const size_t block_begin = std::min( blocks.size(), w * blocks_per_worker );
+                        const size_t block_end   = std::min( blocks.size(), block_begin + blocks_per_worker );
+                        accumulate( block_begin, block_end, workspace[w], partial_JtJ[w].data(), partial_Jte[w].data() );
+                    }
+                });
+
+                // Each row is summed over workers in worker order, rows in parallel
+                double* jtj = JtJ.data();
+                parallel_for( n, workers, 1, [&]( size_t begin, size_t end, size_t )
+                {
+                    for( size_t i = begin; i < end; i++ )
+                    {
+                        for( size_t w = 0; w < workers; w++ )
+                        {
+                            Jte[i] += partial_Jte[w][i];
+                            for( size_t j = i; j < n; j++ )
+                            {
+                                jtj[i * n + j] += partial_JtJ[w][i * n + j];
+                            }
+                        }
+                    }
+                });
+            }
+
+            // Mirror the upper triangle
+            double* jtj = JtJ.data();
+            for( size_t i = 0; i < n; i++ )
+            {
+                for( size_t j = i + 1; j < n; j++ )
+                {
+                    jtj[j * n + i] = jtj[i * n + j];
+                }
+            }
+            return outcome::ok();
+        }
+
+        /// @brief Residual blocks handed to a worker at a time
+        static constexpr size_t BLOCK_GRAIN_SIZE = 64;
+
+        /// @brief Budget for the per-worker partial JtJ matrices in normal_equations()
+        static constexpr size_t NORMAL_EQUATION_SCRATCH_BYTES = 64 * 1024 * 1024;
+
+        /**
+         * Per-worker scratch space for differentiating one block
+         */
+        struct Block_Workspace
+        {
+            /// @brief Local copy of the block's parameters
+            std::vector<double> values;
+
+            /// @brief Pointers to each declared parameter block
+            std::vector<const double*> parameters;
+
+            /// @brief Block residual at the nominal and perturbed parameters
+            std::vector<double> residual;
+            std::vector<double> perturbed;
+
+            /// @brief Row-major block Jacobian
+            std::vector<double> jacobian;
+
+            /// @brief Global column of each local column
+            std::vector<size_t> columns;
+
+            /// @brief Jet copies of the parameters and residuals for automatic differentiation
+            std::vector<Jet<double>>        jet_values;
+            std::vector<const Jet<double>*> jet_parameters;
+            std::vector<Jet<double>>        jet_residual;
+        }; // End of Block_Workspace struct
+
+        /**
+         * Point params at the parameter blocks of residual block b inside x
+         */
+        void gather_parameters( const Residual_Block_Layout&  layout_info,
+                                size_t                        b,
+                                const domain_type&            x,
+                                std::vector<const double*>&   params ) const
+        {
+            const auto& declared = this->impl().residual_blocks()[b].parameter_blocks;
+            params.resize( declared.size() );
+            for( size_t k = 0; k < declared.size(); k++ )
+            {
+                params[k] = x.data().data() + layout_info.parameter_offset[declared[k]];
+            }
+        }
+
+        /**
+         * Fill ws.jacobian with the Jacobian of block b at x.  If nominal is not null it holds
+         * the block's residuals at x, which the finite differences then do not re-evaluate.
+         */
+        void linearize_block( const Residual_Block_Layout& layout_info,
+                              size_t                       b,
+                              const domain_type&           x,
+                              const double*                nominal,
+                              Block_Workspace&             ws ) const
+        {
+            const auto&  block = this->impl().residual_blocks()[b];
+            const size_t m     = block.num_residuals;
+
+            // Local copy of the parameters, so they can be perturbed
+            ws.values.clear();
+            for( const auto k : block.parameter_blocks )
+            {
+                ws.values.insert( ws.values.end(),
+                                  x.data().begin() + layout_info.parameter_offset[k],
+                                  x.data().begin() + layout_info.parameter_offset[k+1] );
+            }
+            const size_t d = ws.values.size();
+            ws.jacobian.assign( m * d, 0.0 );
+
+            if constexpr ( Analytic_Block_Model<ImplT> )
+            {
+                gather_parameters( layout_info, b, x, ws.parameters );
+                this->impl().block_jacobian( b, std::span<const double* const>( ws.parameters ),
+                                             std::span<double>( ws.jacobian ) );
+            }
+            else if constexpr ( Autodiff_Block_Model<ImplT> )
+            {
+                ws.jet_values.resize( d );
+                for( size_t c = 0; c < d; c++ )
+                {
+                    ws.jet_values[c] = Jet<double>( ws.values[c], c, d );
+                }
+                ws.jet_parameters.resize( block.parameter_blocks.size() );
+                size_t offset = 0;
+                for( size_t k = 0; k < block.parameter_blocks.size(); k++ )
+                {
+                    const size_t pk = block.parameter_blocks[k];
+                    ws.jet_parameters[k] = ws.jet_values.data() + offset;
+                    offset += layout_info.parameter_offset[pk+1] - layout_info.parameter_offset[pk];
+                }
+                ws.jet_residual.assign( m, Jet<double>() );
+                this->impl().evaluate_block( b, std::span<const Jet<double>* const>( ws.jet_parameters ),
+                                             std::span<Jet<double>>( ws.jet_residual ) );
+                for( size_t r = 0; r < m; r++ )
+                {
+                    for( size_t c = 0; c < d; c++ )
+                    {
+                        ws.jacobian[r * d + c] = ws.jet_residual[r].derivative( c );
+                    }
+                }
+            }
+            else
+            {
+                ws.parameters.resize( block.parameter_blocks.size() );
+                size_t offset = 0;
+                for( size_t k = 0; k < block.parameter_blocks.size(); k++ )
+                {
+                    const size_t pk = block.parameter_blocks[k];
+                    ws.parameters[k] = ws.values.data() + offset;
+                    offset += layout_info.parameter_offset[pk+1] - layout_info.parameter_offset[pk];
+                }
+                const std::span<const double* const> params( ws.parameters );
+
+                ws.residual.resize( m );
+                ws.perturbed.resize( m );
+                if( nominal )
+                {
+                    std::copy_n( nominal, m, ws.residual.begin() );
+                }
+                else
+                {
+                    this->impl().evaluate_block( b, params, std::span<double>( ws.residual ) );
+                }
+                for( size_t c = 0; c < d; c++ )
+                {
+                    const double saved   = ws.values[c];
+                    const double epsilon = finite_difference_step( saved );
+                    ws.values[c] += epsilon;
+                    this->impl().evaluate_block( b, params, std::span<double>( ws.perturbed ) );
+                    for( size_t r = 0; r < m; r++ )
+                    {
+                        ws.jacobian[r * d + c] = ( ws.perturbed[r] - ws.residual[r] ) / epsilon;
+                    }
+                    ws.values[c] = saved;
+                }
+            }
+        }
+
+        /**
+         * Differentiate every block in parallel and hand each entry to store( row, col, value ).
+         * Blocks own disjoint rows, so concurrent stores never collide.
+         */
+        template <typename StoreFuncT>
+        void linearize( const Residual_Block_Layout& layout_info,
+                        const domain_type&           x,
+                        StoreFuncT&&                 store ) const
+        {
+            const auto&  blocks  = this->impl().residual_blocks();
+            const size_t workers = resolve_thread_count( m_block_threads, blocks.size() );
+            std::vector<Block_Workspace> workspace( workers );
+            parallel_for( blocks.size(), workers, BLOCK_GRAIN_SIZE, [&]( size_t begin, size_t end, size_t worker )
+            {
+                auto& ws = workspace[worker];
+                for( size_t b = begin; b < end; b++ )
+                {
+                    linearize_block( layout_info, b, x, nullptr, ws );
+                    const size_t d = ws.values.size();
+                    for( size_t r = 0; r < blocks[b].num_residuals; r++ )
+                    {
+                        const size_t row = layout_info.residual_offset[b] + r;
+                        size_t local = 0;
+                        for( const auto k : blocks[b].parameter_blocks )
+                        {
+                            for( size_t c = layout_info.parameter_offset[k]; c < layout_info.parameter_offset[k+1]; c++ )
+                            {
+                                store( row, c, ws.jacobian[r * d + local] );
+                                local++;
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        /// @brief Worker threads for block evaluation and differentiation
+        size_t m_block_threads { 1 };
+
+}; // End of Residual_Block_Model_Base class
+
+/**
+ * A model derived from Residual_Block_Model_Base, whose normal equations levenberg_marquardt()
+ * assembles block by block
+ */
+template <typename ModelT>
+concept Residual_Block_Model = std::derived_from<ModelT, Residual_Block_Model_Base<ModelT>>;
+
+} // End of tmns::math::optimize namespace
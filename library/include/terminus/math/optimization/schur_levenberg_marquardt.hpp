@@ -0,0 +1,462 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    schur_levenberg_marquardt.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/linalg/cholesky_decomposition.hpp>
+#include <terminus/math/linalg/fixed_size_solvers.hpp>
+#include <terminus/math/linalg/iterative_solvers.hpp>
+#include <terminus/math/linalg/linear_operator.hpp>
+#include <terminus/math/linalg/preconditioners.hpp>
+#include <terminus/math/optimization/block_least_squares_model_base.hpp>
+#include <terminus/math/optimization/levenburg_marquardt.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace tmns::math::optimize {
+
+/**
+ * How levenberg_marquardt_schur() solves the reduced camera system
+ */
+enum class Schur_Solver_Type
+{
+    /// @brief Dense Cholesky factorization of the Schur complement
+    DENSE_CHOLESKY,
+
+    /// @brief Jacobi-preconditioned conjugate gradients on the Schur complement
+    CONJUGATE_GRADIENT,
+}; // End of Schur_Solver_Type enum
+
+/**
+ * Solver and convergence controls for levenberg_marquardt_schur()
+ */
+struct Schur_LM_Options
+{
+    /// @brief Solver for the reduced camera system
+    Schur_Solver_Type reduced_solver { Schur_Solver_Type::DENSE_CHOLESKY };
+
+    /// @brief Stopping controls when reduced_solver is CONJUGATE_GRADIENT
+    linalg::Iterative_Solver_Options pcg_options;
+
+    /// @brief Absolute tolerance on the residual norm
+    double abs_tolerance { MATH_LM_ABS_TOL };
+
+    /// @brief Relative tolerance on the change in residual norm
+    double rel_tolerance { MATH_LM_REL_TOL };
+
+    /// @brief Maximum outer iterations
+    double max_iterations { MATH_LM_MAX_ITER };
+}; // End of Schur_LM_Options struct
+
+namespace detail {
+
+/**
+ * C (R x C) += scale * A^T B, for row-major A (K x R) and B (K x C)
+ */
+template <size_t K,
+          size_t R,
+          size_t C>
+void add_scaled_At_B( const double* A,
+                      const double* B,
+                      double        scale,
+                      double*       out )
+{
+    for( size_t k = 0; k < K; k++ )
+    {
+        for( size_t r = 0; r < R; r++ )
+        {
+            const double a = scale * A[k * R + r];
+            for( size_t c = 0; c < C; c++ )
+            {
+                out[r * C + c] += a * B[k * C + c];
+            }
+        }
+    }
+}
+
+/**
+ * Invert a small symmetric positive-definite block with the unrolled stack Cholesky
+ */
+template <size_t N>
+linalg::Solve_Status invert_spd_block( const Matrix<double,N,N>& A,
+                                       Matrix<double,N,N>&       A_inv )
+{
+    Vector_<double,N> e, column;
+    for( size_t c = 0; c < N; c++ )
+    {
+        std::fill( e.data().begin(), e.data().end(), 0.0 );
+        e.data()[c] = 1;
+        auto status = linalg::cholesky_solve( A, e, column );
+        if( status != linalg::Solve_Status::SUCCESS )
+        {
+            return status;
+        }
+        for( size_t r = 0; r < N; r++ )
+        {
+            A_inv.data()[r * N + c] = column.data()[r];
+        }
+    }
+    return linalg::Solve_Status::SUCCESS;
+}
+
+} // End of detail namespace
+
+/**
+ * Levenberg-Marquardt for pose / landmark problems, using the Schur complement.
+ *
+ * With the parameters split into poses p and landmarks l, the damped normal equations are
+ *
+ *     [ U    W ] [ dp ]   [ g_p ]
+ *     [ W^T  V ] [ dl ] = [ g_l ]
+ *
+ * where U and V are block diagonal, because every residual block touches one pose and one
+ * landmark.  Each LandmarkDim x LandmarkDim block of V is inverted on its own, which
+ * eliminates the landmarks and leaves the reduced camera system
+ *
+ *     ( U - W V^-1 W^T ) dp = g_p - W V^-1 g_l
+ *
+ * of size #poses * PoseDim.  It is solved by a dense Cholesky factorization or by
+ * preconditioned conjugate gradients, according to options.reduced_solver.  The landmarks
+ * are then recovered one at a time by back-substitution, dl = V^-1 ( g_l - W^T dp ).
+ * Nothing of size #parameters squared is ever formed, and the only dense matrix is the
+ * reduced system.
+ *
+ * Damping, step acceptance and the convergence tests follow levenberg_marquardt(), so for
+ * the same model the two produce the same iterates up to rounding.  A damped system which
+ * cannot be factored is treated as a rejected step.  Fails with INVALID_INPUT if the seed,
+ * observation or declared residual blocks do not match the model.
+ */
+template <typename ImplT,
+          size_t   PoseDim,
+          size_t   LandmarkDim,
+          size_t   ResidualDim>
+Result<VectorN<double>> levenberg_marquardt_schur( const Block_Least_Squares_Model_Base<ImplT,PoseDim,LandmarkDim,ResidualDim>& least_squares_model,
+                                                   const VectorN<double>& seed,
+                                                   const VectorN<double>& observation,
+                                                   LM_STATUS_CODE&        status,
+                                                   const Schur_LM_Options& options = Schur_LM_Options() )
+{
+    constexpr size_t P = PoseDim;
+    constexpr size_t L = LandmarkDim;
+    constexpr size_t R = ResidualDim;
+
+    using pose_block_type     = Matrix<double,P,P>;
+    using landmark_block_type = Matrix<double,L,L>;
+    using coupling_block_type = Matrix<double,P,L>;
+
+    status = LM_STATUS_CODE::ERROR_DID_NOT_CONVERGE;
+
+    const ImplT& model = least_squares_model.impl();
+    auto structure_res = least_squares_model.check_structure( seed );
+    if( structure_res.has_error() )
+    {
+        return structure_res.error();
+    }
+    if( observation.size() != least_squares_model.num_residuals() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Observation has " + std::to_string( observation.size() )
+                              + " entries, the model declares " + std::to_string( least_squares_model.num_residuals() ) );
+    }
+
+    const auto&  blocks        = model.residual_blocks();
+    const size_t num_poses     = model.num_poses();
+    const size_t num_landmarks = model.num_landmarks();
+    const size_t num_reduced   = num_poses * P;
+
+    // Residual blocks observing each landmark
+    std::vector<std::vector<size_t>> landmark_blocks( num_landmarks );
+    size_t max_degree = 0;
+    for( size_t b = 0; b < blocks.size(); b++ )
+    {
+        landmark_blocks[blocks[b].landmark].push_back( b );
+        max_degree = std::max( max_degree, landmark_blocks[blocks[b].landmark].size() );
+    }
+
+    // Normal equation blocks, reused every iteration
+    std::vector<pose_block_type>     U( num_poses );
+    std::vector<landmark_block_type> V( num_landmarks ), V_inv( num_landmarks );
+    std::vector<coupling_block_type> W( blocks.size() ), Y( max_degree );
+    VectorN<double> g_pose( num_reduced ), g_landmark( num_landmarks * L );
+    MatrixN<double> S( num_reduced, num_reduced );
+    VectorN<double> rhs( num_reduced ), delta_pose( num_reduced );
+    linalg::Cholesky_Decomposition<double>      cholesky;
+    linalg::Conjugate_Gradient_Solver<double>   pcg( options.pcg_options );
+    linalg::Jacobi_Preconditioner<double>       jacobi;
+
+    bool   done   = false;
+    double Rinv   = 10;
+    double lambda = 0.1;
+
+    VectorN<double> x_try, x = seed;
+    VectorN<double> error = model.difference( observation, model( x ) );
+    VectorN<double> error_try;
+    double norm_start = error.magnitude();
+
+    // Solution may already be good enough
+    if( norm_start < options.abs_tolerance )
+    {
+        status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
+        done = true;
+    }
+
+    typename ImplT::pose_jacobian_type     J_pose;
+    typename ImplT::landmark_jacobian_type J_landmark;
+
+    int outer_iter = 0;
+    while( !done )
+    {
+        bool shortCircuit = false;
+        outer_iter++;
+
+        // error holds the residual at x, from the seed or the accepted step
+        norm_start = error.magnitude();
+
+        // Accumulate the blocks of Rinv * J^T J and Rinv * J^T e
+        for( auto& block : U ) { std::fill( block.data(), block.data() + P * P, 0.0 ); }
+        for( auto& block : V ) { std::fill( block.data(), block.data() + L * L, 0.0 ); }
+        std::fill( g_pose.begin(), g_pose.end(), 0.0 );
+        std::fill( g_landmark.begin(), g_landmark.end(), 0.0 );
+        for( size_t b = 0; b < blocks.size(); b++ )
+        {
+            const size_t i = blocks[b].pose;
+            const size_t j = blocks[b].landmark;
+            model.block_jacobian( b,
+                                  least_squares_model.pose( x, i ),
+                                  least_squares_model.landmark( x, j ),
+                                  J_pose,
+                                  J_landmark );
+
+            const double* e = error.data().data() + b * R;
+            std::fill( W[b].data(), W[b].data() + P * L, 0.0 );
+            detail::add_scaled_At_B<R,P,P>( J_pose.data(),     J_pose.data(),     Rinv, U[i].data() );
+            detail::add_scaled_At_B<R,L,L>( J_landmark.data(), J_landmark.data(), Rinv, V[j].data() );
+            detail::add_scaled_At_B<R,P,L>( J_pose.data(),     J_landmark.data(), Rinv, W[b].data() );
+            detail::add_scaled_At_B<R,P,1>( J_pose.data(),     e, Rinv, g_pose.data().data() + i * P );
+            detail::add_scaled_At_B<R,L,1>( J_landmark.data(), e, Rinv, g_landmark.data().data() + j * L );
+        }
+
+        int iterations = 0;
+        double norm_try = norm_start + 1.0;
+        while( norm_try > norm_start )
+        {
+            bool factored = true;
+
+            // Invert the damped landmark blocks
+            for( size_t j = 0; j < num_landmarks && factored; j++ )
+            {
+                landmark_block_type V_lm = V[j];
+                for( size_t k = 0; k < L; k++ )
+                {
+                    V_lm( k, k ) += V_lm( k, k ) * lambda + lambda;
+                }
+                factored = detail::invert_spd_block<L>( V_lm, V_inv[j] ) == linalg::Solve_Status::SUCCESS;
+            }
+
+            if( factored )
+            {
+                // Reduced camera system, starting from the damped pose blocks
+                double* s = S.data();
+                std::fill( s, s + num_reduced * num_reduced, 0.0 );
+                for( size_t i = 0; i < num_poses; i++ )
+                {
+                    for( size_t r = 0; r < P; r++ )
+                    {
+                        for( size_t c = 0; c < P; c++ )
+                        {
+                            s[( i * P + r ) * num_reduced + i * P + c] = U[i]( r, c );
+                        }
+                        s[( i * P + r ) * num_reduced + i * P + r] += U[i]( r, r ) * lambda + lambda;
+                    }
+                }
+                rhs = g_pose;
+
+                // Eliminate each landmark:  S -= W V^-1 W^T and rhs -= W V^-1 g_l
+                for( size_t j = 0; j < num_landmarks; j++ )
+                {
+                    const auto&   observers = landmark_blocks[j];
+                    const double* vinv      = V_inv[j].data();
+                    const double* gl        = g_landmark.data().data() + j * L;
+                    for( size_t a = 0; a < observers.size(); a++ )
+                    {
+                        // Y_a = W_a V_j^-1
+                        const double* w  = W[observers[a]].data();
+                        double*       ya = Y[a].data();
+                        for( size_t r = 0; r < P; r++ )
+                        {
+                            for( size_t c = 0; c < L; c++ )
+                            {
+                                double sum = 0;
+                                for( size_t k = 0; k < L; k++ )
+                                {
+                                    sum += w[r * L + k] * vinv[k * L + c];
+                                }
+                                ya[r * L + c] = sum;
+                            }
+                        }
+
+                        const size_t ia = blocks[observers[a]].pose;
+                        for( size_t r = 0; r < P; r++ )
+                        {
+                            double sum = 0;
+                            for( size_t k = 0; k < L; k++ )
+                            {
+                                sum += ya[r * L + k] * gl[k];
+                            }
+                            rhs[ia * P + r] -= sum;
+                        }
+                    }
+
+                    for( size_t a = 0; a < observers.size(); a++ )
+                    {
+                        const size_t  ia = blocks[observers[a]].pose;
+                        const double* ya = Y[a].data();
+                        for( size_t c_obs = 0; c_obs < observers.size(); c_obs++ )
+                        {
+                            const size_t  ic = blocks[observers[c_obs]].pose;
+                            const double* wc = W[observers[c_obs]].data();
+                            for( size_t r = 0; r < P; r++ )
+                            {
+                                double* srow = s + ( ia * P + r ) * num_reduced + ic * P;
+                                for( size_t c = 0; c < P; c++ )
+                                {
+                                    double sum = 0;
+                                    for( size_t k = 0; k < L; k++ )
+                                    {
+                                        sum += ya[r * L + k] * wc[c * L + k];
+                                    }
+                                    srow[c] -= sum;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // Solve the reduced camera system
+                if( options.reduced_solver == Schur_Solver_Type::DENSE_CHOLESKY )
+                {
+                    factored = cholesky.compute( S ).has_value() &&
+                               cholesky.is_positive_definite() &&
+                               cholesky.solve( rhs, delta_pose ).has_value();
+                }
+                else
+                {
+                    std::fill( delta_pose.begin(), delta_pose.end(), 0.0 );
+                    jacobi.compute( S );
+                    factored = pcg.solve( linalg::Dense_Operator<MatrixN<double>>( S ), rhs, delta_pose, jacobi ).has_value();
+                }
+            }
+
+            if( factored )
+            {
+                // Update the poses, then back-substitute dl = V^-1 ( g_l - W^T dp )
+                x_try = x;
+                for( size_t k = 0; k < num_reduced; k++ )
+                {
+                    x_try[k] += delta_pose[k];
+                }
+                for( size_t j = 0; j < num_landmarks; j++ )
+                {
+                    std::array<double,L> reduced_gl;
+                    std::copy_n( g_landmark.data().begin() + j * L, L, reduced_gl.begin() );
+                    for( const auto b : landmark_blocks[j] )
+                    {
+                        const double* w  = W[b].data();
+                        const double* dp = delta_pose.data().data() + blocks[b].pose * P;
+                        for( size_t r = 0; r < P; r++ )
+                        {
+                            for( size_t k = 0; k < L; k++ )
+                            {
+                                reduced_gl[k] -= w[r * L + k] * dp[r];
+                            }
+                        }
+                    }
+                    const double* vinv   = V_inv[j].data();
+                    const size_t  offset = least_squares_model.landmark_offset( j );
+                    for( size_t r = 0; r < L; r++ )
+                    {
+                        double sum = 0;
+                        for( size_t k = 0; k < L; k++ )
+                        {
+                            sum += vinv[r * L + k] * reduced_gl[k];
+                        }
+                        x_try[offset + r] += sum;
+                    }
+                }
+
+                error_try = model.difference( observation, model( x_try ) );
+                norm_try  = error_try.magnitude();
+            }
+            else
+            {
+                norm_try = std::numeric_limits<double>::infinity();
+            }
+
+            if( norm_try > norm_start )
+            {
+                // Increase lambda and try again
+                lambda *= 10;
+            }
+
+            ++iterations; // Sanity check on iterations in this loop
+            if( iterations > 5 )
+            {
+                shortCircuit = true;
+                norm_try     = norm_start;
+            }
+        }
+
+        // Percentage change convergence criterion. Only if we did not do a short-circuit,
+        // as in that case the solution did not improve.
+        if( !shortCircuit && ( ( norm_start - norm_try ) / norm_start ) < options.rel_tolerance )
+        {
+            status = LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE;
+            done = true;
+        }
+
+        // Absolute error convergence criterion
+        if( norm_try < options.abs_tolerance )
+        {
+            status = LM_STATUS_CODE::ERROR_CONVERGED_ABS_TOLERANCE;
+            done = true;
+        }
+
+        // Max iterations convergence criterion
+        if( outer_iter >= options.max_iterations )
+        {
+            done = true;
+        }
+
+        // Take trial parameters as new parameters, unless the inner loop short-circuited
+        if( !shortCircuit )
+        {
+            x     = x_try;
+            error = error_try;
+        }
+        norm_start = norm_try;
+
+        // Decrease lambda
+        lambda /= 10;
+    }
+
+    return outcome::ok<VectorN<double>>( x );
+} // End of levenberg_marquardt_schur
+
+} // End of tmns::math::optimize namespace
@@ -0,0 +1,117 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    parallel_for.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tmns::math {
+
+/**
+ * Resolve a requested thread count.  Zero means "use the hardware concurrency", and the
+ * result is never larger than the amount of work available.
+ */
+inline size_t resolve_thread_count( size_t requested,
+                                    size_t work_items )
+{
+    size_t threads = requested;
+    if( threads == 0 )
+    {
+        threads = std::max<size_t>( 1, std::thread::hardware_concurrency() );
+    }
+    return std::max<size_t>( 1, std::min( threads, work_items ) );
+}
+
+/**
+ * Run func( begin, end ) over [0, count) split into chunks of grain_size items.
+ *
+ * Chunks are handed out from a shared atomic counter, so threads which finish early pick
+ * up the remaining work instead of idling behind a static partition.  func is called
+ * with the half-open item range and the index of the worker running it, which lets callers
+ * keep one scratch buffer per worker.  The first exception thrown by any worker is
+ * re-thrown on the calling thread after all workers have joined.
+ *
+ * With one thread (or one chunk), everything runs inline on the calling thread.
+ */
+template <typename FunctorT>
+void parallel_for( size_t    count,
+                   size_t    num_threads,
+                   size_t    grain_size,
+                   FunctorT&& func )
+{
+    if( count == 0 )
+    {
+        return;
+    }
+    grain_size = std::max<size_t>( 1, grain_size );
+    const size_t num_chunks = ( count + grain_size - 1 ) / grain_size;
+    const size_t threads    = resolve_thread_count( num_threads, num_chunks );
+
+    if( threads == 1 )
+    {
+        func( size_t( 0 ), count, size_t( 0 ) );
+        return;
+    }
+
+    std::atomic<size_t> next_chunk { 0 };
+    std::exception_ptr  first_error;
+    std::mutex          error_mutex;
+
+    auto worker = [&]( size_t worker_id )
+    {
+        try
+        {
+            for( size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++ )
+            {
+                const size_t begin = chunk * grain_size;
+                const size_t end   = std::min( count, begin + grain_size );
+                func( begin, end, worker_id );
+            }
+        }
+        catch( ... )
+        {
+            std::lock_guard<std::mutex> lock( error_mutex );
+            if( !first_error )
+            {
+                first_error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve( threads - 1 );
+    for( size_t t = 1; t < threads; t++ )
+    {
+        pool.emplace_back( worker, t );
+    }
+    worker( 0 );
+    for( auto& thread : pool )
+    {
+        thread.join();
+    }
+
+    if( first_error )
+    {
+        std::rethrow_exception( first_error );
+    }
+}
+
+} // End of tmns::math namespace
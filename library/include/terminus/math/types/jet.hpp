@@ -0,0 +1,506 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    jet.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/types/fundamental_types.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::math {
+
+/**
+ * Forward-mode automatic differentiation scalar (a dual number, or "jet").
+ *
+ * A jet carries a value together with its gradient with respect to N independent
+ * parameters.  Every operation applies the chain rule to the gradient, so evaluating a
+ * function templated on its scalar type with jet inputs yields the function value and all
+ * of its first derivatives in a single pass.
+ *
+ * With N > 0 the gradient is a fixed, aligned std::array and the per-operation loops have
+ * a compile-time trip count the compiler can vectorize.  N = 0 selects a std::vector sized
+ * at run time.  A dynamic jet built from a plain constant has an empty gradient, which is
+ * treated as all zeros.
+ *
+ * The math functions are found through argument-dependent lookup, so generic code should
+ * call them unqualified after "using std::sin;" and friends.
+ */
+template <typename ValueT,
+          size_t   N = 0>
+class Jet
+{
+    public:
+
+        /// @brief Underlying Value Type
+        using value_type = ValueT;
+
+        /// @brief Gradient storage
+        using gradient_type = std::conditional_t<N == 0,
+                                                 std::vector<ValueT>,
+                                                 std::array<ValueT,N>>;
+
+        /// @brief Compile-time gradient size, zero if dynamic
+        static constexpr size_t static_size = N;
+
+        /**
+         * Default Constructor.  Zero value and gradient.
+         */
+        Jet()
+        {
+            if constexpr ( N > 0 )
+            {
+                m_gradient.fill( ValueT( 0 ) );
+            }
+        }
+
+        /**
+         * Constant, with a zero gradient.  Implicit so constants mix freely with jets.
+         */
+        Jet( ValueT value )
+            : m_value( value )
+        {
+            if constexpr ( N > 0 )
+            {
+                m_gradient.fill( ValueT( 0 ) );
+            }
+        }
+
+        /**
+         * Independent parameter number index of a fixed-size gradient
+         */
+        Jet( ValueT value,
+             size_t index ) requires ( N > 0 )
+            : m_value( value )
+        {
+            m_gradient.fill( ValueT( 0 ) );
+            m_gradient[index] = ValueT( 1 );
+        }
+
+        /**
+         * Independent parameter number index of a dynamic gradient with size entries
+         */
+        Jet( ValueT value,
+             size_t index,
+             size_t size ) requires ( N == 0 )
+            : m_value( value ),
+              m_gradient( size, ValueT( 0 ) )
+        {
+            m_gradient[index] = ValueT( 1 );
+        }
+
+        /**
+         * Value and gradient
+         */
+        Jet( ValueT        value,
+             gradient_type gradient )
+            : m_value( value ),
+              m_gradient( std::move( gradient ) )
+        {
+        }
+
+        /**
+         * Function value
+         */
+        ValueT value() const
+        {
+            return m_value;
+        }
+
+        /**
+         * Gradient with respect to the independent parameters
+         */
+        const gradient_type& gradient() const
+        {
+            return m_gradient;
+        }
+
+        /**
+         * Writable gradient
+         */
+        gradient_type& gradient()
+        {
+            return m_gradient;
+        }
+
+        /**
+         * Derivative with respect to parameter index, zero if it is not tracked
+         */
+        ValueT derivative( size_t index ) const
+        {
+            return index < m_gradient.size() ? m_gradient[index] : ValueT( 0 );
+        }
+
+        /**
+         * Apply the chain rule for a unary function with value f and derivative df at m_value
+         */
+        Jet chain( ValueT f,
+                   ValueT df ) const
+        {
+            Jet result;
+            result.m_value = f;
+            if constexpr ( N == 0 )
+            {
+                result.m_gradient.resize( m_gradient.size() );
+            }
+            const size_t n = m_gradient.size();
+            for( size_t i = 0; i < n; i++ )
+            {
+                result.m_gradient[i] = df * m_gradient[i];
+            }
+            return result;
+        }
+
+        /**
+         * Jet with value f and gradient da * a' + db * b'
+         */
+        static Jet combine( ValueT     f,
+                            const Jet& a,
+                            ValueT     da,
+                            const Jet& b,
+                            ValueT     db )
+        {
+            Jet result;
+            result.m_value = f;
+            if constexpr ( N == 0 )
+            {
+                const size_t na = a.m_gradient.size();
+                const size_t nb = b.m_gradient.size();
+                result.m_gradient.assign( std::max( na, nb ), ValueT( 0 ) );
+                for( size_t i = 0; i < na; i++ )
+                {
+                    result.m_gradient[i] = da * a.m_gradient[i];
+                }
+                for( size_t i = 0; i < nb; i++ )
+                {
+                    result.m_gradient[i] += db * b.m_gradient[i];
+                }
+            }
+            else
+            {
+                for( size_t i = 0; i < N; i++ )
+                {
+                    result.m_gradient[i] = da * a.m_gradient[i] + db * b.m_gradient[i];
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Unary Plus
+         */
+        Jet operator + () const
+        {
+            return (*this);
+        }
+
+        /**
+         * Negation
+         */
+        Jet operator - () const
+        {
+            return chain( -m_value, ValueT( -1 ) );
+        }
+
+        /**
+         * Compound Assignment Operators
+         */
+        Jet& operator += ( const Jet& rhs )
+        {
+            return ( (*this) = (*this) + rhs );
+        }
+
+        Jet& operator -= ( const Jet& rhs )
+        {
+            return ( (*this) = (*this) - rhs );
+        }
+
+        Jet& operator *= ( const Jet& rhs )
+        {
+            return ( (*this) = (*this) * rhs );
+        }
+
+        Jet& operator /= ( const Jet& rhs )
+        {
+            return ( (*this) = (*this) / rhs );
+        }
+
+        Jet& operator += ( ValueT rhs )
+        {
+            m_value += rhs;
+            return (*this);
+        }
+
+        Jet& operator -= ( ValueT rhs )
+        {
+            m_value -= rhs;
+            return (*this);
+        }
+
+        Jet& operator *= ( ValueT rhs )
+        {
+            m_value *= rhs;
+            for( auto& g : m_gradient )
+            {
+                g *= rhs;
+            }
+            return (*this);
+        }
+
+        Jet& operator /= ( ValueT rhs )
+        {
+            return ( (*this) *= ( ValueT( 1 ) / rhs ) );
+        }
+
+        /**
+         * Arithmetic between jets
+         */
+        friend Jet operator + ( const Jet& a, const Jet& b )
+        {
+            return combine( a.m_value + b.m_value, a, ValueT( 1 ), b, ValueT( 1 ) );
+        }
+
+        friend Jet operator - ( const Jet& a, const Jet& b )
+        {
+            return combine( a.m_value - b.m_value, a, ValueT( 1 ), b, ValueT( -1 ) );
+        }
+
+        friend Jet operator * ( const Jet& a, const Jet& b )
+        {
+            return combine( a.m_value * b.m_value, a, b.m_value, b, a.m_value );
+        }
+
+        friend Jet operator / ( const Jet& a, const Jet& b )
+        {
+            const ValueT inv = ValueT( 1 ) / b.m_value;
+            const ValueT f   = a.m_value * inv;
+            return combine( f, a, inv, b, -f * inv );
+        }
+
+        /**
+         * Arithmetic with constants, which only scale or shift the gradient
+         */
+        friend Jet operator + ( const Jet& a, ValueT s ) { return a.chain( a.m_value + s, ValueT( 1 ) ); }
+        friend Jet operator + ( ValueT s, const Jet& a ) { return a.chain( s + a.m_value, ValueT( 1 ) ); }
+        friend Jet operator - ( const Jet& a, ValueT s ) { return a.chain( a.m_value - s, ValueT( 1 ) ); }
+        friend Jet operator - ( ValueT s, const Jet& a ) { return a.chain( s - a.m_value, ValueT( -1 ) ); }
+        friend Jet operator * ( const Jet& a, ValueT s ) { return a.chain( a.m_value * s, s ); }
+        friend Jet operator * ( ValueT s, const Jet& a ) { return a.chain( s * a.m_value, s ); }
+        friend Jet operator / ( const Jet& a, ValueT s ) { return a.chain( a.m_value / s, ValueT( 1 ) / s ); }
+
+        friend Jet operator / ( ValueT s, const Jet& a )
+        {
+            const ValueT f = s / a.m_value;
+            return a.chain( f, -f / a.m_value );
+        }
+
+        /**
+         * Comparisons look at the value only, so branches in templated models behave the
+         * same as with plain scalars.
+         */
+        friend bool operator == ( const Jet& a, const Jet& b )
+        {
+            return a.m_value == b.m_value;
+        }
+
+        friend auto operator <=> ( const Jet& a, const Jet& b )
+        {
+            return a.m_value <=> b.m_value;
+        }
+
+        /**
+         * Elementary functions
+         */
+        friend Jet abs( const Jet& a )
+        {
+            return a.chain( std::abs( a.m_value ), a.m_value < ValueT( 0 ) ? ValueT( -1 ) : ValueT( 1 ) );
+        }
+
+        friend Jet fabs( const Jet& a )
+        {
+            return abs( a );
+        }
+
+        friend Jet sqrt( const Jet& a )
+        {
+            const ValueT s = std::sqrt( a.m_value );
+            return a.chain( s, ValueT( 0.5 ) / s );
+        }
+
+        friend Jet cbrt( const Jet& a )
+        {
+            const ValueT c = std::cbrt( a.m_value );
+            return a.chain( c, ValueT( 1 ) / ( ValueT( 3 ) * c * c ) );
+        }
+
+        friend Jet exp( const Jet& a )
+        {
+            const ValueT e = std::exp( a.m_value );
+            return a.chain( e, e );
+        }
+
+        friend Jet log( const Jet& a )
+        {
+            return a.chain( std::log( a.m_value ), ValueT( 1 ) / a.m_value );
+        }
+
+        friend Jet log10( const Jet& a )
+        {
+            return a.chain( std::log10( a.m_value ), ValueT( 1 ) / ( a.m_value * std::log( ValueT( 10 ) ) ) );
+        }
+
+        friend Jet sin( const Jet& a )
+        {
+            return a.chain( std::sin( a.m_value ), std::cos( a.m_value ) );
+        }
+
+        friend Jet cos( const Jet& a )
+        {
+            return a.chain( std::cos( a.m_value ), -std::sin( a.m_value ) );
+        }
+
+        friend Jet tan( const Jet& a )
+        {
+            const ValueT t = std::tan( a.m_value );
+            return a.chain( t, ValueT( 1 ) + t * t );
+        }
+
+        friend Jet asin( const Jet& a )
+        {
+            return a.chain( std::asin( a.m_value ), ValueT( 1 ) / std::sqrt( ValueT( 1 ) - a.m_value * a.m_value ) );
+        }
+
+        friend Jet acos( const Jet& a )
+        {
+            return a.chain( std::acos( a.m_value ), ValueT( -1 ) / std::sqrt( ValueT( 1 ) - a.m_value * a.m_value ) );
+        }
+
+        friend Jet atan( const Jet& a )
+        {
+            return a.chain( std::atan( a.m_value ), ValueT( 1 ) / ( ValueT( 1 ) + a.m_value * a.m_value ) );
+        }
+
+        friend Jet sinh( const Jet& a )
+        {
+            return a.chain( std::sinh( a.m_value ), std::cosh( a.m_value ) );
+        }
+
+        friend Jet cosh( const Jet& a )
+        {
+            return a.chain( std::cosh( a.m_value ), std::sinh( a.m_value ) );
+        }
+
+        friend Jet tanh( const Jet& a )
+        {
+            const ValueT t = std::tanh( a.m_value );
+            return a.chain( t, ValueT( 1 ) - t * t );
+        }
+
+        friend Jet atan2( const Jet& y, const Jet& x )
+        {
+            const ValueT r2 = x.m_value * x.m_value + y.m_value * y.m_value;
+            return combine( std::atan2( y.m_value, x.m_value ), y, x.m_value / r2, x, -y.m_value / r2 );
+        }
+
+        friend Jet hypot( const Jet& a, const Jet& b )
+        {
+            const ValueT h = std::hypot( a.m_value, b.m_value );
+            return combine( h, a, a.m_value / h, b, b.m_value / h );
+        }
+
+        friend Jet pow( const Jet& a, ValueT p )
+        {
+            return a.chain( std::pow( a.m_value, p ), p * std::pow( a.m_value, p - ValueT( 1 ) ) );
+        }
+
+        friend Jet pow( ValueT s, const Jet& a )
+        {
+            const ValueT f = std::pow( s, a.m_value );
+            return a.chain( f, f * std::log( s ) );
+        }
+
+        friend Jet pow( const Jet& a, const Jet& b )
+        {
+            // A constant exponent contributes nothing, and its f * log( a ) term would turn a
+            // base <= 0 into a NaN derivative
+            if( a.m_value <= ValueT( 0 ) &&
+                std::all_of( b.m_gradient.begin(), b.m_gradient.end(), []( ValueT g ){ return g == ValueT( 0 ); } ) )
+            {
+                return pow( a, b.m_value );
+            }
+            const ValueT f = std::pow( a.m_value, b.m_value );
+            return combine( f, a, b.m_value * std::pow( a.m_value, b.m_value - ValueT( 1 ) ), b, f * std::log( a.m_value ) );
+        }
+
+        friend bool isfinite( const Jet& a )
+        {
+            return std::isfinite( a.m_value ) &&
+                   std::all_of( a.m_gradient.begin(), a.m_gradient.end(), []( ValueT g ){ return std::isfinite( g ); } );
+        }
+
+        friend bool isnan( const Jet& a )
+        {
+            return std::isnan( a.m_value ) ||
+                   std::any_of( a.m_gradient.begin(), a.m_gradient.end(), []( ValueT g ){ return std::isnan( g ); } );
+        }
+
+        /**
+         * Print as [value ; d0 d1 ...]
+         */
+        friend std::ostream& operator << ( std::ostream& ostr, const Jet& a )
+        {
+            ostr << "[" << a.m_value << " ;";
+            for( const auto& g : a.m_gradient )
+            {
+                ostr << " " << g;
+            }
+            return ostr << "]";
+        }
+
+    private:
+
+        /// @brief Function value
+        ValueT m_value { 0 };
+
+        /// @brief Partial derivatives.  Over-aligned so the fixed-size loops vectorize cleanly.
+        alignas( N > 0 ? std::min<size_t>( 32, std::bit_floor( N * sizeof( ValueT ) ) ) : alignof( gradient_type ) )
+        gradient_type m_gradient {};
+
+}; // End of Jet class
+
+/**
+ * Check if a type is a Jet
+ */
+template <typename ValueT>
+struct Is_Jet : public std::false_type {};
+
+template <typename ValueT, size_t N>
+struct Is_Jet<Jet<ValueT,N>> : public std::true_type {};
+
+/**
+ * Jets are scalars, so the Vector_ and Matrix scalar operators accept them
+ */
+template <typename ValueT, size_t N>
+struct Is_Scalar<Jet<ValueT,N>> : public std::true_type {};
+
+} // End of tmns::math namespace
@@ -295,9 +295,11 @@ template <>
 struct Default_Abs_Behavior<false>
 {
     template <typename ValueT>
-    static double apply( ValueT val )
+    static auto apply( ValueT val )
     {
-        return std::fabs( val );
+        // Unqualified so user scalar types such as Jet are found by ADL
+        using std::fabs;
+        return fabs( val );
     }
 };
 
@@ -315,7 +317,9 @@ struct Arg_Abs_Functor
     {
         using type = typename std::conditional_t<std::numeric_limits<ValueT>::is_integer,
                                                 int,
-                                                double>;
+                                                std::conditional_t<std::is_arithmetic_v<ValueT>,
+                                                                   double,
+                                                                   ValueT>>;
     };
 
     template <typename FunctorT>
@@ -26,15 +26,15 @@ class Sub_Vector : public Vector_Base<Sub_Vector<VectorT>>
     public:
         using value_type = typename VectorT::value_type;
 
-        using reference_type = std::conditional<std::is_const_v<VectorT>,
-                                                typename VectorT::const_reference_type,
-                                                typename VectorT::reference_type>;
+        using reference_type = std::conditional_t<std::is_const_v<VectorT>,
+                                                  typename VectorT::const_reference_type,
+                                                  typename VectorT::reference_type>;
 
         using const_reference_type = typename VectorT::const_reference_type;
 
-        using iter_t = std::conditional<std::is_const_v<VectorT>,
-                                        typename VectorT::const_iter_t,
-                                        typename VectorT::iter_t>;
+        using iter_t = std::conditional_t<std::is_const_v<VectorT>,
+                                          typename VectorT::const_iter_t,
+                                          typename VectorT::iter_t>;
 
         using const_iter_t = typename VectorT::const_iter_t;
 
@@ -64,7 +64,7 @@ class Sub_Vector : public Vector_Base<Sub_Vector<VectorT>>
             }
             std::copy( v.begin(),
                        v.end(),
-                       m_vector.begin() );
+                       begin() );
             return *this;
         }
 
@@ -82,7 +82,7 @@ class Sub_Vector : public Vector_Base<Sub_Vector<VectorT>>
             }
             std::copy( v.impl().begin(),
                        v.impl().end(),
-                       m_vector.begin() );
+                       begin() );
             return *this;
         }
 
@@ -101,7 +101,7 @@ class Sub_Vector : public Vector_Base<Sub_Vector<VectorT>>
             }
             std::copy( v.impl().begin(),
                        v.impl().end(),
-                       m_vector.begin() );
+                       begin() );
             return *this;
         }
 
@@ -147,7 +147,7 @@ class Sub_Vector : public Vector_Base<Sub_Vector<VectorT>>
 
         iter_t begin()
         {
-            return child().begin() + m_pos;\
+            return child().begin() + m_pos;
         }
 
         const_iter_t begin() const
@@ -14,11 +14,21 @@
  */
 #include <terminus/math/linalg/solvers.hpp>
 
+// Terminus Libraries
+#include <terminus/math/linalg/workspace_solvers.hpp>
+#include <terminus/math/parallel_for.hpp>
+
 // Project Libraries
 #include "../thirdparty/eigen/eigen_utilities.hpp"
 
 // Eigen Libraries
-#include <Eigen/SVD>
+#include <Eigen/Cholesky>
+#include <Eigen/LU>
+#include <Eigen/QR>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
 
 namespace tmns::math::linalg {
 
@@ -53,49 +63,221 @@ Result<VectorN<double>> solve( const MatrixN<double>& mat_A,
                                const VectorN<double>& vec_b,
                                double                 eps )
 {
-    using EigenMatrixT = eigen::TMNS_to_Eigen_Picker<MatrixN<double>>::EigenT;
-    using EigenVectorT = eigen::TMNS_to_Eigen_Picker<VectorN<double>>::EigenT;
+    SVD_Solver<double> svd( mat_A.rows(), mat_A.cols() );
+    auto res = svd.factor( mat_A );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return svd.solve( vec_b, eps );
+}
 
-    // Convert to eigen types
-    auto A = eigen::to_eigen<EigenMatrixT>( mat_A );
-    auto b = eigen::to_eigen<EigenVectorT>( vec_b );
-
-    // Create the Jacobian SVN Engine
-    Eigen::JacobiSVD<Eigen::Matrix<double,
-                                   Eigen::Dynamic,
-                                   Eigen::Dynamic,
-                                   Eigen::RowMajor> > svd( A.value(),
-                                                           Eigen::ComputeThinU |
-                                                           Eigen::ComputeThinV );
-
-    // Grab the Diagonal
-    Eigen::Matrix<double,
-                  Eigen::Dynamic,
-                  Eigen::Dynamic,
-                  Eigen::RowMajor> s = svd.singularValues().asDiagonal();
-
-    // wipe out the small singular values
-    for( int64_t y = 0; y < s.rows(); y++ )
-    for( int64_t x = 0; x < s.cols(); x++ )
+/************************************************/
+/*      Solve with Multiple Right-Hand Sides    */
+/************************************************/
+Result<MatrixN<double>> solve( const MatrixN<double>& mat_A,
+                               const MatrixN<double>& mat_B,
+                               double                 eps )
+{
+    SVD_Solver<double> svd( mat_A.rows(), mat_A.cols() );
+    auto res = svd.factor( mat_A );
+    if( res.has_error() )
     {
-        if( s(y,x) > eps )
+        return res.error();
+    }
+    return svd.solve( mat_B, eps );
+}
+
+namespace {
+
+using Row_Map_d = Eigen::Map<const Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor>>;
+
+/**
+ * r = b - A x accumulated in long double, parallel over rows.  Returns ||r||_inf.
+ */
+double extended_residual( const MatrixN<double>& A,
+                          const VectorN<double>& b,
+                          const VectorN<double>& x,
+                          Eigen::VectorXd&       r,
+                          size_t                 num_threads )
+{
+    const size_t  n  = A.cols();
+    const double* a  = A.data();
+    const double* xv = x.data().data();
+    parallel_for( A.rows(), num_threads, 64, [&]( size_t begin, size_t end, size_t )
+    {
+        for( size_t i = begin; i < end; i++ )
+        {
+            const double* row = a + i * n;
+            long double s = b[i];
+            for( size_t j = 0; j < n; j++ )
+            {
+                s -= static_cast<long double>( row[j] ) * xv[j];
+            }
+            r( static_cast<Eigen::Index>( i ) ) = static_cast<double>( s );
+        }
+    });
+    return r.size() > 0 ? r.cwiseAbs().maxCoeff() : 0.0;
+}
+
+/**
+ * Condition estimate from a reciprocal estimate, infinite for singular factors
+ */
+double condition_from_rcond( double rcond )
+{
+    return ( rcond > 0 && std::isfinite( rcond ) ) ? 1.0 / rcond
+                                                   : std::numeric_limits<double>::infinity();
+}
+
+/**
+ * Solve in double with a fresh factorization.  Used when the float path is not trusted.
+ */
+Result<void> solve_double_fallback( const MatrixN<double>&         A,
+                                    const VectorN<double>&         b,
+                                    VectorN<double>&               x,
+                                    const Mixed_Precision_Options& options,
+                                    Mixed_Precision_Info&          info )
+{
+    const auto    n = static_cast<Eigen::Index>( A.rows() );
+    Eigen::MatrixXd Ad = Row_Map_d( A.data(), n, n );
+    Eigen::Map<const Eigen::VectorXd> b_map( b.data().data(), n );
+    Eigen::VectorXd xd;
+
+    bool solved = false;
+    if( options.symmetric )
+    {
+        Eigen::LLT<Eigen::MatrixXd> llt( Ad );
+        if( llt.info() == Eigen::Success )
         {
-            s(y,x) = 1/s(y,x);
+            xd = llt.solve( b_map );
+            info.condition_estimate = condition_from_rcond( llt.rcond() );
+            solved = true;
         }
-        else
+    }
+    if( !solved )
+    {
+        Eigen::PartialPivLU<Eigen::MatrixXd> lu( Ad );
+        xd = lu.solve( b_map );
+        info.condition_estimate = condition_from_rcond( lu.rcond() );
+    }
+    if( !std::isfinite( info.condition_estimate ) || !xd.allFinite() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "solve_mixed_precision(): matrix is singular" );
+    }
+
+    x.data().assign( xd.data(), xd.data() + n );
+    info.used_fallback = true;
+
+    Eigen::VectorXd r( n );
+    info.residual_norm = extended_residual( A, b, x, r, options.num_threads );
+    return outcome::ok();
+}
+
+} // End of anonymous namespace
+
+/************************************************/
+/*      Mixed Precision Iterative Refinement    */
+/************************************************/
+Result<Mixed_Precision_Info> solve_mixed_precision( const MatrixN<double>&         A,
+                                                    const VectorN<double>&         b,
+                                                    VectorN<double>&               x,
+                                                    const Mixed_Precision_Options& options )
+{
+    if( A.rows() != A.cols() || A.rows() == 0 )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "solve_mixed_precision() requires a non-empty square matrix" );
+    }
+    if( b.size() != A.rows() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Right-hand side has size " + std::to_string( b.size() )
+                              + ", expected " + std::to_string( A.rows() ) );
+    }
+
+    const auto n = static_cast<Eigen::Index>( A.rows() );
+    Mixed_Precision_Info info;
+
+    // Single precision factorization
+    Eigen::MatrixXf Af = Row_Map_d( A.data(), n, n ).cast<float>();
+    Eigen::LLT<Eigen::MatrixXf>          llt;
+    Eigen::PartialPivLU<Eigen::MatrixXf> lu;
+    bool factored = true;
+    if( options.symmetric )
+    {
+        llt.compute( Af );
+        factored = ( llt.info() == Eigen::Success );
+        info.condition_estimate = factored ? condition_from_rcond( llt.rcond() )
+                                           : std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+        lu.compute( Af );
+        info.condition_estimate = condition_from_rcond( lu.rcond() );
+    }
+
+    auto fallback = [&]() -> Result<Mixed_Precision_Info>
+    {
+        auto res = solve_double_fallback( A, b, x, options, info );
+        if( res.has_error() )
         {
-            s(y,x) = 0;
+            return res.error();
         }
+        return outcome::ok<Mixed_Precision_Info>( info );
+    };
+
+    if( !factored || !( info.condition_estimate <= options.max_condition ) )
+    {
+        return fallback();
     }
 
-    auto inv = svd.matrixV() * s * svd.matrixU().transpose();
+    auto solve_float = [&]( const Eigen::VectorXf& rhs ) -> Eigen::VectorXf
+    {
+        return options.symmetric ? Eigen::VectorXf( llt.solve( rhs ) )
+                                 : Eigen::VectorXf( lu.solve( rhs ) );
+    };
+
+    // Initial solution from the float factors
+    Eigen::Map<const Eigen::VectorXd> b_map( b.data().data(), n );
+    Eigen::VectorXf xf = solve_float( b_map.cast<float>() );
+    x.data().resize( static_cast<size_t>( n ) );
+    Eigen::Map<Eigen::VectorXd> x_map( x.data().data(), n );
+    x_map = xf.cast<double>();
 
-    Eigen::MatrixXd output = inv * b.value();
+    // Stopping test from LAPACK DSGESV:  ||r|| <= ||x|| * ||A|| * eps * sqrt(n)
+    const double a_norm = Row_Map_d( A.data(), n, n ).cwiseAbs().rowwise().sum().maxCoeff();
+    const double tol    = a_norm * std::numeric_limits<double>::epsilon() * std::sqrt( double( n ) );
+
+    Eigen::VectorXd r( n );
+    bool converged = false;
+    for( size_t iter = 0; iter <= options.max_iterations; iter++ )
+    {
+        info.residual_norm = extended_residual( A, b, x, r, options.num_threads );
+        if( !x_map.allFinite() || !std::isfinite( info.residual_norm ) )
+        {
+            break;
+        }
+        if( info.residual_norm <= x_map.cwiseAbs().maxCoeff() * tol )
+        {
+            converged = true;
+            break;
+        }
+        if( iter == options.max_iterations )
+        {
+            break;
+        }
 
-    VectorN<double> output_tmns( output.data(),
-                                 static_cast<size_t>(output.size()) );
+        // Correction solved in float, applied in double
+        x_map += solve_float( r.cast<float>() ).cast<double>();
+        info.iterations++;
+    }
 
-    return outcome::ok<VectorN<double>>( output_tmns );
+    if( !converged )
+    {
+        return fallback();
+    }
+    return outcome::ok<Mixed_Precision_Info>( info );
 }
 
 } // End of tmns::math::linalg namespace
\ No newline at end of file
@@ -0,0 +1,775 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    workspace_solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+ */
+#include <terminus/math/linalg/workspace_solvers.hpp>
+
+// Project Libraries
+#include "../thirdparty/eigen/eigen_utilities.hpp"
+
+// Eigen Libraries
+#include <Eigen/Cholesky>
+#include <Eigen/QR>
+#include <Eigen/SVD>
+
+namespace tmns::math::linalg {
+
+namespace {
+
+/// Eigen types used by all workspace solvers.  MatrixN is row-major, so the inputs are
+/// mapped without copying and assigned into the preallocated column-major storage.
+template <typename ValueT>
+struct Eigen_Types
+{
+    using MatrixT    = Eigen::Matrix<ValueT,Eigen::Dynamic,Eigen::Dynamic>;
+    using VectorT    = Eigen::Matrix<ValueT,Eigen::Dynamic,1>;
+    using RowMapT    = Eigen::Map<const Eigen::Matrix<ValueT,
+                                                      Eigen::Dynamic,
+                                                      Eigen::Dynamic,
+                                                      Eigen::RowMajor>>;
+    using MatMapT    = Eigen::Map<const MatrixT>;
+    using VecMapT    = Eigen::Map<const VectorT>;
+    using MutVecMapT = Eigen::Map<VectorT>;
+};
+
+/**
+ * Resize the output vector only when needed, so repeated solves do not reallocate.
+ */
+template <typename ValueT>
+void prepare_output( VectorN<ValueT>& x,
+                     size_t           n )
+{
+    if( x.size() != n )
+    {
+        x.data().resize( n );
+    }
+}
+
+/**
+ * Copy a column-major Eigen matrix into a MatrixN, resizing only when the shape differs
+ */
+template <typename ValueT, typename EigenT>
+void copy_to_matrix( const EigenT&    src,
+                     MatrixN<ValueT>& dst )
+{
+    if( dst.rows() != static_cast<size_t>( src.rows() ) || dst.cols() != static_cast<size_t>( src.cols() ) )
+    {
+        dst.set_size( static_cast<size_t>( src.rows() ), static_cast<size_t>( src.cols() ) );
+    }
+    Eigen::Map<Eigen::Matrix<ValueT,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor>>( dst.data(), src.rows(), src.cols() ) = src;
+}
+
+} // End of anonymous namespace
+
+/********************************************************/
+/*          Symmetric Solver Implementation             */
+/********************************************************/
+template <typename ValueT>
+struct Symmetric_Solver<ValueT>::Impl
+{
+    using Types = Eigen_Types<ValueT>;
+
+    explicit Impl( size_t n )
+        : ldlt( static_cast<Eigen::Index>( n ) ),
+          size( n )
+    {}
+
+    /// @brief Factorization and its internal workspace
+    Eigen::LDLT<typename Types::MatrixT> ldlt;
+
+    /// @brief Allocated system size
+    size_t size { 0 };
+
+    /// @brief Set when ldlt holds a usable factorization
+    bool factored { false };
+}; // End of Symmetric_Solver::Impl
+
+/********************************************/
+/*          Default Constructor             */
+/********************************************/
+template <typename ValueT>
+Symmetric_Solver<ValueT>::Symmetric_Solver()
+  : m_impl( std::make_unique<Impl>( 0 ) )
+{
+}
+
+/********************************************/
+/*          Preallocating Constructor       */
+/********************************************/
+template <typename ValueT>
+Symmetric_Solver<ValueT>::Symmetric_Solver( size_t n )
+  : m_impl( std::make_unique<Impl>( n ) )
+{
+}
+
+template <typename ValueT>
+Symmetric_Solver<ValueT>::~Symmetric_Solver() = default;
+
+template <typename ValueT>
+Symmetric_Solver<ValueT>::Symmetric_Solver( Symmetric_Solver&& ) noexcept = default;
+
+template <typename ValueT>
+Symmetric_Solver<ValueT>& Symmetric_Solver<ValueT>::operator = ( Symmetric_Solver&& ) noexcept = default;
+
+/********************************************/
+/*          Factor the System Matrix        */
+/********************************************/
+template <typename ValueT>
+Result<void> Symmetric_Solver<ValueT>::factor( const MatrixN<ValueT>& A )
+{
+    using Types = typename Impl::Types;
+
+    if( !m_impl )
+    {
+        m_impl = std::make_unique<Impl>( 0 );
+    }
+    m_impl->factored = false;
+    if( A.rows() != A.cols() || A.rows() == 0 )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Symmetric_Solver requires a non-empty square matrix. Actual: "
+                              + std::to_string( A.rows() ) + " x " + std::to_string( A.cols() ) );
+    }
+
+    // Only reallocate when the size changes
+    if( A.rows() != m_impl->size )
+    {
+        m_impl->ldlt = Eigen::LDLT<typename Types::MatrixT>( static_cast<Eigen::Index>( A.rows() ) );
+        m_impl->size = A.rows();
+    }
+
+    typename Types::RowMapT A_map( A.data(),
+                                   static_cast<Eigen::Index>( A.rows() ),
+                                   static_cast<Eigen::Index>( A.cols() ) );
+    m_impl->ldlt.compute( A_map );
+
+    if( m_impl->ldlt.info() != Eigen::Success )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "LDLT factorization failed." );
+    }
+    for( Eigen::Index i = 0; i < m_impl->ldlt.vectorD().size(); i++ )
+    {
+        if( m_impl->ldlt.vectorD()( i ) == ValueT( 0 ) )
+        {
+            return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                  "Matrix is singular in Symmetric_Solver::factor()" );
+        }
+    }
+
+    m_impl->factored = true;
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into existing vector      */
+/********************************************/
+template <typename ValueT>
+Result<void> Symmetric_Solver<ValueT>::solve( const VectorN<ValueT>& b,
+                                              VectorN<ValueT>&       x ) const
+{
+    using Types = typename Impl::Types;
+
+    if( !is_factored() )
+    {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "Symmetric_Solver::solve() called before factor()" );
+    }
+    if( b.size() != m_impl->size )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Right-hand side has size " + std::to_string( b.size() )
+                              + ", expected " + std::to_string( m_impl->size ) );
+    }
+
+    prepare_output( x, m_impl->size );
+    typename Types::VecMapT    b_map( b.data().data(), static_cast<Eigen::Index>( b.size() ) );
+    typename Types::MutVecMapT x_map( x.data().data(), static_cast<Eigen::Index>( x.size() ) );
+    x_map.noalias() = m_impl->ldlt.solve( b_map );
+
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into new vector           */
+/********************************************/
+template <typename ValueT>
+Result<VectorN<ValueT>> Symmetric_Solver<ValueT>::solve( const VectorN<ValueT>& b ) const
+{
+    VectorN<ValueT> x( size() );
+    auto res = solve( b, x );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<VectorN<ValueT>>( std::move( x ) );
+}
+
+template <typename ValueT>
+size_t Symmetric_Solver<ValueT>::size() const
+{
+    return m_impl ? m_impl->size : 0;
+}
+
+template <typename ValueT>
+bool Symmetric_Solver<ValueT>::is_factored() const
+{
+    return m_impl && m_impl->factored;
+}
+
+/********************************************************/
+/*          Least Squares Solver Implementation         */
+/********************************************************/
+template <typename ValueT>
+struct Least_Squares_Solver<ValueT>::Impl
+{
+    using Types = Eigen_Types<ValueT>;
+
+    Impl( size_t r, size_t c )
+        : qr( static_cast<Eigen::Index>( r ), static_cast<Eigen::Index>( c ) ),
+          rhs( static_cast<Eigen::Index>( r ) ),
+          rows( r ),
+          cols( c )
+    {}
+
+    /// @brief Factorization and its internal workspace
+    Eigen::ColPivHouseholderQR<typename Types::MatrixT> qr;
+
+    /// @brief Scratch copy of the right-hand side, transformed by Q^T in place
+    typename Types::VectorT rhs;
+
+    /// @brief Workspace for applying one reflector to the single-column right-hand side
+    ValueT householder_work { 0 };
+
+    /// @brief Allocated system size
+    size_t rows { 0 };
+    size_t cols { 0 };
+
+    /// @brief Set when qr holds a usable factorization
+    bool factored { false };
+}; // End of Least_Squares_Solver::Impl
+
+/********************************************/
+/*          Default Constructor             */
+/********************************************/
+template <typename ValueT>
+Least_Squares_Solver<ValueT>::Least_Squares_Solver()
+  : m_impl( std::make_unique<Impl>( 0, 0 ) )
+{
+}
+
+/********************************************/
+/*          Preallocating Constructor       */
+/********************************************/
+template <typename ValueT>
+Least_Squares_Solver<ValueT>::Least_Squares_Solver( size_t rows,
+                                                    size_t cols )
+  : m_impl( std::make_unique<Impl>( rows, cols ) )
+{
+}
+
+template <typename ValueT>
+Least_Squares_Solver<ValueT>::~Least_Squares_Solver() = default;
+
+template <typename ValueT>
+Least_Squares_Solver<ValueT>::Least_Squares_Solver( Least_Squares_Solver&& ) noexcept = default;
+
+template <typename ValueT>
+Least_Squares_Solver<ValueT>& Least_Squares_Solver<ValueT>::operator = ( Least_Squares_Solver&& ) noexcept = default;
+
+/********************************************/
+/*          Factor the System Matrix        */
+/********************************************/
+template <typename ValueT>
+Result<void> Least_Squares_Solver<ValueT>::factor( const MatrixN<ValueT>& A )
+{
+    using Types = typename Impl::Types;
+
+    if( m_impl )
+    {
+        m_impl->factored = false;
+    }
+    if( A.rows() == 0 || A.cols() == 0 )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Least_Squares_Solver requires a non-empty matrix." );
+    }
+
+    // Only reallocate when the size changes
+    if( !m_impl || A.rows() != m_impl->rows || A.cols() != m_impl->cols )
+    {
+        m_impl = std::make_unique<Impl>( A.rows(), A.cols() );
+    }
+
+    typename Types::RowMapT A_map( A.data(),
+                                   static_cast<Eigen::Index>( A.rows() ),
+                                   static_cast<Eigen::Index>( A.cols() ) );
+    m_impl->qr.compute( A_map );
+
+    m_impl->factored = true;
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into existing vector      */
+/********************************************/
+template <typename ValueT>
+Result<void> Least_Squares_Solver<ValueT>::solve( const VectorN<ValueT>& b,
+                                                  VectorN<ValueT>&       x )
+{
+    using Types = typename Impl::Types;
+
+    if( !is_factored() )
+    {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "Least_Squares_Solver::solve() called before factor()" );
+    }
+    if( b.size() != m_impl->rows )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Right-hand side has size " + std::to_string( b.size() )
+                              + ", expected " + std::to_string( m_impl->rows ) );
+    }
+
+    const auto& qr = m_impl->qr;
+    const auto& QR = qr.matrixQR();
+    auto&       c  = m_impl->rhs;
+    const Eigen::Index m = QR.rows();
+    const Eigen::Index r = qr.nonzeroPivots();
+
+    // c = Q^T b, applied reflector by reflector into the preallocated scratch vector.
+    // Going through householderQ() would allocate a workspace on every call.
+    c = typename Types::VecMapT( b.data().data(), static_cast<Eigen::Index>( b.size() ) );
+    for( Eigen::Index k = 0; k < r; k++ )
+    {
+        c.tail( m - k ).applyHouseholderOnTheLeft( QR.col( k ).tail( m - k - 1 ),
+                                                    qr.hCoeffs()( k ),
+                                                    &m_impl->householder_work );
+    }
+
+    // R11 y = c1
+    qr.matrixR().topLeftCorner( r, r ).template triangularView<Eigen::Upper>().solveInPlace( c.topRows( r ) );
+
+    // Undo the column permutation, zeroing the free variables
+    prepare_output( x, m_impl->cols );
+    const auto& perm = qr.colsPermutation().indices();
+    for( Eigen::Index i = 0; i < r; i++ )
+    {
+        x[static_cast<size_t>( perm( i ) )] = c( i );
+    }
+    for( Eigen::Index i = r; i < static_cast<Eigen::Index>( m_impl->cols ); i++ )
+    {
+        x[static_cast<size_t>( perm( i ) )] = ValueT( 0 );
+    }
+
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into new vector           */
+/********************************************/
+template <typename ValueT>
+Result<VectorN<ValueT>> Least_Squares_Solver<ValueT>::solve( const VectorN<ValueT>& b )
+{
+    VectorN<ValueT> x( cols() );
+    auto res = solve( b, x );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<VectorN<ValueT>>( std::move( x ) );
+}
+
+template <typename ValueT>
+size_t Least_Squares_Solver<ValueT>::rank() const
+{
+    return is_factored() ? static_cast<size_t>( m_impl->qr.rank() ) : 0;
+}
+
+template <typename ValueT>
+size_t Least_Squares_Solver<ValueT>::rows() const
+{
+    return m_impl ? m_impl->rows : 0;
+}
+
+template <typename ValueT>
+size_t Least_Squares_Solver<ValueT>::cols() const
+{
+    return m_impl ? m_impl->cols : 0;
+}
+
+template <typename ValueT>
+bool Least_Squares_Solver<ValueT>::is_factored() const
+{
+    return m_impl && m_impl->factored;
+}
+
+/********************************************************/
+/*          SVD Solver Implementation                   */
+/********************************************************/
+template <typename ValueT>
+struct SVD_Solver<ValueT>::Impl
+{
+    using Types = Eigen_Types<ValueT>;
+
+    /**
+     * The decomposition works on the tall orientation of A, p x q with p >= q:  A itself,
+     * or A^T when A is wide.  Its column-pivoted QR reduces it to the square R, which
+     * JacobiSVD decomposes without a preconditioner, and Q is applied back one reflector
+     * at a time.  This is the preconditioning JacobiSVD does internally, except that its
+     * blocked application of Q allocates on every call.
+     */
+    Impl( size_t r, size_t c )
+        : rows( r ),
+          cols( c ),
+          transposed( r < c ),
+          qr( static_cast<Eigen::Index>( std::max( r, c ) ), static_cast<Eigen::Index>( std::min( r, c ) ) ),
+          R( static_cast<Eigen::Index>( std::min( r, c ) ), static_cast<Eigen::Index>( std::min( r, c ) ) ),
+          svd( static_cast<Eigen::Index>( std::min( r, c ) ),
+               static_cast<Eigen::Index>( std::min( r, c ) ),
+               Eigen::ComputeFullU | Eigen::ComputeFullV ),
+          tall_u( static_cast<Eigen::Index>( std::max( r, c ) ), static_cast<Eigen::Index>( std::min( r, c ) ) ),
+          tall_v( static_cast<Eigen::Index>( std::min( r, c ) ), static_cast<Eigen::Index>( std::min( r, c ) ) ),
+          householder_work( static_cast<Eigen::Index>( std::min( r, c ) ) ),
+          tmp( static_cast<Eigen::Index>( std::min( r, c ) ) )
+    {}
+
+    /// @brief Thin left singular vectors of A
+    const typename Types::MatrixT& matrix_u() const
+    {
+        return transposed ? tall_v : tall_u;
+    }
+
+    /// @brief Thin right singular vectors of A
+    const typename Types::MatrixT& matrix_v() const
+    {
+        return transposed ? tall_u : tall_v;
+    }
+
+    /// @brief Allocated system size
+    size_t rows { 0 };
+    size_t cols { 0 };
+
+    /// @brief Set when A is wide and its transpose is decomposed
+    bool transposed { false };
+
+    /// @brief Column-pivoted QR of the tall orientation
+    Eigen::ColPivHouseholderQR<typename Types::MatrixT> qr;
+
+    /// @brief Square upper triangular factor handed to the SVD
+    typename Types::MatrixT R;
+
+    /// @brief Decomposition of R and its internal workspace
+    Eigen::JacobiSVD<typename Types::MatrixT,Eigen::NoQRPreconditioner> svd;
+
+    /// @brief Left singular vectors of the tall orientation, Q * U_R
+    typename Types::MatrixT tall_u;
+
+    /// @brief Right singular vectors of the tall orientation, P * V_R
+    typename Types::MatrixT tall_v;
+
+    /// @brief Workspace for applying one reflector to tall_u
+    typename Types::VectorT householder_work;
+
+    /// @brief Scratch space for U^T b
+    typename Types::VectorT tmp;
+
+    /// @brief Scratch space for U^T B with multiple right-hand sides
+    typename Types::MatrixT tmp_multi;
+
+    /// @brief Set when the singular vectors hold a usable decomposition
+    bool factored { false };
+}; // End of SVD_Solver::Impl
+
+/********************************************/
+/*          Default Constructor             */
+/********************************************/
+template <typename ValueT>
+SVD_Solver<ValueT>::SVD_Solver()
+  : m_impl( std::make_unique<Impl>( 0, 0 ) )
+{
+}
+
+/********************************************/
+/*          Preallocating Constructor       */
+/********************************************/
+template <typename ValueT>
+SVD_Solver<ValueT>::SVD_Solver( size_t rows,
+                                size_t cols )
+  : m_impl( std::make_unique<Impl>( rows, cols ) )
+{
+}
+
+template <typename ValueT>
+SVD_Solver<ValueT>::~SVD_Solver() = default;
+
+template <typename ValueT>
+SVD_Solver<ValueT>::SVD_Solver( SVD_Solver&& ) noexcept = default;
+
+template <typename ValueT>
+SVD_Solver<ValueT>& SVD_Solver<ValueT>::operator = ( SVD_Solver&& ) noexcept = default;
+
+/********************************************/
+/*          Decompose the Matrix            */
+/********************************************/
+template <typename ValueT>
+Result<void> SVD_Solver<ValueT>::factor( const MatrixN<ValueT>& A )
+{
+    using Types = typename Impl::Types;
+
+    if( m_impl )
+    {
+        m_impl->factored = false;
+    }
+    if( A.rows() == 0 || A.cols() == 0 )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "SVD_Solver requires a non-empty matrix." );
+    }
+
+    // Only reallocate when the size changes
+    if( !m_impl || A.rows() != m_impl->rows || A.cols() != m_impl->cols )
+    {
+        m_impl = std::make_unique<Impl>( A.rows(), A.cols() );
+    }
+    auto& impl = *m_impl;
+    const Eigen::Index p = impl.qr.rows();
+    const Eigen::Index q = impl.qr.cols();
+
+    // A^T in column-major order has the memory layout of the row-major A
+    if( impl.transposed )
+    {
+        impl.qr.compute( typename Types::MatMapT( A.data(), p, q ) );
+    }
+    else
+    {
+        impl.qr.compute( typename Types::RowMapT( A.data(), p, q ) );
+    }
+
+    impl.R = impl.qr.matrixQR().topRows( q ).template triangularView<Eigen::Upper>();
+    impl.svd.compute( impl.R );
+
+    // U = Q * [ U_R; 0 ], applying the last reflector first
+    const auto& QR = impl.qr.matrixQR();
+    impl.tall_u.topRows( q ) = impl.svd.matrixU();
+    impl.tall_u.bottomRows( p - q ).setZero();
+    for( Eigen::Index k = q - 1; k >= 0; k-- )
+    {
+        impl.tall_u.bottomRows( p - k ).applyHouseholderOnTheLeft( QR.col( k ).tail( p - k - 1 ),
+                                                                    impl.qr.hCoeffs()( k ),
+                                                                    impl.householder_work.data() );
+    }
+
+    // V = P * V_R
+    const auto& perm = impl.qr.colsPermutation().indices();
+    for( Eigen::Index i = 0; i < q; i++ )
+    {
+        impl.tall_v.row( perm( i ) ) = impl.svd.matrixV().row( i );
+    }
+
+    impl.factored = true;
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into existing vector      */
+/********************************************/
+template <typename ValueT>
+Result<void> SVD_Solver<ValueT>::solve( const VectorN<ValueT>& b,
+                                        VectorN<ValueT>&       x,
+                                        ValueT                 eps )
+{
+    using Types = typename Impl::Types;
+
+    if( !is_factored() )
+    {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "SVD_Solver::solve() called before factor()" );
+    }
+    if( b.size() != m_impl->rows )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Right-hand side has size " + std::to_string( b.size() )
+                              + ", expected " + std::to_string( m_impl->rows ) );
+    }
+
+    auto&       tmp = m_impl->tmp;
+    const auto& s   = m_impl->svd.singularValues();
+
+    // x = V * ( S^-1 .* ( U^T b ) ), never forming the pseudo-inverse
+    typename Types::VecMapT b_map( b.data().data(), static_cast<Eigen::Index>( b.size() ) );
+    tmp.noalias() = m_impl->matrix_u().transpose() * b_map;
+    for( Eigen::Index i = 0; i < tmp.size(); i++ )
+    {
+        tmp( i ) = ( s( i ) > eps ) ? tmp( i ) / s( i ) : ValueT( 0 );
+    }
+
+    prepare_output( x, m_impl->cols );
+    typename Types::MutVecMapT x_map( x.data().data(), static_cast<Eigen::Index>( x.size() ) );
+    x_map.noalias() = m_impl->matrix_v() * tmp;
+
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into new vector           */
+/********************************************/
+template <typename ValueT>
+Result<VectorN<ValueT>> SVD_Solver<ValueT>::solve( const VectorN<ValueT>& b,
+                                                   ValueT                 eps )
+{
+    VectorN<ValueT> x( cols() );
+    auto res = solve( b, x, eps );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<VectorN<ValueT>>( std::move( x ) );
+}
+
+/********************************************/
+/*          Solve into existing matrix      */
+/********************************************/
+template <typename ValueT>
+Result<void> SVD_Solver<ValueT>::solve( const MatrixN<ValueT>& B,
+                                        MatrixN<ValueT>&       X,
+                                        ValueT                 eps )
+{
+    using Types = typename Impl::Types;
+    using RowMutMapT = Eigen::Map<Eigen::Matrix<ValueT,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor>>;
+
+    if( !is_factored() )
+    {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "SVD_Solver::solve() called before factor()" );
+    }
+    if( B.rows() != m_impl->rows )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Right-hand side has " + std::to_string( B.rows() )
+                              + " rows, expected " + std::to_string( m_impl->rows ) );
+    }
+
+    auto&       tmp = m_impl->tmp_multi;
+    const auto& s   = m_impl->svd.singularValues();
+
+    // X = V * ( S^-1 .* ( U^T B ) ), one pass over U and V for all columns
+    typename Types::RowMapT B_map( B.data(),
+                                   static_cast<Eigen::Index>( B.rows() ),
+                                   static_cast<Eigen::Index>( B.cols() ) );
+    tmp.noalias() = m_impl->matrix_u().transpose() * B_map;
+    for( Eigen::Index i = 0; i < tmp.rows(); i++ )
+    {
+        const ValueT scale = ( s( i ) > eps ) ? ValueT( 1 ) / s( i ) : ValueT( 0 );
+        tmp.row( i ) *= scale;
+    }
+
+    if( X.rows() != m_impl->cols || X.cols() != B.cols() )
+    {
+        X.set_size( m_impl->cols, B.cols() );
+    }
+    RowMutMapT X_map( X.data(),
+                      static_cast<Eigen::Index>( X.rows() ),
+                      static_cast<Eigen::Index>( X.cols() ) );
+    X_map.noalias() = m_impl->matrix_v() * tmp;
+
+    return outcome::ok();
+}
+
+/********************************************/
+/*          Solve into new matrix           */
+/********************************************/
+template <typename ValueT>
+Result<MatrixN<ValueT>> SVD_Solver<ValueT>::solve( const MatrixN<ValueT>& B,
+                                                   ValueT                 eps )
+{
+    MatrixN<ValueT> X( cols(), B.cols() );
+    auto res = solve( B, X, eps );
+    if( res.has_error() )
+    {
+        return res.error();
+    }
+    return outcome::ok<MatrixN<ValueT>>( std::move( X ) );
+}
+
+/********************************************/
+/*          Copy out the Singular Values    */
+/********************************************/
+template <typename ValueT>
+void SVD_Solver<ValueT>::singular_values( VectorN<ValueT>& S ) const
+{
+    if( !is_factored() )
+    {
+        prepare_output( S, 0 );
+        return;
+    }
+    const auto& s = m_impl->svd.singularValues();
+    prepare_output( S, static_cast<size_t>( s.size() ) );
+    std::copy( s.data(), s.data() + s.size(), S.begin() );
+}
+
+/********************************************/
+/*          Copy out the U Matrix           */
+/********************************************/
+template <typename ValueT>
+void SVD_Solver<ValueT>::matrix_u( MatrixN<ValueT>& U ) const
+{
+    if( !is_factored() )
+    {
+        U.set_size( 0, 0 );
+        return;
+    }
+    copy_to_matrix( m_impl->matrix_u(), U );
+}
+
+/********************************************/
+/*          Copy out the V Matrix           */
+/********************************************/
+template <typename ValueT>
+void SVD_Solver<ValueT>::matrix_v( MatrixN<ValueT>& V ) const
+{
+    if( !is_factored() )
+    {
+        V.set_size( 0, 0 );
+        return;
+    }
+    copy_to_matrix( m_impl->matrix_v(), V );
+}
+
+template <typename ValueT>
+size_t SVD_Solver<ValueT>::rows() const
+{
+    return m_impl ? m_impl->rows : 0;
+}
+
+template <typename ValueT>
+size_t SVD_Solver<ValueT>::cols() const
+{
+    return m_impl ? m_impl->cols : 0;
+}
+
+template <typename ValueT>
+bool SVD_Solver<ValueT>::is_factored() const
+{
+    return m_impl && m_impl->factored;
+}
+
+// Explicit Instantiations
+template class Symmetric_Solver<float>;
+template class Symmetric_Solver<double>;
+template class Least_Squares_Solver<float>;
+template class Least_Squares_Solver<double>;
+template class SVD_Solver<float>;
+template class SVD_Solver<double>;
+
+} // End of tmns::math::linalg namespace
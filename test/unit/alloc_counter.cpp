@@ -0,0 +1,111 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    alloc_counter.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include "alloc_counter.hpp"
+
+// C++ Libraries
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+/// @brief Allocations seen so far
+std::atomic<size_t> g_allocation_count { 0 };
+
+} // End of anonymous namespace
+
+namespace tmns::test {
+
+size_t allocation_count()
+{
+    return g_allocation_count.load();
+}
+
+} // End of tmns::test namespace
+
+#if defined( __GLIBC__ )
+
+/**
+ * Interpose the C allocator, forwarding to glibc's own entry points.  free() is left
+ * alone since every block still comes from the glibc heap.
+ */
+extern "C" {
+
+void* __libc_malloc( size_t size );
+void* __libc_calloc( size_t count, size_t size );
+void* __libc_realloc( void* ptr, size_t size );
+
+void* malloc( size_t size ) noexcept
+{
+    g_allocation_count.fetch_add( 1, std::memory_order_relaxed );
+    return __libc_malloc( size );
+}
+
+void* calloc( size_t count, size_t size ) noexcept
+{
+    g_allocation_count.fetch_add( 1, std::memory_order_relaxed );
+    return __libc_calloc( count, size );
+}
+
+void* realloc( void* ptr, size_t size ) noexcept
+{
+    g_allocation_count.fetch_add( 1, std::memory_order_relaxed );
+    return __libc_realloc( ptr, size );
+}
+
+} // End of extern "C"
+
+#endif
+
+/**
+ * Global operator new / delete on malloc / free, so allocations and releases always
+ * match.  With glibc the count is taken in malloc().
+ */
+void* operator new( size_t size )
+{
+#if !defined( __GLIBC__ )
+    g_allocation_count.fetch_add( 1, std::memory_order_relaxed );
+#endif
+    if( void* ptr = std::malloc( size ? size : 1 ) )
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[]( size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void* ptr, size_t ) noexcept
+{
+    std::free( ptr );
+}
@@ -0,0 +1,31 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    alloc_counter.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+
+namespace tmns::test {
+
+/**
+ * Number of heap allocations made by the test executable so far.
+ *
+ * On glibc, malloc, calloc and realloc are counted, so allocations made by Eigen and
+ * inside the library are seen as well as those from the global operator new.  Elsewhere
+ * only the global operator new is counted.
+ */
+size_t allocation_count();
+
+} // End of tmns::test namespace
@@ -0,0 +1,226 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_batched_solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/batched_solvers.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Build a random SPD matrix as M^T M + N I
+ */
+template <size_t N>
+tmx::Matrix<double,N,N> random_spd( std::mt19937& rng )
+{
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+    tmx::Matrix<double,N,N> M;
+    for( size_t r = 0; r < N; r++ )
+    {
+        for( size_t c = 0; c < N; c++ )
+        {
+            M( r, c ) = dist( rng );
+        }
+    }
+
+    tmx::Matrix<double,N,N> A;
+    for( size_t r = 0; r < N; r++ )
+    {
+        for( size_t c = 0; c < N; c++ )
+        {
+            double s = ( r == c ) ? double( N ) : 0.0;
+            for( size_t k = 0; k < N; k++ )
+            {
+                s += M( k, r ) * M( k, c );
+            }
+            A( r, c ) = s;
+        }
+    }
+    return A;
+}
+
+/********************************************/
+/*      Test the fixed-size kernels         */
+/********************************************/
+TEST( linalg_batched_solvers, fixed_size_kernels )
+{
+    tmx::Matrix<double,3,3> A( { 4, 1, 2,
+                                 1, 5, 3,
+                                 2, 3, 6 } );
+    tmx::Vector_<double,3> b( { 1, 2, 3 } );
+    tmx::Vector_<double,3> x;
+
+    ASSERT_EQ( tmx::linalg::Solve_Status::SUCCESS, tmx::linalg::cholesky_solve( A, b, x ) );
+    tmx::Vector_<double,3> Ax = A * x;
+    for( size_t i = 0; i < 3; i++ )
+    {
+        EXPECT_NEAR( b[i], Ax[i], 1e-12 );
+    }
+
+    // Zero leading pivot forces a row swap in the LU
+    tmx::Matrix<double,3,3> G( { 0, 2, 1,
+                                 1, 1, 1,
+                                 3, 0, 2 } );
+    ASSERT_EQ( tmx::linalg::Solve_Status::SUCCESS, tmx::linalg::lu_solve( G, b, x ) );
+    tmx::Vector_<double,3> Gx = G * x;
+    for( size_t i = 0; i < 3; i++ )
+    {
+        EXPECT_NEAR( b[i], Gx[i], 1e-12 );
+    }
+
+    tmx::Matrix<double,2,2> S( { 1, 1,
+                                 1, 1 } );
+    tmx::Vector_<double,2> x2( { 7, 7 } );
+    EXPECT_EQ( tmx::linalg::Solve_Status::SINGULAR,
+               tmx::linalg::lu_solve( S, tmx::Vector_<double,2>( { 1, 2 } ), x2 ) );
+    EXPECT_EQ( 7, x2[0] );
+}
+
+/********************************************/
+/*      Test the batched SPD solver         */
+/********************************************/
+TEST( linalg_batched_solvers, batch_solve_symmetric )
+{
+    // Odd count so the final lane group is partial
+    const size_t count = 1003;
+    std::mt19937 rng( 42 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    std::vector<tmx::Matrix<double,4,4>> A( count );
+    std::vector<tmx::Vector_<double,4>>  b( count );
+    std::vector<tmx::Vector_<double,4>>  x( count );
+    std::vector<tmx::linalg::Solve_Status> status( count );
+    for( size_t p = 0; p < count; p++ )
+    {
+        A[p] = random_spd<4>( rng );
+        for( size_t i = 0; i < 4; i++ )
+        {
+            b[p][i] = dist( rng );
+        }
+    }
+
+    // Make one problem indefinite, it must not disturb its neighbours
+    A[5]( 2, 2 ) = -10;
+
+    tmx::linalg::Batch_Solver_Options options;
+    options.num_threads = 4;
+    options.grain_size  = 64;
+    auto res = tmx::linalg::batch_solve_symmetric<double,4>( A, b, x, status, options );
+    ASSERT_FALSE( res.has_error() );
+
+    for( size_t p = 0; p < count; p++ )
+    {
+        if( p == 5 )
+        {
+            EXPECT_EQ( tmx::linalg::Solve_Status::NOT_POSITIVE_DEFINITE, status[p] );
+            continue;
+        }
+        ASSERT_EQ( tmx::linalg::Solve_Status::SUCCESS, status[p] );
+        tmx::Vector_<double,4> Ax = A[p] * x[p];
+        for( size_t i = 0; i < 4; i++ )
+        {
+            EXPECT_NEAR( b[p][i], Ax[i], 1e-10 );
+        }
+    }
+
+    // Mismatched sizes are rejected
+    std::vector<tmx::Vector_<double,4>> short_x( count - 1 );
+    EXPECT_TRUE( ( tmx::linalg::batch_solve_symmetric<double,4>( A, b, short_x, status ).has_error() ) );
+}
+
+/********************************************/
+/*      Test the SoA batched SPD solver     */
+/********************************************/
+TEST( linalg_batched_solvers, batch_solve_symmetric_soa )
+{
+    const size_t count = 37;
+    std::vector<float> A( 4 * count ), b( 2 * count ), x( 2 * count );
+    std::vector<tmx::linalg::Solve_Status> status( count );
+
+    // Problem p:  [ p+2  1 ; 1  2 ] x = [ 1 ; p ]
+    for( size_t p = 0; p < count; p++ )
+    {
+        A[0 * count + p] = float( p + 2 );
+        A[1 * count + p] = 1;
+        A[2 * count + p] = 1;
+        A[3 * count + p] = 2;
+        b[0 * count + p] = 1;
+        b[1 * count + p] = float( p );
+    }
+
+    auto res = tmx::linalg::batch_solve_symmetric_soa<float,2>( count, A, b, x, status );
+    ASSERT_FALSE( res.has_error() );
+
+    for( size_t p = 0; p < count; p++ )
+    {
+        ASSERT_EQ( tmx::linalg::Solve_Status::SUCCESS, status[p] );
+        float a   = float( p + 2 );
+        float det = 2 * a - 1;
+        EXPECT_NEAR( ( 2 - float( p ) ) / det, x[0 * count + p], 1e-5 );
+        EXPECT_NEAR( ( a * float( p ) - 1 ) / det, x[1 * count + p], 1e-5 );
+    }
+}
+
+/********************************************/
+/*      Test the batched LU solver          */
+/********************************************/
+TEST( linalg_batched_solvers, batch_solve )
+{
+    const size_t count = 257;
+    std::mt19937 rng( 7 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    std::vector<tmx::Matrix<double,3,3>> A( count );
+    std::vector<tmx::Vector_<double,3>>  b( count );
+    std::vector<tmx::Vector_<double,3>>  x( count );
+    std::vector<tmx::linalg::Solve_Status> status( count );
+    for( size_t p = 0; p < count; p++ )
+    {
+        for( size_t i = 0; i < 3; i++ )
+        {
+            for( size_t j = 0; j < 3; j++ )
+            {
+                A[p]( i, j ) = dist( rng ) + ( i == j ? 3.0 : 0.0 );
+            }
+            b[p][i] = dist( rng );
+        }
+    }
+    A[100] = tmx::Matrix<double,3,3>();
+
+    tmx::linalg::Batch_Solver_Options options;
+    options.num_threads = 3;
+    options.grain_size  = 16;
+    ASSERT_FALSE( ( tmx::linalg::batch_solve<double,3>( A, b, x, status, options ).has_error() ) );
+
+    for( size_t p = 0; p < count; p++ )
+    {
+        if( p == 100 )
+        {
+            EXPECT_EQ( tmx::linalg::Solve_Status::SINGULAR, status[p] );
+            continue;
+        }
+        ASSERT_EQ( tmx::linalg::Solve_Status::SUCCESS, status[p] );
+        tmx::Vector_<double,3> Ax = A[p] * x[p];
+        for( size_t i = 0; i < 3; i++ )
+        {
+            EXPECT_NEAR( b[p][i], Ax[i], 1e-10 );
+        }
+    }
+}
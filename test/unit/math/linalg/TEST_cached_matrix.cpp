@@ -0,0 +1,160 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_cached_matrix.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/cached_matrix.hpp>
+
+// C++ Libraries
+#include <thread>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/********************************************/
+/*      Test Caching and Invalidation       */
+/********************************************/
+TEST( linalg_cached_matrix, invalidation )
+{
+    tmx::linalg::Cached_Matrix<tmx::MatrixN<double>> A( tmx::MatrixN<double>( 3, 3, { 4, 1, 0,
+                                                                                     1, 3, 1,
+                                                                                     0, 1, 2 } ) );
+    EXPECT_EQ( 0u, A.version() );
+    EXPECT_NEAR( A.matrix().determinant(), A.determinant(), 1e-12 );
+
+    // Repeated queries return the same cached object
+    const auto* inv = &A.inverse();
+    const auto* lu  = &A.lu();
+    EXPECT_EQ( inv, &A.inverse() );
+    EXPECT_EQ( lu,  &A.lu() );
+    EXPECT_TRUE( A.cholesky().is_positive_definite() );
+    EXPECT_EQ( 3u, A.svd().rank() );
+    EXPECT_EQ( 0u, A.version() );
+
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            double s = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                s += A.matrix()( r, k ) * A.inverse()( k, c );
+            }
+            EXPECT_NEAR( r == c ? 1.0 : 0.0, s, 1e-12 );
+        }
+    }
+    EXPECT_EQ( 0u, A.version() );
+
+    // Mutations bump the version and invalidate every entry
+    A.set( 0, 0, -4 );
+    EXPECT_EQ( 1u, A.version() );
+    EXPECT_NEAR( A.matrix().determinant(), A.determinant(), 1e-12 );
+    EXPECT_FALSE( A.cholesky().is_positive_definite() );
+
+    A.modify( []( tmx::MatrixN<double>& m )
+    {
+        m( 2, 0 ) = -4;
+        m( 2, 1 ) = 1;
+        m( 2, 2 ) = 0;
+    });
+    EXPECT_EQ( 2u, A.version() );
+    EXPECT_EQ( 2u, A.svd().rank() );
+    EXPECT_NEAR( 0.0, A.determinant(), 1e-12 );
+
+    A = tmx::MatrixN<double>( 3, 3, { 1, 2, 3, 2, 4, 6, 1, 1, 1 } );
+    EXPECT_EQ( 3u, A.version() );
+    EXPECT_THROW( A.inverse(), std::runtime_error );
+}
+
+/********************************************/
+/*      Test Fixed-Size Matrices            */
+/********************************************/
+TEST( linalg_cached_matrix, fixed_size )
+{
+    tmx::Matrix<double,2,2> m( { 2, 1,
+                                 1, 3 } );
+    tmx::linalg::Cached_Matrix<tmx::Matrix<double,2,2>> A( m );
+
+    const tmx::Matrix<double,2,2>& inv = A.inverse();
+    EXPECT_NEAR(  0.6, inv( 0, 0 ), 1e-12 );
+    EXPECT_NEAR( -0.2, inv( 0, 1 ), 1e-12 );
+    EXPECT_NEAR(  0.4, inv( 1, 1 ), 1e-12 );
+    EXPECT_NEAR(  5.0, A.determinant(), 1e-12 );
+}
+
+/********************************************/
+/*      Test Concurrent Readers             */
+/********************************************/
+TEST( linalg_cached_matrix, concurrent_readers )
+{
+    const size_t n = 40;
+    tmx::MatrixN<double> m( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            m( r, c ) = ( r == c ) ? 10.0 : 1.0 / double( 1 + r + c );
+        }
+    }
+    const tmx::linalg::Cached_Matrix<tmx::MatrixN<double>> A( m );
+
+    std::vector<const void*> seen( 8 );
+    std::vector<double>      dets( 8 );
+    std::vector<std::thread> threads;
+    for( size_t t = 0; t < 8; t++ )
+    {
+        threads.emplace_back( [&, t]()
+        {
+            for( int i = 0; i < 50; i++ )
+            {
+                seen[t] = &A.inverse();
+                dets[t] = A.determinant();
+                (void)A.cholesky();
+            }
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    for( size_t t = 1; t < 8; t++ )
+    {
+        EXPECT_EQ( seen[0], seen[t] );
+        EXPECT_EQ( dets[0], dets[t] );
+    }
+    EXPECT_GT( dets[0], 0.0 );
+}
+
+/********************************************/
+/*      Test Non-Square Matrices            */
+/********************************************/
+TEST( linalg_cached_matrix, non_square )
+{
+    tmx::linalg::Cached_Matrix<tmx::MatrixN<double>> A( tmx::MatrixN<double>( 2, 3, { 1, 2, 3,
+                                                                                     4, 5, 6 } ) );
+    EXPECT_THROW( A.lu(), std::runtime_error );
+    EXPECT_THROW( A.cholesky(), std::runtime_error );
+    EXPECT_THROW( A.determinant(), std::runtime_error );
+    EXPECT_THROW( A.inverse(), std::runtime_error );
+    EXPECT_EQ( 2u, A.svd().rank() );
+
+    // Element writes after a query invalidate it
+    A = tmx::MatrixN<double>( 2, 2, { 2, 0,
+                                      0, 2 } );
+    EXPECT_NEAR( 4.0, A.determinant(), 1e-12 );
+    A.set( 1, 1, 5 );
+    EXPECT_NEAR( 10.0, A.determinant(), 1e-12 );
+    EXPECT_NEAR( 0.2, A.inverse()( 1, 1 ), 1e-12 );
+}
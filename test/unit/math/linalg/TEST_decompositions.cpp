@@ -0,0 +1,275 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_decompositions.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/cholesky_decomposition.hpp>
+#include <terminus/math/linalg/lu_decomposition.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Random n x n matrix, optionally made symmetric positive definite
+ */
+tmx::MatrixN<double> random_matrix( size_t n, uint32_t seed, bool spd )
+{
+    std::mt19937 rng( seed );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+    tmx::MatrixN<double> A( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r, c ) = dist( rng );
+        }
+    }
+    if( !spd )
+    {
+        return A;
+    }
+    tmx::MatrixN<double> S( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            double s = ( r == c ) ? double( n ) : 0.0;
+            for( size_t k = 0; k < n; k++ )
+            {
+                s += A( r, k ) * A( c, k );
+            }
+            S( r, c ) = s;
+        }
+    }
+    return S;
+}
+
+/**
+ * Max |A x - b|
+ */
+double residual( const tmx::MatrixN<double>& A,
+                 const tmx::VectorN<double>& x,
+                 const tmx::VectorN<double>& b,
+                 bool                        transpose = false )
+{
+    double worst = 0;
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        double s = -b[r];
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            s += ( transpose ? A( c, r ) : A( r, c ) ) * x[c];
+        }
+        worst = std::max( worst, std::abs( s ) );
+    }
+    return worst;
+}
+
+/********************************************/
+/*      Test LU Solves                      */
+/********************************************/
+TEST( linalg_decompositions, lu_solve )
+{
+    for( size_t n : { 1, 3, 7, 70 } )
+    {
+        auto A = random_matrix( n, 11 + n, false );
+        tmx::VectorN<double> b( n );
+        for( size_t i = 0; i < n; i++ )
+        {
+            b[i] = double( i ) - 2.0;
+        }
+
+        tmx::linalg::LU_Decomposition<double> lu( A );
+        ASSERT_TRUE( lu.is_computed() );
+        ASSERT_FALSE( lu.is_singular() );
+
+        auto x = lu.solve( b );
+        ASSERT_FALSE( x.has_error() );
+        EXPECT_LT( residual( A, x.value(), b ), 1e-10 );
+
+        tmx::VectorN<double> xt;
+        ASSERT_FALSE( lu.solve_transpose( b, xt ).has_error() );
+        EXPECT_LT( residual( A, xt, b, true ), 1e-10 );
+
+        auto inv = lu.inverse();
+        ASSERT_FALSE( inv.has_error() );
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < n; c++ )
+            {
+                double s = 0;
+                for( size_t k = 0; k < n; k++ )
+                {
+                    s += A( r, k ) * inv.value()( k, c );
+                }
+                EXPECT_NEAR( r == c ? 1.0 : 0.0, s, 1e-10 );
+            }
+        }
+    }
+}
+
+/********************************************/
+/*      Test LU Determinant                 */
+/********************************************/
+TEST( linalg_decompositions, lu_determinant )
+{
+    tmx::MatrixN<double> A( 3, 3, { 0, 2, 1,
+                                    1, 1, 0,
+                                    3, 0, 4 } );
+    tmx::linalg::LU_Decomposition<double> lu( A );
+    EXPECT_NEAR( A.determinant(), lu.determinant(), 1e-12 );
+
+    // Singular and non-square input
+    tmx::MatrixN<double> S( 2, 2, { 1, 2, 2, 4 } );
+    ASSERT_FALSE( lu.compute( S ).has_error() );
+    EXPECT_TRUE( lu.is_singular() );
+    EXPECT_EQ( 0.0, lu.determinant() );
+    EXPECT_TRUE( lu.solve( tmx::VectorN<double>( { 1, 1 } ) ).has_error() );
+
+    EXPECT_TRUE( lu.compute( tmx::MatrixN<double>( 2, 3 ) ).has_error() );
+    EXPECT_FALSE( lu.is_computed() );
+}
+
+/********************************************/
+/*      Test Cholesky                       */
+/********************************************/
+TEST( linalg_decompositions, cholesky )
+{
+    for( size_t n : { 1, 4, 65 } )
+    {
+        auto A = random_matrix( n, 5 + n, true );
+        tmx::VectorN<double> b( n, 1.0 );
+
+        tmx::linalg::Cholesky_Decomposition<double> llt( A );
+        ASSERT_TRUE( llt.is_positive_definite() );
+
+        auto x = llt.solve( b );
+        ASSERT_FALSE( x.has_error() );
+        EXPECT_LT( residual( A, x.value(), b ), 1e-10 );
+
+        tmx::linalg::LU_Decomposition<double> lu( A );
+        EXPECT_NEAR( 1.0, llt.determinant() / lu.determinant(), 1e-9 );
+
+        auto inv = llt.inverse();
+        ASSERT_FALSE( inv.has_error() );
+        auto lu_inv = lu.inverse();
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < n; c++ )
+            {
+                EXPECT_NEAR( lu_inv.value()( r, c ), inv.value()( r, c ), 1e-10 );
+            }
+        }
+    }
+
+    // Indefinite
+    tmx::linalg::Cholesky_Decomposition<double> llt( tmx::MatrixN<double>( 2, 2, { 1, 2, 2, 1 } ) );
+    EXPECT_TRUE( llt.is_computed() );
+    EXPECT_FALSE( llt.is_positive_definite() );
+    EXPECT_TRUE( llt.solve( tmx::VectorN<double>( { 1, 1 } ) ).has_error() );
+}
+
+/**
+ * Exact 1-norm of a dense matrix
+ */
+double norm_1( const tmx::MatrixN<double>& A )
+{
+    double best = 0;
+    for( size_t c = 0; c < A.cols(); c++ )
+    {
+        double s = 0;
+        for( size_t r = 0; r < A.rows(); r++ )
+        {
+            s += std::abs( A( r, c ) );
+        }
+        best = std::max( best, s );
+    }
+    return best;
+}
+
+/********************************************/
+/*      Test Condition Estimation           */
+/********************************************/
+TEST( linalg_decompositions, condition_estimate )
+{
+    // Hilbert matrices are SPD and badly conditioned
+    for( size_t n : { 3, 6, 9 } )
+    {
+        tmx::MatrixN<double> H( n, n );
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < n; c++ )
+            {
+                H( r, c ) = 1.0 / double( r + c + 1 );
+            }
+        }
+
+        tmx::linalg::LU_Decomposition<double> lu( H );
+        tmx::linalg::Cholesky_Decomposition<double> llt( H );
+        const double exact = norm_1( H ) * norm_1( lu.inverse().value() );
+
+        for( const auto& info : { lu.condition(), llt.condition() } )
+        {
+            EXPECT_NEAR( norm_1( H ), info.norm_1, 1e-14 );
+            EXPECT_LE( info.condition(), exact * 1.0001 );
+            EXPECT_GE( info.condition(), exact / 3.0 );
+        }
+        EXPECT_EQ( n == 9, lu.condition().is_ill_conditioned() );
+    }
+
+    // Cholesky reads only the lower triangle, for the norm as well as the factor
+    {
+        auto A = random_matrix( 8, 17, true );
+        tmx::MatrixN<double> lower( A );
+        for( size_t r = 0; r < 8; r++ )
+        {
+            for( size_t c = r + 1; c < 8; c++ )
+            {
+                lower( r, c ) = 0;
+            }
+        }
+        tmx::linalg::Cholesky_Decomposition<double> full_llt( A );
+        tmx::linalg::Cholesky_Decomposition<double> lower_llt( lower );
+        ASSERT_TRUE( full_llt.is_positive_definite() );
+        EXPECT_NEAR( norm_1( A ), lower_llt.condition().norm_1, 1e-12 );
+        EXPECT_NEAR( full_llt.condition().rcond, lower_llt.condition().rcond, 1e-14 );
+    }
+
+    // Random non-symmetric matrices, returned alongside the solution
+    for( size_t n : { 2, 10, 50 } )
+    {
+        auto A = random_matrix( n, 31 + n, false );
+        tmx::linalg::LU_Decomposition<double> lu( A );
+        const double exact = norm_1( A ) * norm_1( lu.inverse().value() );
+
+        tmx::VectorN<double> b( n, 1.0 ), x;
+        auto info = lu.solve_with_condition( b, x );
+        ASSERT_FALSE( info.has_error() );
+        EXPECT_LT( residual( A, x, b ), 1e-9 );
+        EXPECT_LE( info.value().condition(), exact * 1.0001 );
+        EXPECT_GE( info.value().condition(), exact / 3.0 );
+        EXPECT_FALSE( info.value().is_ill_conditioned() );
+    }
+
+    // Singular
+    tmx::linalg::LU_Decomposition<double> lu( tmx::MatrixN<double>( 2, 2, { 1, 2, 2, 4 } ) );
+    EXPECT_EQ( 0.0, lu.condition().rcond );
+    EXPECT_TRUE( lu.condition().is_ill_conditioned() );
+    tmx::VectorN<double> x;
+    EXPECT_TRUE( lu.solve_with_condition( tmx::VectorN<double>( { 1, 1 } ), x ).has_error() );
+}
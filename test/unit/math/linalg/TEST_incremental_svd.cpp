@@ -0,0 +1,181 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_incremental_svd.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/incremental_svd.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * m x t matrix of the given rank with singular values 10, 5, 2.5, ...
+ */
+tmx::MatrixN<double> low_rank_matrix( size_t m, size_t t, size_t rank, uint32_t seed )
+{
+    std::mt19937 rng( seed );
+    std::normal_distribution<double> dist( 0.0, 1.0 );
+    tmx::MatrixN<double> L( m, rank ), R( rank, t ), X( m, t );
+    for( size_t i = 0; i < m * rank; i++ )
+    {
+        L.data()[i] = dist( rng );
+    }
+    for( size_t i = 0; i < rank * t; i++ )
+    {
+        R.data()[i] = dist( rng ) * 10.0 / double( 1 << ( i / t ) );
+    }
+    for( size_t r = 0; r < m; r++ )
+    {
+        for( size_t c = 0; c < t; c++ )
+        {
+            double s = 0;
+            for( size_t k = 0; k < rank; k++ )
+            {
+                s += L( r, k ) * R( k, c );
+            }
+            X( r, c ) = s;
+        }
+    }
+    return X;
+}
+
+/**
+ * Largest deviation of Q^T Q from the identity
+ */
+double orthogonality_error( const tmx::MatrixN<double>& Q )
+{
+    double err = 0;
+    for( size_t a = 0; a < Q.cols(); a++ )
+    {
+        for( size_t b = 0; b < Q.cols(); b++ )
+        {
+            double d = 0;
+            for( size_t i = 0; i < Q.rows(); i++ )
+            {
+                d += Q( i, a ) * Q( i, b );
+            }
+            err = std::max( err, std::abs( d - ( a == b ? 1.0 : 0.0 ) ) );
+        }
+    }
+    return err;
+}
+
+/********************************************/
+/*      Test Exact Low-Rank Streams         */
+/********************************************/
+TEST( linalg_incremental_svd, low_rank_stream )
+{
+    const size_t m = 40;
+    const size_t t = 120;
+    auto X = low_rank_matrix( m, t, 4, 2 );
+
+    tmx::linalg::Incremental_SVD_Options options;
+    options.reorthogonalize_interval = 50;
+    tmx::linalg::Incremental_SVD<double> isvd( m, options );
+    ASSERT_FALSE( isvd.add_columns( X ).has_error() );
+    EXPECT_EQ( t, isvd.columns_seen() );
+    ASSERT_EQ( 4u, isvd.rank() );
+
+    // Singular values agree with a batch decomposition
+    tmx::linalg::SVD_Solver<double> batch;
+    ASSERT_FALSE( batch.factor( X ).has_error() );
+    tmx::VectorN<double> S;
+    batch.singular_values( S );
+    for( size_t i = 0; i < 4; i++ )
+    {
+        EXPECT_NEAR( S[i], isvd.singular_values()[i], 1e-9 * S[0] );
+    }
+
+    // U diag(S) V^T reproduces the data
+    const auto& U = isvd.matrix_u();
+    const auto& V = isvd.matrix_v();
+    ASSERT_EQ( t, V.rows() );
+    for( size_t r = 0; r < m; r++ )
+    {
+        for( size_t c = 0; c < t; c++ )
+        {
+            double s = 0;
+            for( size_t k = 0; k < 4; k++ )
+            {
+                s += U( r, k ) * isvd.singular_values()[k] * V( c, k );
+            }
+            ASSERT_NEAR( X( r, c ), s, 1e-9 * S[0] );
+        }
+    }
+    EXPECT_LT( orthogonality_error( U ), 1e-12 );
+    EXPECT_LT( orthogonality_error( V ), 1e-12 );
+
+    EXPECT_TRUE( isvd.add_column( tmx::VectorN<double>( m + 1 ) ).has_error() );
+    isvd.reset();
+    EXPECT_EQ( 0u, isvd.rank() );
+    EXPECT_EQ( 0u, isvd.columns_seen() );
+}
+
+/********************************************/
+/*      Test Fixed-Rank, Bounded Memory     */
+/********************************************/
+TEST( linalg_incremental_svd, fixed_rank )
+{
+    const size_t m = 30;
+    const size_t t = 400;
+
+    // Dominant rank-2 signal plus small full-rank noise
+    auto X = low_rank_matrix( m, t, 2, 5 );
+    std::mt19937 rng( 17 );
+    std::normal_distribution<double> noise( 0.0, 0.01 );
+    for( size_t i = 0; i < m * t; i++ )
+    {
+        X.data()[i] += noise( rng );
+    }
+
+    tmx::linalg::Incremental_SVD_Options options;
+    options.max_rank  = 2;
+    options.compute_v = false;
+    tmx::linalg::Incremental_SVD<double> isvd( m, options );
+    ASSERT_FALSE( isvd.add_columns( X ).has_error() );
+
+    ASSERT_EQ( 2u, isvd.rank() );
+    EXPECT_EQ( 0u, isvd.matrix_v().rows() );
+    EXPECT_EQ( m, isvd.matrix_u().rows() );
+    EXPECT_LT( orthogonality_error( isvd.matrix_u() ), 1e-12 );
+
+    tmx::linalg::SVD_Solver<double> batch;
+    ASSERT_FALSE( batch.factor( X ).has_error() );
+    tmx::VectorN<double> S;
+    batch.singular_values( S );
+    EXPECT_NEAR( S[0], isvd.singular_values()[0], 1e-3 * S[0] );
+    EXPECT_NEAR( S[1], isvd.singular_values()[1], 1e-3 * S[0] );
+
+    // The tracked subspace matches the dominant batch subspace:  ||U_b^T U|| ~ 1 per column
+    tmx::MatrixN<double> Ub;
+    batch.matrix_u( Ub );
+    for( size_t k = 0; k < 2; k++ )
+    {
+        double proj = 0;
+        for( size_t j = 0; j < 2; j++ )
+        {
+            double d = 0;
+            for( size_t i = 0; i < m; i++ )
+            {
+                d += Ub( i, j ) * isvd.matrix_u()( i, k );
+            }
+            proj += d * d;
+        }
+        EXPECT_NEAR( 1.0, proj, 1e-4 );
+    }
+}
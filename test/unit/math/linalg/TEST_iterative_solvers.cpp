@@ -0,0 +1,286 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_iterative_solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/iterative_solvers.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Matrix-free 2D Poisson operator on a k x k grid with Dirichlet boundaries
+ */
+class Poisson_Operator
+{
+    public:
+
+        explicit Poisson_Operator( size_t k ) : m_k( k ) {}
+
+        size_t rows() const { return m_k * m_k; }
+        size_t cols() const { return m_k * m_k; }
+
+        void apply( const tmx::VectorN<double>& x,
+                    tmx::VectorN<double>&       y ) const
+        {
+            for( size_t r = 0; r < m_k; r++ )
+            {
+                for( size_t c = 0; c < m_k; c++ )
+                {
+                    const size_t i = r * m_k + c;
+                    double s = 4 * x[i];
+                    if( r > 0 )       { s -= x[i - m_k]; }
+                    if( r + 1 < m_k ) { s -= x[i + m_k]; }
+                    if( c > 0 )       { s -= x[i - 1]; }
+                    if( c + 1 < m_k ) { s -= x[i + 1]; }
+                    y[i] = s;
+                }
+            }
+        }
+
+    private:
+
+        size_t m_k;
+};
+
+/**
+ * Dense copy of the Poisson operator, with an optional diagonal shift
+ */
+tmx::MatrixN<double> dense_poisson( size_t k, double shift = 0 )
+{
+    Poisson_Operator op( k );
+    tmx::MatrixN<double> A( k * k, k * k );
+    tmx::VectorN<double> e( k * k ), col( k * k );
+    for( size_t j = 0; j < k * k; j++ )
+    {
+        e[j] = 1;
+        op.apply( e, col );
+        for( size_t i = 0; i < k * k; i++ )
+        {
+            A( i, j ) = col[i] + ( i == j ? shift : 0.0 );
+        }
+        e[j] = 0;
+    }
+    return A;
+}
+
+/**
+ * Residual norm ||b - Ax|| for any operator
+ */
+template <typename OperatorT>
+double residual( const OperatorT& A, const tmx::VectorN<double>& b, const tmx::VectorN<double>& x )
+{
+    tmx::VectorN<double> Ax( A.rows() );
+    A.apply( x, Ax );
+    double s = 0;
+    for( size_t i = 0; i < b.size(); i++ )
+    {
+        s += ( b[i] - Ax[i] ) * ( b[i] - Ax[i] );
+    }
+    return std::sqrt( s );
+}
+
+/********************************************/
+/*      Test Conjugate Gradient             */
+/********************************************/
+TEST( linalg_iterative_solvers, conjugate_gradient )
+{
+    const size_t k = 12;
+    Poisson_Operator A( k );
+    tmx::VectorN<double> b( k * k );
+    for( size_t i = 0; i < b.size(); i++ )
+    {
+        b[i] = 1.0 + 0.01 * i;
+    }
+
+    tmx::linalg::Conjugate_Gradient_Solver<double> solver;
+    tmx::VectorN<double> x;
+    auto res = solver.solve( A, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    EXPECT_LT( residual( A, b, x ), 1e-8 );
+    const size_t cg_iterations = res.value().iterations;
+
+    // A converged x as the initial guess needs no further work
+    res = solver.solve( A, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_EQ( 0u, res.value().iterations );
+
+    // Incomplete Cholesky needs far fewer iterations than plain CG
+    auto dense = dense_poisson( k );
+    tmx::linalg::Incomplete_Cholesky_Preconditioner<double> ic;
+    ASSERT_FALSE( ic.compute( dense ).has_error() );
+    x = tmx::VectorN<double>( k * k );
+    res = solver.solve( A, b, x, ic );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    EXPECT_LT( residual( A, b, x ), 1e-8 );
+    EXPECT_LT( res.value().iterations, cg_iterations );
+
+    // Jacobi on a badly scaled system
+    tmx::MatrixN<double> S = dense_poisson( k, 1 );
+    for( size_t i = 0; i < k * k; i++ )
+    {
+        S( i, i ) += 100.0 * ( i % 7 );
+    }
+    tmx::linalg::Dense_Operator S_op( S );
+    tmx::linalg::Jacobi_Preconditioner<double> jacobi;
+    jacobi.compute( S );
+    x = tmx::VectorN<double>( k * k );
+    res = solver.solve( S_op, b, x, jacobi );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    EXPECT_LT( residual( S_op, b, x ), 1e-8 );
+
+    // Indefinite operators are rejected
+    auto N = dense_poisson( k, -5 );
+    tmx::linalg::Dense_Operator N_op( N );
+    x = tmx::VectorN<double>( k * k );
+    EXPECT_TRUE( solver.solve( N_op, b, x ).has_error() );
+
+    // Iteration limit is respected
+    solver.set_options( { 3, 1e-12, 0 } );
+    x = tmx::VectorN<double>( k * k );
+    res = solver.solve( A, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_EQ( 3u, res.value().iterations );
+    EXPECT_FALSE( res.value().converged );
+}
+
+/********************************************/
+/*      Test MINRES                         */
+/********************************************/
+TEST( linalg_iterative_solvers, minres )
+{
+    const size_t k = 8;
+
+    // Shift the Poisson spectrum so it straddles zero
+    auto A = dense_poisson( k, -3.3 );
+    tmx::linalg::Dense_Operator A_op( A );
+    tmx::VectorN<double> b( k * k );
+    for( size_t i = 0; i < b.size(); i++ )
+    {
+        b[i] = std::sin( 0.3 * i );
+    }
+
+    tmx::linalg::MINRES_Solver<double> solver( { 0, 1e-12, 0 } );
+    tmx::VectorN<double> x;
+    auto res = solver.solve( A_op, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    EXPECT_LT( residual( A_op, b, x ), 1e-9 );
+
+    // The residual estimate tracks the true residual
+    EXPECT_NEAR( residual( A_op, b, x ), res.value().residual_norm, 1e-9 );
+
+    // Preconditioned with an SPD preconditioner
+    tmx::linalg::Jacobi_Preconditioner<double> jacobi( tmx::VectorN<double>( k * k, 4.0 ) );
+    x = tmx::VectorN<double>( k * k );
+    res = solver.solve( A_op, b, x, jacobi );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    EXPECT_LT( residual( A_op, b, x ), 1e-9 );
+}
+
+/********************************************/
+/*      Test LSQR and LSMR                  */
+/********************************************/
+TEST( linalg_iterative_solvers, least_squares )
+{
+    const size_t m = 40;
+    const size_t n = 10;
+    std::mt19937 rng( 11 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    tmx::MatrixN<double> A( m, n );
+    for( size_t r = 0; r < m; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r, c ) = dist( rng );
+        }
+    }
+    tmx::linalg::Dense_Operator A_op( A );
+
+    // Consistent system recovers the exact solution
+    tmx::VectorN<double> x_exp( n );
+    for( size_t c = 0; c < n; c++ )
+    {
+        x_exp[c] = double( c ) - 4.5;
+    }
+    tmx::VectorN<double> b( m );
+    A_op.apply( x_exp, b );
+
+    tmx::linalg::LSQR_Solver<double> lsqr( { 0, 1e-12, 0 } );
+    tmx::linalg::LSMR_Solver<double> lsmr( { 0, 1e-12, 0 } );
+
+    tmx::VectorN<double> x;
+    auto res = lsqr.solve( A_op, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    ASSERT_EQ( n, x.size() );
+    for( size_t c = 0; c < n; c++ )
+    {
+        EXPECT_NEAR( x_exp[c], x[c], 1e-8 );
+    }
+
+    x = tmx::VectorN<double>();
+    res = lsmr.solve( A_op, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    for( size_t c = 0; c < n; c++ )
+    {
+        EXPECT_NEAR( x_exp[c], x[c], 1e-8 );
+    }
+
+    // Inconsistent system satisfies the normal equations A^T (b - Ax) = 0
+    for( size_t r = 0; r < m; r++ )
+    {
+        b[r] += 0.1 * dist( rng );
+    }
+    auto check_normal_equations = [&]( const tmx::VectorN<double>& xs )
+    {
+        tmx::VectorN<double> r( m ), Atr( n );
+        A_op.apply( xs, r );
+        for( size_t i = 0; i < m; i++ )
+        {
+            r[i] = b[i] - r[i];
+        }
+        A_op.apply_transpose( r, Atr );
+        for( size_t c = 0; c < n; c++ )
+        {
+            EXPECT_NEAR( 0.0, Atr[c], 1e-8 );
+        }
+    };
+
+    x = tmx::VectorN<double>();
+    res = lsqr.solve( A_op, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    check_normal_equations( x );
+
+    x = tmx::VectorN<double>();
+    res = lsmr.solve( A_op, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().converged );
+    check_normal_equations( x );
+    EXPECT_NEAR( residual( A_op, b, x ), res.value().residual_norm, 1e-8 );
+
+    // Mismatched right-hand side
+    EXPECT_TRUE( lsqr.solve( A_op, tmx::VectorN<double>( m + 1 ), x ).has_error() );
+}
@@ -0,0 +1,185 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_matrix_functions.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/matrix_functions.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Max |A - B|
+ */
+template <typename Matrix1T, typename Matrix2T>
+double max_diff( const Matrix1T& A, const Matrix2T& B )
+{
+    double worst = 0;
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            worst = std::max( worst, std::abs( A( r, c ) - B( r, c ) ) );
+        }
+    }
+    return worst;
+}
+
+/**
+ * Random n x n matrix with entries in [-scale, scale]
+ */
+tmx::MatrixN<double> random_matrix( size_t n, double scale, uint32_t seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_real_distribution<double> dist( -scale, scale );
+    tmx::MatrixN<double> A( n, n );
+    for( size_t i = 0; i < n * n; i++ )
+    {
+        A.data()[i] = dist( rng );
+    }
+    return A;
+}
+
+/********************************************/
+/*      Test the Matrix Exponential         */
+/********************************************/
+TEST( linalg_matrix_functions, expm )
+{
+    // Diagonal
+    tmx::MatrixN<double> D( 2, 2, { 1.0, 0.0, 0.0, -2.0 } );
+    auto E = tmx::linalg::expm( D );
+    ASSERT_FALSE( E.has_error() );
+    EXPECT_NEAR( std::exp(  1.0 ), E.value()( 0, 0 ), 1e-14 );
+    EXPECT_NEAR( std::exp( -2.0 ), E.value()( 1, 1 ), 1e-15 );
+    EXPECT_NEAR( 0.0, E.value()( 0, 1 ), 1e-15 );
+
+    // Nilpotent
+    tmx::MatrixN<double> N( 2, 2, { 0.0, 1.0, 0.0, 0.0 } );
+    E = tmx::linalg::expm( N );
+    EXPECT_NEAR( 1.0, E.value()( 0, 1 ), 1e-15 );
+    EXPECT_NEAR( 1.0, E.value()( 1, 1 ), 1e-15 );
+
+    // Large norm exercises scaling and squaring
+    for( double angle : { 0.001, 0.5, 10.0, 40.0 } )
+    {
+        tmx::MatrixN<double> W( 2, 2, { 0.0, -angle, angle, 0.0 } );
+        E = tmx::linalg::expm( W );
+        ASSERT_FALSE( E.has_error() );
+        tmx::MatrixN<double> R( 2, 2, { std::cos( angle ), -std::sin( angle ),
+                                        std::sin( angle ),  std::cos( angle ) } );
+        EXPECT_LT( max_diff( R, E.value() ), 1e-13 * std::max( 1.0, angle ) );
+    }
+
+    EXPECT_TRUE( tmx::linalg::expm( tmx::MatrixN<double>( 2, 3 ) ).has_error() );
+}
+
+/********************************************/
+/*      Test Square Root and Logarithm      */
+/********************************************/
+TEST( linalg_matrix_functions, sqrtm_logm )
+{
+    for( size_t n : { 2, 5, 12 } )
+    {
+        // A = exp(X) with modest X has a real principal logarithm equal to X
+        auto X = random_matrix( n, 0.4, 17 + n );
+        auto A = tmx::linalg::expm( X ).value();
+
+        auto S = tmx::linalg::sqrtm( A );
+        ASSERT_FALSE( S.has_error() );
+        tmx::MatrixN<double> S2( n, n );
+        tmx::linalg::detail::square_multiply( S.value(), S.value(), S2 );
+        EXPECT_LT( max_diff( A, S2 ), 1e-12 );
+
+        auto L = tmx::linalg::logm( A );
+        ASSERT_FALSE( L.has_error() );
+        EXPECT_LT( max_diff( X, L.value() ), 1e-11 );
+    }
+
+    // No real principal square root or logarithm
+    tmx::MatrixN<double> Neg( 2, 2, { -1.0, 0.0, 0.0, -4.0 } );
+    EXPECT_TRUE( tmx::linalg::sqrtm( Neg ).has_error() );
+    EXPECT_TRUE( tmx::linalg::logm( Neg ).has_error() );
+    EXPECT_TRUE( tmx::linalg::sqrtm( tmx::MatrixN<double>( 2, 2 ) ).has_error() );
+}
+
+/********************************************/
+/*      Test Rotation Closed Forms          */
+/********************************************/
+TEST( linalg_matrix_functions, rotation )
+{
+    for( double angle : { 0.0, 1e-7, 0.3, 2.0, 3.14159, M_PI } )
+    {
+        const double ax = 0.6, ay = -0.48, az = 0.64;
+        tmx::Matrix<double,3,3> K( { 0.0,        -az * angle,  ay * angle,
+                                     az * angle,  0.0,        -ax * angle,
+                                    -ay * angle,  ax * angle,  0.0 } );
+
+        // Closed form matches the Pade path
+        auto R = tmx::linalg::expm( K );
+        ASSERT_FALSE( R.has_error() );
+        auto R_general = tmx::linalg::expm( tmx::MatrixN<double>( K ) ).value();
+        EXPECT_LT( max_diff( R.value(), R_general ), 1e-14 );
+        EXPECT_NEAR( 1.0, R.value().determinant(), 1e-14 );
+
+        // Round trip.  At exactly pi the axis sign is ambiguous, so compare rotations.
+        auto K2 = tmx::linalg::logm( R.value() );
+        ASSERT_FALSE( K2.has_error() );
+        if( angle < 3.14 )
+        {
+            EXPECT_LT( max_diff( K, K2.value() ), 1e-12 );
+        }
+        else
+        {
+            EXPECT_LT( max_diff( R.value(), tmx::linalg::expm_skew( K2.value() ) ), 1e-12 );
+        }
+    }
+}
+
+/********************************************/
+/*      Test Rigid Transform Closed Forms   */
+/********************************************/
+TEST( linalg_matrix_functions, rigid )
+{
+    for( double angle : { 0.0, 1e-6, 0.7, 2.5 } )
+    {
+        tmx::Matrix<double,4,4> G( { 0.0,          -0.8 * angle,  0.0,         1.0,
+                                     0.8 * angle,   0.0,         -0.6 * angle, -2.0,
+                                     0.0,           0.6 * angle,  0.0,          0.5,
+                                     0.0,           0.0,          0.0,          0.0 } );
+        auto T = tmx::linalg::expm( G );
+        ASSERT_FALSE( T.has_error() );
+        auto T_general = tmx::linalg::expm( tmx::MatrixN<double>( G ) ).value();
+        EXPECT_LT( max_diff( T.value(), T_general ), 1e-13 );
+
+        auto G2 = tmx::linalg::logm( T.value() );
+        ASSERT_FALSE( G2.has_error() );
+        EXPECT_LT( max_diff( G, G2.value() ), 1e-12 );
+
+        auto G_general = tmx::linalg::logm( tmx::MatrixN<double>( T.value() ) );
+        ASSERT_FALSE( G_general.has_error() );
+        EXPECT_LT( max_diff( G, G_general.value() ), 1e-10 );
+    }
+
+    // General fixed-size input falls back to the dense path
+    tmx::Matrix<double,3,3> A( { 1.0, 0.2, 0.0,
+                                 0.0, 2.0, 0.1,
+                                 0.3, 0.0, 1.5 } );
+    auto S = tmx::linalg::sqrtm( A );
+    ASSERT_FALSE( S.has_error() );
+    tmx::Matrix<double,3,3> S2 = S.value() * S.value();
+    EXPECT_LT( max_diff( A, S2 ), 1e-13 );
+}
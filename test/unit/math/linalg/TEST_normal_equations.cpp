@@ -0,0 +1,97 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_normal_equations.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/normal_equations.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Reference J^T J and J^T e from explicit loops
+ */
+static void reference_normal_equations( const tmx::MatrixN<double>& J,
+                                        const tmx::VectorN<double>& e,
+                                        tmx::MatrixN<double>&       JtJ,
+                                        tmx::VectorN<double>&       Jte )
+{
+    JtJ = tmx::MatrixN<double>( J.cols(), J.cols() );
+    Jte = tmx::VectorN<double>( J.cols() );
+    for( size_t i = 0; i < J.cols(); i++ )
+    {
+        for( size_t r = 0; r < J.rows(); r++ )
+        {
+            Jte[i] += J( r, i ) * e[r];
+            for( size_t j = 0; j < J.cols(); j++ )
+            {
+                JtJ( i, j ) += J( r, i ) * J( r, j );
+            }
+        }
+    }
+}
+
+/****************************************************/
+/*      Fused upper-triangle accumulation matches   */
+/*      the explicit product, serial and threaded   */
+/****************************************************/
+TEST( Normal_Equations, matches_explicit_product )
+{
+    std::mt19937 rng( 42 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    for( const size_t rows : { size_t( 7 ), size_t( 10000 ) } )
+    {
+        const size_t cols = 9;
+        tmx::MatrixN<double> J( rows, cols );
+        tmx::VectorN<double> e( rows );
+        for( size_t r = 0; r < rows; r++ )
+        {
+            e[r] = dist( rng );
+            for( size_t c = 0; c < cols; c++ )
+            {
+                // Leave some structural zeros
+                J( r, c ) = ( ( r + c ) % 4 == 0 ) ? 0.0 : dist( rng );
+            }
+        }
+
+        tmx::MatrixN<double> JtJ_ref, JtJ, JtJ_threaded;
+        tmx::VectorN<double> Jte_ref, Jte, Jte_threaded;
+        reference_normal_equations( J, e, JtJ_ref, Jte_ref );
+        ASSERT_FALSE( tmx::linalg::normal_equations( J, e, JtJ, Jte ).has_error() );
+        ASSERT_FALSE( tmx::linalg::normal_equations( J, e, JtJ_threaded, Jte_threaded, 4 ).has_error() );
+
+        ASSERT_EQ( JtJ.rows(), cols );
+        ASSERT_EQ( JtJ.cols(), cols );
+        ASSERT_EQ( Jte.size(), cols );
+        for( size_t i = 0; i < cols; i++ )
+        {
+            EXPECT_NEAR( Jte[i], Jte_ref[i], 1e-9 );
+            EXPECT_NEAR( Jte_threaded[i], Jte_ref[i], 1e-9 );
+            for( size_t j = 0; j < cols; j++ )
+            {
+                EXPECT_NEAR( JtJ( i, j ), JtJ_ref( i, j ), 1e-9 );
+                EXPECT_NEAR( JtJ_threaded( i, j ), JtJ_ref( i, j ), 1e-9 );
+                EXPECT_EQ( JtJ( i, j ), JtJ( j, i ) );
+            }
+        }
+    }
+
+    tmx::MatrixN<double> J( 3, 2 ), JtJ;
+    tmx::VectorN<double> e( 4 ), Jte;
+    EXPECT_TRUE( tmx::linalg::normal_equations( J, e, JtJ, Jte ).has_error() );
+}
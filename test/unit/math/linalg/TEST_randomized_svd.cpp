@@ -0,0 +1,134 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_randomized_svd.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/randomized_svd.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Build A = sum_r s_r u_r v_r^T with random orthonormal u_r, v_r
+ */
+tmx::MatrixN<double> build_low_rank( size_t m,
+                                     size_t n,
+                                     const std::vector<double>& s )
+{
+    std::mt19937 rng( 5 );
+    std::normal_distribution<double> dist( 0.0, 1.0 );
+
+    tmx::MatrixN<double> Ut( s.size(), m ), Vt( s.size(), n );
+    std::generate( Ut.data(), Ut.data() + s.size() * m, [&](){ return dist( rng ); } );
+    std::generate( Vt.data(), Vt.data() + s.size() * n, [&](){ return dist( rng ); } );
+    tmx::linalg::detail::orthonormalize_rows( Ut );
+    tmx::linalg::detail::orthonormalize_rows( Vt );
+
+    tmx::MatrixN<double> A( m, n );
+    for( size_t r = 0; r < s.size(); r++ )
+    {
+        for( size_t i = 0; i < m; i++ )
+        {
+            for( size_t j = 0; j < n; j++ )
+            {
+                A( i, j ) += s[r] * Ut( r, i ) * Vt( r, j );
+            }
+        }
+    }
+    return A;
+}
+
+/********************************************/
+/*      Test the randomized SVD             */
+/********************************************/
+TEST( linalg_randomized_svd, low_rank_recovery )
+{
+    const size_t m = 300;
+    const size_t n = 120;
+    std::vector<double> s;
+    for( size_t r = 0; r < 15; r++ )
+    {
+        s.push_back( 100.0 * std::pow( 0.7, double( r ) ) );
+    }
+    auto A = build_low_rank( m, n, s );
+
+    const size_t k = 8;
+    tmx::MatrixN<double> U, V;
+    tmx::VectorN<double> S;
+    tmx::linalg::Randomized_SVD_Options options;
+    options.num_threads = 1;
+    ASSERT_FALSE( tmx::linalg::randomized_svd( A, k, U, S, V, options ).has_error() );
+
+    ASSERT_EQ( k, S.size() );
+    ASSERT_EQ( m, U.rows() );
+    ASSERT_EQ( k, U.cols() );
+    ASSERT_EQ( n, V.rows() );
+    ASSERT_EQ( k, V.cols() );
+    for( size_t r = 0; r < k; r++ )
+    {
+        EXPECT_NEAR( s[r], S[r], 1e-8 * s[0] );
+    }
+
+    // A v_r = s_r u_r
+    for( size_t r = 0; r < k; r++ )
+    {
+        for( size_t i = 0; i < m; i++ )
+        {
+            double Av = 0;
+            for( size_t j = 0; j < n; j++ )
+            {
+                Av += A( i, j ) * V( j, r );
+            }
+            EXPECT_NEAR( S[r] * U( i, r ), Av, 1e-8 );
+        }
+    }
+
+    // Same seed gives identical results regardless of thread count
+    tmx::MatrixN<double> U2, V2;
+    tmx::VectorN<double> S2;
+    options.num_threads = 4;
+    ASSERT_FALSE( tmx::linalg::randomized_svd( A, k, U2, S2, V2, options ).has_error() );
+    for( size_t r = 0; r < k; r++ )
+    {
+        EXPECT_EQ( S[r], S2[r] );
+    }
+    for( size_t i = 0; i < m * k; i++ )
+    {
+        EXPECT_EQ( U.data()[i], U2.data()[i] );
+    }
+
+    // Invalid ranks are rejected
+    EXPECT_TRUE( tmx::linalg::randomized_svd( A, 0, U, S, V ).has_error() );
+    EXPECT_TRUE( tmx::linalg::randomized_svd( A, n + 1, U, S, V ).has_error() );
+}
+
+/********************************************/
+/*      Test a full-rank matrix             */
+/********************************************/
+TEST( linalg_randomized_svd, full_rank_with_power_iterations )
+{
+    tmx::MatrixN<double> A( 4, 3, {  23,  1, 25,
+                                    327,  2, 76,
+                                    234, 26, 76,
+                                     25, 62, 323 } );
+    tmx::MatrixN<double> U, V;
+    tmx::VectorN<double> S;
+    ASSERT_FALSE( tmx::linalg::randomized_svd( A, 2, U, S, V ).has_error() );
+    EXPECT_NEAR( 444.786309525272,   S[0], 1e-9 );
+    EXPECT_NEAR( 292.84455931980744, S[1], 1e-9 );
+}
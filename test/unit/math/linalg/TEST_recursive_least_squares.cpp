@@ -0,0 +1,228 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_recursive_least_squares.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/recursive_least_squares.hpp>
+#include <terminus/math/linalg/solvers.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Noisy stream of observations of a fixed linear model
+ */
+struct Observation_Stream
+{
+    Observation_Stream( size_t m, size_t n, uint32_t seed )
+      : A( m, n ), b( m )
+    {
+        std::mt19937 rng( seed );
+        std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+        for( size_t r = 0; r < m; r++ )
+        {
+            double s = 0;
+            for( size_t c = 0; c < n; c++ )
+            {
+                A( r, c ) = dist( rng );
+                s += A( r, c ) * ( double( c ) - 1.5 );
+            }
+            b[r] = s + 0.05 * dist( rng );
+        }
+    }
+
+    tmx::MatrixN<double> A;
+    tmx::VectorN<double> b;
+};
+
+/**
+ * Batch solution of the rows [begin, end) with weight forget^(end-1-r) on row r
+ */
+tmx::VectorN<double> batch_solution( const Observation_Stream& s,
+                                     size_t begin,
+                                     size_t end,
+                                     double forget,
+                                     double& rss )
+{
+    const size_t n = s.A.cols();
+    tmx::MatrixN<double> A( end - begin, n );
+    tmx::VectorN<double> b( end - begin );
+    for( size_t r = begin; r < end; r++ )
+    {
+        const double w = std::sqrt( std::pow( forget, double( end - 1 - r ) ) );
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r - begin, c ) = w * s.A( r, c );
+        }
+        b[r - begin] = w * s.b[r];
+    }
+    auto x = tmx::linalg::solve( A, b ).value();
+
+    rss = 0;
+    for( size_t r = 0; r < end - begin; r++ )
+    {
+        double e = b[r];
+        for( size_t c = 0; c < n; c++ )
+        {
+            e -= A( r, c ) * x[c];
+        }
+        rss += e * e;
+    }
+    return x;
+}
+
+/********************************************/
+/*      Test Growing Fits                   */
+/********************************************/
+TEST( linalg_recursive_least_squares, growing )
+{
+    const size_t n = 5;
+    Observation_Stream stream( 200, n, 3 );
+
+    for( double forget : { 1.0, 0.97 } )
+    {
+        tmx::linalg::Recursive_Least_Squares_Options options;
+        options.forgetting_factor = forget;
+        tmx::linalg::Recursive_Least_Squares<double> rls( n, options );
+
+        EXPECT_TRUE( rls.solution().has_error() );
+
+        ASSERT_FALSE( rls.add_observations( tmx::MatrixN<double>( 20, n, std::vector<double>( stream.A.data(), stream.A.data() + 20 * n ) ),
+                                            tmx::VectorN<double>( stream.b.data().data(), 20 ) ).has_error() );
+        for( size_t r = 20; r < 200; r++ )
+        {
+            ASSERT_FALSE( rls.add_observation( std::span<const double>( stream.A.data() + r * n, n ),
+                                               stream.b[r] ).has_error() );
+        }
+        EXPECT_EQ( 200u, rls.observation_count() );
+
+        double rss;
+        auto x_exp = batch_solution( stream, 0, 200, forget, rss );
+        auto x = rls.solution();
+        ASSERT_FALSE( x.has_error() );
+        for( size_t c = 0; c < n; c++ )
+        {
+            EXPECT_NEAR( x_exp[c], x.value()[c], 1e-10 );
+        }
+        EXPECT_NEAR( rss, rls.residual_sum_of_squares(), 1e-10 );
+    }
+}
+
+/********************************************/
+/*      Test Sliding Windows                */
+/********************************************/
+TEST( linalg_recursive_least_squares, sliding_window )
+{
+    const size_t n = 4;
+    const size_t window = 25;
+    Observation_Stream stream( 300, n, 8 );
+
+    for( double forget : { 1.0, 0.95 } )
+    {
+        tmx::linalg::Recursive_Least_Squares_Options options;
+        options.forgetting_factor = forget;
+        options.window_size       = window;
+        tmx::linalg::Recursive_Least_Squares<double> rls( n, options );
+
+        tmx::VectorN<double> x;
+        for( size_t r = 0; r < 300; r++ )
+        {
+            tmx::VectorN<double> row( stream.A.data() + r * n, n );
+            ASSERT_FALSE( rls.add_observation( row, stream.b[r] ).has_error() );
+
+            // Check periodically, including right after the window first fills
+            if( r + 1 == window || ( r + 1 ) % 50 == 0 )
+            {
+                double rss;
+                auto x_exp = batch_solution( stream, r + 1 - std::min( r + 1, window ), r + 1, forget, rss );
+                ASSERT_FALSE( rls.solution( x ).has_error() );
+                for( size_t c = 0; c < n; c++ )
+                {
+                    EXPECT_NEAR( x_exp[c], x[c], 1e-9 );
+                }
+                EXPECT_NEAR( rss, rls.residual_sum_of_squares(), 1e-9 );
+            }
+        }
+        EXPECT_EQ( window, rls.observation_count() );
+    }
+}
+
+/********************************************/
+/*      Test the Prior and Input Checks     */
+/********************************************/
+TEST( linalg_recursive_least_squares, prior )
+{
+    tmx::linalg::Recursive_Least_Squares_Options options;
+    options.prior_weight = 1e-6;
+    tmx::linalg::Recursive_Least_Squares<double> rls( 2, options );
+
+    // The prior makes a single row solvable, as the minimum-norm ridge solution
+    ASSERT_FALSE( rls.add_observation( tmx::VectorN<double>( { 1, 1 } ), 2.0 ).has_error() );
+    auto x = rls.solution();
+    ASSERT_FALSE( x.has_error() );
+    EXPECT_NEAR( 1.0, x.value()[0], 1e-5 );
+    EXPECT_NEAR( 1.0, x.value()[1], 1e-5 );
+
+    // Weighted rows
+    ASSERT_FALSE( rls.add_observation( tmx::VectorN<double>( { 1, -1 } ), 0.0, 4.0 ).has_error() );
+    x = rls.solution();
+    EXPECT_NEAR( 1.0, x.value()[0], 1e-5 );
+    EXPECT_NEAR( 1.0, x.value()[1], 1e-5 );
+
+    EXPECT_TRUE( rls.add_observation( tmx::VectorN<double>( { 1, 1, 1 } ), 2.0 ).has_error() );
+    EXPECT_TRUE( rls.add_observation( tmx::VectorN<double>( { 1, 1 } ), 2.0, -1.0 ).has_error() );
+
+    rls.reset();
+    EXPECT_EQ( 0u, rls.observation_count() );
+    EXPECT_EQ( 0.0, rls.residual_sum_of_squares() );
+}
+
+/********************************************/
+/*      Test the Option Checks              */
+/********************************************/
+TEST( linalg_recursive_least_squares, invalid_options )
+{
+    using RLS = tmx::linalg::Recursive_Least_Squares<double>;
+
+    tmx::linalg::Recursive_Least_Squares_Options options;
+    EXPECT_FALSE( RLS::create( 2, options ).has_error() );
+
+    for( const double forgetting_factor : { 0.0, -0.5, 1.5, std::nan( "" ) } )
+    {
+        options.forgetting_factor = forgetting_factor;
+        options.window_size       = 4;
+        auto created = RLS::create( 2, options );
+        EXPECT_TRUE( created.has_error() );
+
+        // Constructed directly, every update and solve reports the same error
+        RLS rls( 2, options );
+        EXPECT_TRUE( rls.add_observation( tmx::VectorN<double>( { 1, 1 } ), 2.0 ).has_error() );
+        EXPECT_TRUE( rls.solution().has_error() );
+    }
+
+    options.forgetting_factor = 1;
+    options.prior_weight      = -1;
+    EXPECT_TRUE( RLS::create( 2, options ).has_error() );
+
+    options.prior_weight = 0;
+    options.forgetting_factor = 0.9;
+    auto rls = RLS::create( 2, options );
+    ASSERT_FALSE( rls.has_error() );
+    EXPECT_FALSE( rls.value().add_observation( tmx::VectorN<double>( { 1, 0 } ), 1.0 ).has_error() );
+}
@@ -0,0 +1,145 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/solvers.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Random well conditioned matrix, optionally symmetric positive definite
+ */
+tmx::MatrixN<double> random_system( size_t n, bool spd, uint32_t seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    tmx::MatrixN<double> A( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r, c ) = dist( rng );
+        }
+    }
+    if( spd )
+    {
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < r; c++ )
+            {
+                A( c, r ) = A( r, c );
+            }
+        }
+    }
+    for( size_t i = 0; i < n; i++ )
+    {
+        A( i, i ) += 2.0 * std::sqrt( double( n ) );
+    }
+    return A;
+}
+
+/********************************************/
+/*      Test Mixed Precision Refinement     */
+/********************************************/
+TEST( linalg_solvers, solve_mixed_precision )
+{
+    const size_t n = 150;
+    tmx::VectorN<double> x_exp( n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        x_exp[i] = std::cos( 0.1 * i ) + 1.0 / 3.0;
+    }
+
+    for( bool spd : { false, true } )
+    {
+        auto A = random_system( n, spd, 7 );
+        tmx::VectorN<double> b = A * x_exp;
+
+        tmx::linalg::Mixed_Precision_Options options;
+        options.symmetric = spd;
+
+        tmx::VectorN<double> x;
+        auto res = tmx::linalg::solve_mixed_precision( A, b, x, options );
+        ASSERT_FALSE( res.has_error() );
+        EXPECT_FALSE( res.value().used_fallback );
+        EXPECT_GT( res.value().iterations, 0u );
+        EXPECT_LT( res.value().condition_estimate, 100.0 );
+
+        // Well beyond what a float solve alone can deliver
+        for( size_t i = 0; i < n; i++ )
+        {
+            EXPECT_NEAR( x_exp[i], x[i], 1e-13 );
+        }
+    }
+
+    // Promoted float inputs take the generic path
+    tmx::MatrixN<float> Af( 2, 2, { 4, 1,
+                                    1, 3 } );
+    tmx::VectorN<float> bf( { 1, 2 } );
+    auto xf = tmx::linalg::solve_mixed_precision( Af, bf );
+    ASSERT_FALSE( xf.has_error() );
+    EXPECT_NEAR( 1.0 / 11.0, xf.value()[0], 1e-15 );
+    EXPECT_NEAR( 7.0 / 11.0, xf.value()[1], 1e-15 );
+}
+
+/********************************************/
+/*      Test the Double Precision Fallback  */
+/********************************************/
+TEST( linalg_solvers, solve_mixed_precision_fallback )
+{
+    // Hilbert matrix, condition number around 1e13
+    const size_t n = 10;
+    tmx::MatrixN<double> H( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            H( r, c ) = 1.0 / double( r + c + 1 );
+        }
+    }
+    tmx::VectorN<double> x_exp( n, 1.0 );
+    tmx::VectorN<double> b = H * x_exp;
+
+    tmx::VectorN<double> x;
+    auto res = tmx::linalg::solve_mixed_precision( H, b, x );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().used_fallback );
+    EXPECT_GT( res.value().condition_estimate, 1e10 );
+    EXPECT_LT( res.value().residual_norm, 1e-12 );
+
+    // A float-indefinite matrix passed as symmetric still gets a solution
+    tmx::MatrixN<double> S( 2, 2, { 1, 2,
+                                    2, 1 } );
+    tmx::linalg::Mixed_Precision_Options options;
+    options.symmetric = true;
+    res = tmx::linalg::solve_mixed_precision( S, tmx::VectorN<double>( { 3, 3 } ), x, options );
+    ASSERT_FALSE( res.has_error() );
+    EXPECT_TRUE( res.value().used_fallback );
+    EXPECT_NEAR( 1.0, x[0], 1e-14 );
+    EXPECT_NEAR( 1.0, x[1], 1e-14 );
+
+    // Invalid inputs
+    EXPECT_TRUE( tmx::linalg::solve_mixed_precision( tmx::MatrixN<double>( 2, 3 ),
+                                                     tmx::VectorN<double>( 2 ), x ).has_error() );
+    EXPECT_TRUE( tmx::linalg::solve_mixed_precision( S, tmx::VectorN<double>( 3 ), x ).has_error() );
+    EXPECT_TRUE( tmx::linalg::solve_mixed_precision( tmx::MatrixN<double>( 2, 2 ),
+                                                     tmx::VectorN<double>( 2 ), x ).has_error() );
+}
@@ -206,4 +206,89 @@ TEST( linalg_svd, svd_complete_double_test_2 )
     auto orig_diff = (orig - A).sum();
     ASSERT_NEAR( orig_diff, 0, 0.001 );
 
-}
\ No newline at end of file
+}
+/************************************************/
+/*          Test the Cached SVD Result          */
+/************************************************/
+TEST( linalg_svd, svd_result )
+{
+    // Rank 2, 3 x 4
+    MatrixN<double> A( 3, 4, { 1, 2, 3,  4,
+                               2, 4, 6,  8,
+                               1, 0, 1, -1 } );
+
+    auto svd_res = linalg::compute_svd( A );
+    ASSERT_FALSE( svd_res.has_error() );
+    const auto& result = svd_res.value();
+
+    ASSERT_EQ( 3u, result.rows() );
+    ASSERT_EQ( 4u, result.cols() );
+    ASSERT_EQ( 2u, result.rank() );
+    ASSERT_EQ( 2u, result.nullity() );
+    EXPECT_GT( result.condition_number(), 1e12 );
+
+    // A * N = 0 for every null space basis vector
+    auto N = result.nullspace();
+    ASSERT_EQ( 4u, N.rows() );
+    ASSERT_EQ( 2u, N.cols() );
+    for( size_t c = 0; c < N.cols(); c++ )
+    {
+        for( size_t r = 0; r < A.rows(); r++ )
+        {
+            double s = 0;
+            for( size_t k = 0; k < A.cols(); k++ )
+            {
+                s += A( r, k ) * N( k, c );
+            }
+            EXPECT_NEAR( 0, s, 1e-12 );
+        }
+    }
+
+    // Range spans the columns:  projecting A onto it leaves A unchanged
+    auto R = result.range();
+    ASSERT_EQ( 3u, R.rows() );
+    ASSERT_EQ( 2u, R.cols() );
+    for( size_t c = 0; c < A.cols(); c++ )
+    {
+        for( size_t r = 0; r < A.rows(); r++ )
+        {
+            double proj = 0;
+            for( size_t k = 0; k < R.cols(); k++ )
+            {
+                double d = 0;
+                for( size_t i = 0; i < A.rows(); i++ )
+                {
+                    d += R( i, k ) * A( i, c );
+                }
+                proj += R( r, k ) * d;
+            }
+            EXPECT_NEAR( A( r, c ), proj, 1e-12 );
+        }
+    }
+
+    // Moore-Penrose condition:  A * A+ * A = A
+    auto P = result.pseudo_inverse();
+    ASSERT_EQ( 4u, P.rows() );
+    ASSERT_EQ( 3u, P.cols() );
+    MatrixN<double> APA = A * P * A;
+    for( size_t r = 0; r < A.rows(); r++ )
+    {
+        for( size_t c = 0; c < A.cols(); c++ )
+        {
+            EXPECT_NEAR( A( r, c ), APA( r, c ), 1e-12 );
+        }
+    }
+
+    // Full rank square matrix
+    MatrixN<double> B( 2, 2, { 3, 0,
+                               0, 0.5 } );
+    auto b_res = linalg::compute_svd( B );
+    ASSERT_FALSE( b_res.has_error() );
+    EXPECT_NEAR( 6.0, b_res.value().condition_number(), 1e-12 );
+    EXPECT_EQ( 0u, b_res.value().nullity() );
+    EXPECT_EQ( 0u, b_res.value().nullspace().cols() );
+    EXPECT_EQ( 1u, b_res.value().rank( 1.0 ) );
+
+    // The free helpers agree
+    EXPECT_EQ( 2, linalg::rank( A ) );
+}
@@ -0,0 +1,174 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_symmetric_eigen.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/symmetric_eigen.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+
+/**
+ * Verify A v_i = lambda_i v_i, orthonormality and ascending order
+ */
+template <typename MatrixT,
+          typename VectorT>
+void check_decomposition( const MatrixT& A,
+                          const VectorT& values,
+                          const MatrixT& vectors,
+                          size_t         n,
+                          double         tol )
+{
+    for( size_t i = 0; i + 1 < n; i++ )
+    {
+        EXPECT_LE( values[i], values[i+1] );
+    }
+    for( size_t k = 0; k < n; k++ )
+    {
+        for( size_t r = 0; r < n; r++ )
+        {
+            double Av = 0;
+            for( size_t c = 0; c < n; c++ )
+            {
+                Av += A( r, c ) * vectors( c, k );
+            }
+            EXPECT_NEAR( values[k] * vectors( r, k ), Av, tol );
+        }
+        for( size_t j = 0; j < n; j++ )
+        {
+            double dot = 0;
+            for( size_t r = 0; r < n; r++ )
+            {
+                dot += vectors( r, k ) * vectors( r, j );
+            }
+            EXPECT_NEAR( k == j ? 1.0 : 0.0, dot, tol );
+        }
+    }
+}
+
+/********************************************/
+/*      Test the dense solver               */
+/********************************************/
+TEST( linalg_symmetric_eigen, dense_solver )
+{
+    const size_t n = 25;
+    std::mt19937 rng( 3 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+    tmx::MatrixN<double> A( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c <= r; c++ )
+        {
+            A( r, c ) = A( c, r ) = dist( rng );
+        }
+    }
+
+    tmx::VectorN<double> values;
+    tmx::MatrixN<double> vectors;
+    ASSERT_FALSE( tmx::linalg::symmetric_eigen( A, values, vectors ).has_error() );
+    ASSERT_EQ( n, values.size() );
+    check_decomposition( A, values, vectors, n, 1e-10 );
+
+    // Values-only mode agrees
+    auto values_only = tmx::linalg::symmetric_eigenvalues( A );
+    ASSERT_FALSE( values_only.has_error() );
+    for( size_t i = 0; i < n; i++ )
+    {
+        EXPECT_NEAR( values[i], values_only.value()[i], 1e-10 );
+    }
+
+    // Reuse a workspace across matrices, including a repeated eigenvalue
+    tmx::linalg::Symmetric_Eigen_Solver<double> solver( 3 );
+    tmx::MatrixN<double> B( 3, 3, { 2, 0, 0,
+                                    0, 3, 4,
+                                    0, 4, 9 } );
+    ASSERT_FALSE( solver.compute( B ).has_error() );
+    EXPECT_NEAR(  1.0, solver.eigenvalues()[0], 1e-12 );
+    EXPECT_NEAR(  2.0, solver.eigenvalues()[1], 1e-12 );
+    EXPECT_NEAR( 11.0, solver.eigenvalues()[2], 1e-12 );
+    check_decomposition( B, solver.eigenvalues(), solver.eigenvectors(), 3, 1e-12 );
+
+    tmx::MatrixN<double> I( 3, 3, { 5, 0, 0,
+                                    0, 5, 0,
+                                    0, 0, 5 } );
+    ASSERT_FALSE( solver.compute( I, false ).has_error() );
+    EXPECT_FALSE( solver.has_eigenvectors() );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        EXPECT_NEAR( 5.0, solver.eigenvalues()[i], 1e-12 );
+    }
+
+    EXPECT_TRUE( solver.compute( tmx::MatrixN<double>( 2, 3 ) ).has_error() );
+}
+
+/********************************************/
+/*      Test the fixed-size paths           */
+/********************************************/
+TEST( linalg_symmetric_eigen, fixed_size )
+{
+    // 2x2 closed form
+    tmx::Matrix<double,2,2> A2( { 2, 1,
+                                  1, 2 } );
+    auto v2 = tmx::linalg::symmetric_eigenvalues( A2 );
+    EXPECT_NEAR( 1.0, v2[0], 1e-12 );
+    EXPECT_NEAR( 3.0, v2[1], 1e-12 );
+
+    tmx::Vector_<double,2> values2;
+    tmx::Matrix<double,2,2> vectors2;
+    tmx::linalg::symmetric_eigen( A2, values2, vectors2 );
+    check_decomposition( A2, values2, vectors2, 2, 1e-12 );
+
+    tmx::Matrix<double,2,2> D2( { 4, 0,
+                                  0, 1 } );
+    tmx::linalg::symmetric_eigen( D2, values2, vectors2 );
+    check_decomposition( D2, values2, vectors2, 2, 1e-12 );
+
+    // 3x3 covariance-style matrix
+    tmx::Matrix<double,3,3> A3( { 4.0, 1.2, 0.3,
+                                  1.2, 2.0, 0.5,
+                                  0.3, 0.5, 1.0 } );
+    tmx::Vector_<double,3> values3;
+    tmx::Matrix<double,3,3> vectors3;
+    tmx::linalg::symmetric_eigen( A3, values3, vectors3 );
+    check_decomposition( A3, values3, vectors3, 3, 1e-12 );
+
+    auto closed3 = tmx::linalg::symmetric_eigenvalues( A3 );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        EXPECT_NEAR( values3[i], closed3[i], 1e-12 );
+    }
+
+    // 4x4 through Jacobi, compared against the dense solver
+    tmx::Matrix<float,4,4> A4( { 5, 1, 0, 2,
+                                 1, 4, 1, 0,
+                                 0, 1, 3, 1,
+                                 2, 0, 1, 6 } );
+    tmx::Vector_<float,4> values4;
+    tmx::Matrix<float,4,4> vectors4;
+    tmx::linalg::symmetric_eigen( A4, values4, vectors4 );
+    check_decomposition( A4, values4, vectors4, 4, 1e-5 );
+
+    tmx::MatrixN<float> A4n( 4, 4, std::vector<float>( A4.begin(), A4.end() ) );
+    auto dense4 = tmx::linalg::symmetric_eigenvalues( A4n );
+    ASSERT_FALSE( dense4.has_error() );
+    for( size_t i = 0; i < 4; i++ )
+    {
+        EXPECT_NEAR( dense4.value()[i], values4[i], 1e-5 );
+    }
+}
@@ -0,0 +1,195 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_triangular_solve.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/triangular_solve.hpp>
+#include <terminus/math/matrix.hpp>
+
+// C++ Libraries
+#include <random>
+
+namespace tmx = tmns::math;
+namespace la  = tmns::math::linalg;
+
+/**
+ * Dense random matrix with a well conditioned diagonal.  Both triangles are filled so the
+ * kernels are checked to read only the one they are told to.
+ */
+tmx::MatrixN<double> random_factor( size_t n, uint32_t seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+    tmx::MatrixN<double> A( n, n );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            A( r, c ) = ( r == c ) ? 2.0 + std::abs( dist( rng ) ) : dist( rng ) / std::sqrt( double( n ) );
+        }
+    }
+    return A;
+}
+
+/**
+ * Element (r,c) of op(A) with the triangle and diagonal applied
+ */
+double op_element( const tmx::MatrixN<double>& A,
+                   size_t r, size_t c,
+                   la::Triangle uplo, la::Transpose trans, la::Diagonal diag )
+{
+    const size_t i = ( trans == la::Transpose::TRANSPOSE ) ? c : r;
+    const size_t j = ( trans == la::Transpose::TRANSPOSE ) ? r : c;
+    if( i == j )
+    {
+        return ( diag == la::Diagonal::UNIT ) ? 1.0 : A( i, j );
+    }
+    const bool in_triangle = ( uplo == la::Triangle::LOWER ) ? ( j < i ) : ( j > i );
+    return in_triangle ? A( i, j ) : 0.0;
+}
+
+/********************************************/
+/*      Test Matrix Right-Hand Sides        */
+/********************************************/
+TEST( linalg_triangular_solve, trsm )
+{
+    // Large enough to cross both the row and column block boundaries
+    const size_t n    = 150;
+    const size_t nrhs = 300;
+    auto A = random_factor( n, 5 );
+
+    std::mt19937 rng( 9 );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+    tmx::MatrixN<double> X_exp( n, nrhs );
+    for( size_t r = 0; r < n; r++ )
+    {
+        for( size_t c = 0; c < nrhs; c++ )
+        {
+            X_exp( r, c ) = dist( rng );
+        }
+    }
+
+    for( auto uplo : { la::Triangle::LOWER, la::Triangle::UPPER } )
+    for( auto trans : { la::Transpose::NO_TRANSPOSE, la::Transpose::TRANSPOSE } )
+    for( auto diag : { la::Diagonal::NON_UNIT, la::Diagonal::UNIT } )
+    {
+        // B = op(A) X
+        tmx::MatrixN<double> B( n, nrhs );
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t k = 0; k < n; k++ )
+            {
+                const double a = op_element( A, r, k, uplo, trans, diag );
+                for( size_t c = 0; c < nrhs; c++ )
+                {
+                    B( r, c ) += a * X_exp( k, c );
+                }
+            }
+        }
+
+        la::triangular_solve( A, B, uplo, trans, diag );
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < nrhs; c++ )
+            {
+                ASSERT_NEAR( X_exp( r, c ), B( r, c ), 1e-10 );
+            }
+        }
+    }
+}
+
+/********************************************/
+/*      Test Vector Right-Hand Sides        */
+/********************************************/
+TEST( linalg_triangular_solve, trsv )
+{
+    const size_t n = 70;
+    auto A = random_factor( n, 13 );
+
+    tmx::VectorN<double> x_exp( n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        x_exp[i] = std::sin( 0.7 * i );
+    }
+
+    for( auto uplo : { la::Triangle::LOWER, la::Triangle::UPPER } )
+    for( auto trans : { la::Transpose::NO_TRANSPOSE, la::Transpose::TRANSPOSE } )
+    for( auto diag : { la::Diagonal::NON_UNIT, la::Diagonal::UNIT } )
+    {
+        tmx::VectorN<double> b( n );
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t k = 0; k < n; k++ )
+            {
+                b[r] += op_element( A, r, k, uplo, trans, diag ) * x_exp[k];
+            }
+        }
+
+        la::triangular_solve( A, b, uplo, trans, diag );
+        for( size_t i = 0; i < n; i++ )
+        {
+            ASSERT_NEAR( x_exp[i], b[i], 1e-12 );
+        }
+    }
+
+    // Fixed-size types share the same kernels
+    tmx::Matrix<double,3,3> L( { 2, 0, 0,
+                                 1, 4, 0,
+                                 3, 5, 6 } );
+    tmx::Vector_<double,3> v( { 2, 9, 31 } );
+    la::triangular_solve( L, v, la::Triangle::LOWER );
+    EXPECT_NEAR( 1.0, v[0], 1e-14 );
+    EXPECT_NEAR( 2.0, v[1], 1e-14 );
+    EXPECT_NEAR( 3.0, v[2], 1e-14 );
+}
+
+/********************************************/
+/*      Test inverse() on the kernels       */
+/********************************************/
+TEST( linalg_triangular_solve, inverse )
+{
+    const size_t n = 90;
+    auto A = random_factor( n, 21 );
+
+    for( const auto& Ainv : { A.inverse(), tmx::inverse( A ) } )
+    {
+        for( size_t r = 0; r < n; r++ )
+        {
+            for( size_t c = 0; c < n; c++ )
+            {
+                double s = 0;
+                for( size_t k = 0; k < n; k++ )
+                {
+                    s += A( r, k ) * Ainv( k, c );
+                }
+                ASSERT_NEAR( r == c ? 1.0 : 0.0, s, 1e-12 );
+            }
+        }
+    }
+
+    // Pivoting is required for this one
+    tmx::Matrix<double,3,3> P( { 0, 2, 1,
+                                 1, 1, 0,
+                                 3, 0, 1 } );
+    auto Pinv = P.inverse();
+    auto I = P * Pinv;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            EXPECT_NEAR( r == c ? 1.0 : 0.0, I( r, c ), 1e-14 );
+        }
+    }
+}
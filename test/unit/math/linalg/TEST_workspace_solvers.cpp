@@ -0,0 +1,367 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_workspace_solvers.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/linalg/solvers.hpp>
+#include <terminus/math/linalg/workspace_solvers.hpp>
+#include <terminus/math/matrix/matrix_operations.hpp>
+
+// Test Libraries
+#include "../../alloc_counter.hpp"
+
+// C++ Libraries
+#include <cmath>
+#include <utility>
+
+namespace tmx = tmns::math;
+
+/********************************************/
+/*      Test the Symmetric Solver           */
+/********************************************/
+TEST( linalg_workspace_solvers, symmetric_solver )
+{
+    tmx::MatrixN<double> A( 3, 3, { 4, 1, 2,
+                                    1, 5, 3,
+                                    2, 3, 6 } );
+    tmx::VectorN<double> b( { 1, 2, 3 } );
+
+    tmx::linalg::Symmetric_Solver<double> solver( 3 );
+    ASSERT_FALSE( solver.is_factored() );
+    ASSERT_TRUE( solver.solve( b ).has_error() );
+
+    ASSERT_FALSE( solver.factor( A ).has_error() );
+    tmx::VectorN<double> x( 3 );
+    ASSERT_FALSE( solver.solve( b, x ).has_error() );
+
+    tmx::VectorN<double> Ax = A * x;
+    for( size_t i = 0; i < 3; i++ )
+    {
+        EXPECT_NEAR( b[i], Ax[i], 1e-12 );
+    }
+
+    // Same-size factor/solve cycles must not allocate
+    tmx::MatrixN<double> A2( 3, 3, { 9, 2, 1,
+                                     2, 8, 1,
+                                     1, 1, 7 } );
+    size_t start = tmns::test::allocation_count();
+    for( int i = 0; i < 10; i++ )
+    {
+        auto fres = solver.factor( i % 2 == 0 ? A2 : A );
+        auto sres = solver.solve( b, x );
+        ASSERT_FALSE( fres.has_error() );
+        ASSERT_FALSE( sres.has_error() );
+    }
+    EXPECT_EQ( start, tmns::test::allocation_count() );
+
+    // Singular systems are reported
+    tmx::MatrixN<double> S( 2, 2, { 1, 1,
+                                    1, 1 } );
+    EXPECT_TRUE( solver.factor( S ).has_error() );
+    EXPECT_FALSE( solver.is_factored() );
+}
+
+/********************************************/
+/*      Test the Least Squares Solver       */
+/********************************************/
+TEST( linalg_workspace_solvers, least_squares_solver )
+{
+    // Fit y = 1 + 2x exactly
+    tmx::MatrixN<double> A( 4, 2, { 1, 0,
+                                    1, 1,
+                                    1, 2,
+                                    1, 3 } );
+    tmx::VectorN<double> b( { 1, 3, 5, 7 } );
+
+    tmx::linalg::Least_Squares_Solver<double> solver;
+    ASSERT_FALSE( solver.factor( A ).has_error() );
+    EXPECT_EQ( 2u, solver.rank() );
+
+    tmx::VectorN<double> x;
+    ASSERT_FALSE( solver.solve( b, x ).has_error() );
+    ASSERT_EQ( 2u, x.size() );
+    EXPECT_NEAR( 1.0, x[0], 1e-12 );
+    EXPECT_NEAR( 2.0, x[1], 1e-12 );
+
+    size_t start = tmns::test::allocation_count();
+    for( int i = 0; i < 10; i++ )
+    {
+        auto fres = solver.factor( A );
+        auto sres = solver.solve( b, x );
+        ASSERT_FALSE( fres.has_error() );
+        ASSERT_FALSE( sres.has_error() );
+    }
+    EXPECT_EQ( start, tmns::test::allocation_count() );
+
+    // Wrong right-hand side size
+    EXPECT_TRUE( solver.solve( tmx::VectorN<double>( 3 ) ).has_error() );
+}
+
+/********************************************/
+/*      Test the SVD Solver                 */
+/********************************************/
+TEST( linalg_workspace_solvers, svd_solver )
+{
+    tmx::MatrixN<double> A( 4, 3, {  23,  1, 25,
+                                    327,  2, 76,
+                                    234, 26, 76,
+                                     25, 62, 323 } );
+
+    tmx::linalg::SVD_Solver<double> solver( 4, 3 );
+    ASSERT_FALSE( solver.factor( A ).has_error() );
+
+    tmx::VectorN<double> S;
+    solver.singular_values( S );
+    ASSERT_EQ( 3u, S.size() );
+    EXPECT_NEAR( 444.786309525272,   S[0], 1e-9 );
+    EXPECT_NEAR( 292.84455931980744, S[1], 1e-9 );
+    EXPECT_NEAR( 16.649412472420977, S[2], 1e-9 );
+
+    tmx::MatrixN<double> U, V;
+    solver.matrix_u( U );
+    solver.matrix_v( V );
+    ASSERT_EQ( 4u, U.rows() );
+    ASSERT_EQ( 3u, U.cols() );
+    ASSERT_EQ( 3u, V.rows() );
+    ASSERT_EQ( 3u, V.cols() );
+
+    // Exact solution must be recovered for a consistent system
+    tmx::VectorN<double> x_exp( { 0.5, -1.0, 2.0 } );
+    tmx::VectorN<double> b = A * x_exp;
+    tmx::VectorN<double> x;
+    ASSERT_FALSE( solver.solve( b, x ).has_error() );
+    for( size_t i = 0; i < 3; i++ )
+    {
+        EXPECT_NEAR( x_exp[i], x[i], 1e-10 );
+    }
+
+    size_t start = tmns::test::allocation_count();
+    for( int i = 0; i < 10; i++ )
+    {
+        auto fres = solver.factor( A );
+        auto sres = solver.solve( b, x );
+        ASSERT_FALSE( fres.has_error() );
+        ASSERT_FALSE( sres.has_error() );
+    }
+    EXPECT_EQ( start, tmns::test::allocation_count() );
+}
+
+/********************************************/
+/*      Test Multiple Right-Hand Sides      */
+/********************************************/
+TEST( linalg_workspace_solvers, svd_solver_multiple_rhs )
+{
+    tmx::MatrixN<double> A( 4, 3, {  23,  1, 25,
+                                    327,  2, 76,
+                                    234, 26, 76,
+                                     25, 62, 323 } );
+
+    // Three solutions packed as columns
+    tmx::MatrixN<double> X_exp( 3, 3, {  0.5, 1, -3,
+                                        -1.0, 0,  7,
+                                         2.0, 4,  1 } );
+    tmx::MatrixN<double> B( 4, 3 );
+    for( size_t r = 0; r < 4; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            double s = 0;
+            for( size_t k = 0; k < 3; k++ )
+            {
+                s += A( r, k ) * X_exp( k, c );
+            }
+            B( r, c ) = s;
+        }
+    }
+
+    tmx::linalg::SVD_Solver<double> solver;
+    ASSERT_TRUE( solver.solve( B ).has_error() );
+    ASSERT_FALSE( solver.factor( A ).has_error() );
+
+    tmx::MatrixN<double> X;
+    ASSERT_FALSE( solver.solve( B, X ).has_error() );
+    ASSERT_EQ( 3u, X.rows() );
+    ASSERT_EQ( 3u, X.cols() );
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            EXPECT_NEAR( X_exp( r, c ), X( r, c ), 1e-10 );
+        }
+    }
+
+    // Each column matches the single right-hand side path
+    for( size_t c = 0; c < 3; c++ )
+    {
+        tmx::VectorN<double> b( 4 );
+        for( size_t r = 0; r < 4; r++ )
+        {
+            b[r] = B( r, c );
+        }
+        auto x = tmx::linalg::solve( A, b );
+        ASSERT_FALSE( x.has_error() );
+        for( size_t r = 0; r < 3; r++ )
+        {
+            EXPECT_NEAR( X( r, c ), x.value()[r], 1e-10 );
+        }
+    }
+
+    // Free function agrees with the reusable solver
+    auto X2 = tmx::linalg::solve( A, B );
+    ASSERT_FALSE( X2.has_error() );
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 3; c++ )
+        {
+            EXPECT_NEAR( X( r, c ), X2.value()( r, c ), 1e-10 );
+        }
+    }
+
+    // Repeated solves against the same factorization reuse the output storage
+    size_t start = tmns::test::allocation_count();
+    for( int i = 0; i < 10; i++ )
+    {
+        ASSERT_FALSE( solver.solve( B, X ).has_error() );
+    }
+    EXPECT_EQ( start, tmns::test::allocation_count() );
+
+    EXPECT_TRUE( solver.solve( tmx::MatrixN<double>( 3, 2 ) ).has_error() );
+}
+
+/********************************************/
+/*      Larger Systems Reuse Workspace      */
+/********************************************/
+TEST( linalg_workspace_solvers, large_systems_do_not_allocate )
+{
+    // Diagonally dominant, so every solver sees a well conditioned system
+    auto make_matrix = []( size_t rows, size_t cols )
+    {
+        tmx::MatrixN<double> A( rows, cols );
+        for( size_t r = 0; r < rows; r++ )
+        {
+            for( size_t c = 0; c < cols; c++ )
+            {
+                A( r, c ) = ( r == c ? 10.0 : 0.0 ) + std::sin( 0.7 * r + 1.3 * c );
+            }
+        }
+        return A;
+    };
+    auto make_vector = []( size_t n )
+    {
+        tmx::VectorN<double> b( n );
+        for( size_t i = 0; i < n; i++ )
+        {
+            b[i] = std::cos( 0.3 * i );
+        }
+        return b;
+    };
+
+    // Least squares, 30 x 20
+    {
+        const auto A = make_matrix( 30, 20 );
+        const auto b = make_vector( 30 );
+        tmx::linalg::Least_Squares_Solver<double> solver( 30, 20 );
+        tmx::VectorN<double> x( 20 );
+        ASSERT_FALSE( solver.factor( A ).has_error() );
+        ASSERT_FALSE( solver.solve( b, x ).has_error() );
+
+        auto reference = tmx::linalg::solve( A, b );
+        ASSERT_FALSE( reference.has_error() );
+        for( size_t i = 0; i < 20; i++ )
+        {
+            EXPECT_NEAR( reference.value()[i], x[i], 1e-10 );
+        }
+
+        const size_t start = tmns::test::allocation_count();
+        for( int i = 0; i < 5; i++ )
+        {
+            auto fres = solver.factor( A );
+            auto sres = solver.solve( b, x );
+            ASSERT_FALSE( fres.has_error() );
+            ASSERT_FALSE( sres.has_error() );
+        }
+        EXPECT_EQ( start, tmns::test::allocation_count() );
+    }
+
+    // SVD, 80 x 80 and 100 x 80
+    for( const size_t rows : { size_t( 80 ), size_t( 100 ) } )
+    {
+        const auto A = make_matrix( rows, 80 );
+        const auto b = make_vector( rows );
+        tmx::linalg::SVD_Solver<double> solver( rows, 80 );
+        tmx::VectorN<double> x( 80 );
+        ASSERT_FALSE( solver.factor( A ).has_error() );
+        ASSERT_FALSE( solver.solve( b, x ).has_error() );
+
+        auto reference = tmx::linalg::solve( A, b );
+        ASSERT_FALSE( reference.has_error() );
+        for( size_t i = 0; i < 80; i++ )
+        {
+            EXPECT_NEAR( reference.value()[i], x[i], 1e-10 );
+        }
+
+        const size_t start = tmns::test::allocation_count();
+        for( int i = 0; i < 5; i++ )
+        {
+            auto fres = solver.factor( A );
+            auto sres = solver.solve( b, x );
+            ASSERT_FALSE( fres.has_error() );
+            ASSERT_FALSE( sres.has_error() );
+        }
+        EXPECT_EQ( start, tmns::test::allocation_count() );
+    }
+}
+
+/********************************************/
+/*      Moved-From Solvers Fail Cleanly     */
+/********************************************/
+TEST( linalg_workspace_solvers, moved_from )
+{
+    tmx::MatrixN<double> A( 3, 2, { 1, 0,
+                                    0, 1,
+                                    1, 1 } );
+    tmx::VectorN<double> b( { 1, 2, 3 } );
+
+    tmx::linalg::Least_Squares_Solver<double> qr;
+    tmx::linalg::SVD_Solver<double> svd;
+    ASSERT_FALSE( qr.factor( A ).has_error() );
+    ASSERT_FALSE( svd.factor( A ).has_error() );
+
+    auto qr_moved  = std::move( qr );
+    auto svd_moved = std::move( svd );
+    EXPECT_FALSE( qr_moved.solve( b ).has_error() );
+    EXPECT_FALSE( svd_moved.solve( b ).has_error() );
+
+    EXPECT_FALSE( qr.is_factored() );
+    EXPECT_EQ( qr.cols(), 0u );
+    EXPECT_TRUE( qr.solve( b ).has_error() );
+    EXPECT_FALSE( svd.is_factored() );
+    EXPECT_TRUE( svd.solve( b ).has_error() );
+    tmx::VectorN<double> S;
+    svd.singular_values( S );
+    EXPECT_EQ( S.size(), 0u );
+
+    // A moved-from solver can be factored again
+    ASSERT_FALSE( svd.factor( A ).has_error() );
+    auto x = svd.solve( b );
+    ASSERT_FALSE( x.has_error() );
+    EXPECT_NEAR( x.value()[0], 1.0, 1e-12 );
+    EXPECT_NEAR( x.value()[1], 2.0, 1e-12 );
+
+    tmx::linalg::Symmetric_Solver<double> ldlt( 2 );
+    auto ldlt_moved = std::move( ldlt );
+    EXPECT_TRUE( ldlt.solve( tmx::VectorN<double>( 2 ) ).has_error() );
+    EXPECT_EQ( ldlt.size(), 0u );
+}
@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_fixed_size_kernels.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/matrix.hpp>
+#include <terminus/math/matrix/fixed_size_kernels.hpp>
+#include <terminus/math/vector.hpp>
+
+// C++ Libraries
+#include <array>
+#include <random>
+
+namespace tmx = tmns::math;
+
+// The kernels are usable in constant expressions
+static_assert( tmx::kernels::determinant<3>( std::array<int,9>{ 2, 0, 0, 0, 3, 0, 0, 0, 4 }.data() ) == 24 );
+static_assert( tmx::kernels::trace<4>( std::array<int,16>{ 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4 }.data() ) == 10 );
+static_assert( []()
+{
+    std::array<int,4> a { 1, 2, 3, 4 };
+    std::array<int,4> b { 0, 1, 1, 0 };
+    std::array<int,4> c {};
+    tmx::kernels::multiply<2,2,2>( a.data(), b.data(), c.data() );
+    return c[0] == 2 && c[1] == 1 && c[2] == 4 && c[3] == 3;
+}() );
+
+/**
+ * Random N x M matrix, diagonally loaded when square so it is well conditioned
+ */
+template <size_t N, size_t M>
+tmx::Matrix<double,N,M> random_matrix( uint32_t seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+    tmx::Matrix<double,N,M> m;
+    for( size_t r = 0; r < N; r++ )
+    {
+        for( size_t c = 0; c < M; c++ )
+        {
+            m( r, c ) = dist( rng ) + ( ( N == M && r == c ) ? 2.0 : 0.0 );
+        }
+    }
+    return m;
+}
+
+/**
+ * Check the closed-form determinant and inverse against the general MatrixN path
+ */
+template <size_t N>
+void check_square( uint32_t seed )
+{
+    auto A = random_matrix<N,N>( seed );
+    tmx::MatrixN<double> A_dyn( A );
+
+    EXPECT_NEAR( A_dyn.determinant(), A.determinant(), 1e-12 );
+
+    double trace = 0;
+    for( size_t i = 0; i < N; i++ )
+    {
+        trace += A( i, i );
+    }
+    EXPECT_NEAR( trace, A.trace(), 1e-15 );
+
+    tmx::Matrix<double,N,N> inv = A.inverse();
+    tmx::Matrix<double,N,N> free_inv = tmx::inverse( A );
+    tmx::MatrixN<double> inv_dyn = A_dyn.inverse();
+    tmx::Matrix<double,N,N> I = A * inv;
+    for( size_t r = 0; r < N; r++ )
+    {
+        for( size_t c = 0; c < N; c++ )
+        {
+            EXPECT_NEAR( inv_dyn( r, c ), inv( r, c ), 1e-12 );
+            EXPECT_EQ( inv( r, c ), free_inv( r, c ) );
+            EXPECT_NEAR( r == c ? 1.0 : 0.0, I( r, c ), 1e-12 );
+        }
+    }
+
+    // Exactly singular input:  zero the last row
+    for( size_t c = 0; c < N; c++ )
+    {
+        A( N - 1, c ) = 0;
+    }
+    EXPECT_THROW( A.inverse(), std::runtime_error );
+}
+
+/****************************************/
+/*      Test Determinant and Inverse    */
+/****************************************/
+TEST( Fixed_Size_Kernels, determinant_inverse )
+{
+    check_square<2>( 1 );
+    check_square<3>( 2 );
+    check_square<4>( 3 );
+}
+
+/****************************************/
+/*      Test Products and Transpose     */
+/****************************************/
+TEST( Fixed_Size_Kernels, products )
+{
+    auto A = random_matrix<3,4>( 4 );
+    auto B = random_matrix<4,2>( 5 );
+
+    // Fixed-size product is evaluated eagerly into a Matrix
+    tmx::Matrix<double,3,2> C = A * B;
+    tmx::MatrixN<double> C_dyn = tmx::MatrixN<double>( A ) * tmx::MatrixN<double>( B );
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 2; c++ )
+        {
+            EXPECT_NEAR( C_dyn( r, c ), C( r, c ), 1e-14 );
+        }
+    }
+
+    tmx::Vector_<double,4> x( { 1.0, -2.0, 0.5, 3.0 } );
+    tmx::Vector_<double,3> y = A * x;
+    for( size_t r = 0; r < 3; r++ )
+    {
+        double s = 0;
+        for( size_t c = 0; c < 4; c++ )
+        {
+            s += A( r, c ) * x[c];
+        }
+        EXPECT_NEAR( s, y[r], 1e-14 );
+    }
+
+    tmx::Matrix<double,4,3> At;
+    tmx::kernels::transpose<3,4>( A.data(), At.data() );
+    for( size_t r = 0; r < 3; r++ )
+    {
+        for( size_t c = 0; c < 4; c++ )
+        {
+            EXPECT_EQ( A( r, c ), At( c, r ) );
+        }
+    }
+}
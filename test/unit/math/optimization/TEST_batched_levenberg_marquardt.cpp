@@ -0,0 +1,152 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_batched_levenberg_marquardt.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/batched_levenberg_marquardt.hpp>
+
+// C++ Libraries
+#include <random>
+#include <vector>
+
+namespace tmx = tmns::math;
+
+/**
+ * Per-pixel exponential decay fit, h_k = a * exp( -b * t_k ), with compile-time sizes
+*/
+struct Decay_Fixed_Model : public tmx::optimize::Least_Squares_Model_Base_Fixed<Decay_Fixed_Model,2,6>
+{
+    using result_type   = tmx::Vector_<double,6>;
+    using domain_type   = tmx::Vector_<double,2>;
+    using jacobian_type = tmx::Matrix<double,6,2>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h;
+        for( size_t k = 0; k < 6; k++ )
+        {
+            h(k) = x(0) * std::exp( -x(1) * 0.5 * k );
+        }
+        return h;
+    }
+}; // End of Decay_Fixed_Model class
+
+/**
+ * Same decay fit, with run-time sizes
+*/
+struct Decay_Model : public tmx::optimize::Least_Squares_Model_Base<Decay_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h( 6 );
+        for( size_t k = 0; k < 6; k++ )
+        {
+            h(k) = x(0) * std::exp( -x(1) * 0.5 * k );
+        }
+        return h;
+    }
+}; // End of Decay_Model class
+
+/************************************************/
+/*      Batched fixed-size solves match the     */
+/*      one-at-a-time solves exactly            */
+/************************************************/
+TEST( Batched_Levenberg_Marquardt, fixed_matches_serial )
+{
+    const size_t count = 2000;
+    std::mt19937 rng( 7 );
+    std::uniform_real_distribution<double> amplitude( 0.5, 2.0 );
+    std::uniform_real_distribution<double> rate( 0.1, 1.5 );
+    std::uniform_real_distribution<double> noise( -0.2, 0.2 );
+
+    Decay_Fixed_Model model;
+    std::vector<tmx::Vector_<double,2>> seeds( count ), truth( count );
+    std::vector<tmx::Vector_<double,6>> observations( count );
+    for( size_t p = 0; p < count; p++ )
+    {
+        truth[p]        = tmx::Vector_<double,2>( { amplitude( rng ), rate( rng ) } );
+        observations[p] = model( truth[p] );
+        seeds[p]        = tmx::Vector_<double,2>( { truth[p][0] + noise( rng ), truth[p][1] + noise( rng ) } );
+    }
+
+    std::vector<tmx::Vector_<double,2>> solutions( count );
+    std::vector<tmx::optimize::LM_STATUS_CODE> status( count, tmx::optimize::LM_STATUS_CODE::ERROR_STATUS_UNKNOWN );
+
+    tmx::optimize::Batch_LM_Options options;
+    options.num_threads = 4;
+    options.grain_size  = 16;
+    auto res = tmx::optimize::batch_levenberg_marquardt_fixed<Decay_Fixed_Model,2,6>( model, seeds, observations,
+                                                                                      solutions, status, options );
+    ASSERT_FALSE( res.has_error() );
+
+    for( size_t p = 0; p < count; p++ )
+    {
+        tmx::optimize::LM_STATUS_CODE serial_status;
+        auto serial = tmx::optimize::levenberg_marquardt_fixed( model, seeds[p], observations[p], serial_status );
+        ASSERT_FALSE( serial.has_error() );
+        EXPECT_EQ( status[p], serial_status );
+        EXPECT_EQ( solutions[p][0], serial.value()[0] );
+        EXPECT_EQ( solutions[p][1], serial.value()[1] );
+        EXPECT_NEAR( solutions[p][0], truth[p][0], 1e-4 );
+        EXPECT_NEAR( solutions[p][1], truth[p][1], 1e-4 );
+    }
+
+    // Mismatched spans are rejected before any work is done
+    std::vector<tmx::Vector_<double,2>> short_solutions( count - 1 );
+    res = tmx::optimize::batch_levenberg_marquardt_fixed<Decay_Fixed_Model,2,6>( model, seeds, observations,
+                                                                                 short_solutions, status, options );
+    EXPECT_TRUE( res.has_error() );
+}
+
+/************************************************/
+/*      Batched dynamic-size solves             */
+/************************************************/
+TEST( Batched_Levenberg_Marquardt, dynamic_matches_serial )
+{
+    const size_t count = 64;
+    Decay_Model model;
+    std::vector<tmx::VectorN<double>> seeds, observations;
+    for( size_t p = 0; p < count; p++ )
+    {
+        tmx::VectorN<double> truth( { 1.0 + 0.01 * p, 0.2 + 0.01 * p } );
+        observations.push_back( model( truth ) );
+        seeds.push_back( tmx::VectorN<double>( { 1.0, 0.5 } ) );
+    }
+
+    std::vector<tmx::VectorN<double>> solutions( count );
+    std::vector<tmx::optimize::LM_STATUS_CODE> status( count );
+
+    tmx::optimize::Batch_LM_Options options;
+    options.num_threads = 3;
+    options.grain_size  = 4;
+    auto res = tmx::optimize::batch_levenberg_marquardt<Decay_Model>( model, seeds, observations,
+                                                                      solutions, status, options );
+    ASSERT_FALSE( res.has_error() );
+
+    for( size_t p = 0; p < count; p++ )
+    {
+        tmx::optimize::LM_STATUS_CODE serial_status;
+        auto serial = tmx::optimize::levenberg_marquardt( model, seeds[p], observations[p], serial_status );
+        ASSERT_FALSE( serial.has_error() );
+        EXPECT_EQ( status[p], serial_status );
+        ASSERT_EQ( solutions[p].size(), 2 );
+        EXPECT_EQ( solutions[p][0], serial.value()[0] );
+        EXPECT_EQ( solutions[p][1], serial.value()[1] );
+    }
+}
@@ -0,0 +1,192 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_jacobian_sparsity.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/levenburg_marquardt.hpp>
+
+// C++ Libraries
+#include <atomic>
+
+namespace tmx = tmns::math;
+
+/**
+ * Track smoothing:  a nonlinear data term per sample plus a second-difference penalty,
+ * so every residual touches at most three neighboring parameters.
+*/
+struct Track_Smoothing_Model : public tmx::optimize::Least_Squares_Model_Base<Track_Smoothing_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    explicit Track_Smoothing_Model( size_t n )
+        : m_n( n ),
+          m_pattern( 2 * n - 2, n )
+    {
+        for( size_t i = 0; i < n; i++ )
+        {
+            (void)m_pattern.add( i, i );
+        }
+        for( size_t i = 0; i + 2 < n; i++ )
+        {
+            (void)m_pattern.add( n + i, { i, i + 1, i + 2 } );
+        }
+    }
+
+    result_type operator()( domain_type const& x ) const
+    {
+        evaluations++;
+        result_type h( 2 * m_n - 2 );
+        for( size_t i = 0; i < m_n; i++ )
+        {
+            h(i) = std::sin( x(i) ) + x(i);
+        }
+        for( size_t i = 0; i + 2 < m_n; i++ )
+        {
+            h(m_n + i) = x(i) - 2 * x(i+1) * x(i+1) + x(i+2);
+        }
+        return h;
+    }
+
+    const tmx::optimize::Jacobian_Sparsity& jacobian_sparsity() const
+    {
+        return m_pattern;
+    }
+
+    size_t m_n;
+    tmx::optimize::Jacobian_Sparsity m_pattern;
+    mutable std::atomic<size_t> evaluations { 0 };
+}; // End of Track_Smoothing_Model class
+
+/************************************************/
+/*      Coloring of a banded pattern            */
+/************************************************/
+TEST( Jacobian_Sparsity, color_columns )
+{
+    Track_Smoothing_Model model( 40 );
+    const auto& pattern = model.jacobian_sparsity();
+    ASSERT_EQ( pattern.rows(), 78 );
+    ASSERT_EQ( pattern.cols(), 40 );
+    ASSERT_EQ( pattern.nonzeros(), 40 + 3 * 38 );
+    EXPECT_TRUE( pattern.contains( 45, 7 ) );
+    EXPECT_FALSE( pattern.contains( 45, 8 ) );
+
+    tmx::optimize::Jacobian_Sparsity bad( 2, 2 );
+    EXPECT_TRUE( bad.add( 0, 2 ).has_error() );
+
+    auto coloring = pattern.color_columns();
+    EXPECT_EQ( coloring.num_colors(), 3 );
+
+    // No two columns of a color may share a row
+    for( size_t r = 0; r < pattern.rows(); r++ )
+    {
+        std::vector<int> seen( coloring.num_colors(), 0 );
+        for( const auto c : pattern.row_columns( r ) )
+        {
+            EXPECT_EQ( seen[coloring.color[c]]++, 0 );
+        }
+    }
+}
+
+/************************************************/
+/*      The coloring is cached until the        */
+/*      pattern changes                         */
+/************************************************/
+TEST( Jacobian_Sparsity, cached_coloring )
+{
+    tmx::optimize::Jacobian_Sparsity pattern( 2, 3 );
+    ASSERT_FALSE( pattern.add( 0, 0 ).has_error() );
+    ASSERT_FALSE( pattern.add( 1, 1 ).has_error() );
+
+    const auto* first = &pattern.coloring();
+    EXPECT_EQ( first, &pattern.coloring() );
+    EXPECT_EQ( first->num_colors(), 1 );
+    EXPECT_EQ( first->color, pattern.color_columns().color );
+
+    // Column 2 now shares row 0 with column 0
+    ASSERT_FALSE( pattern.add( 0, 2 ).has_error() );
+    EXPECT_EQ( pattern.coloring().num_colors(), 2 );
+    EXPECT_EQ( pattern.coloring().color, pattern.color_columns().color );
+
+    // Copies recolor on demand
+    auto copy = pattern;
+    EXPECT_NE( &copy.coloring(), &pattern.coloring() );
+    EXPECT_EQ( copy.coloring().color, pattern.coloring().color );
+}
+
+/************************************************/
+/*      Colored differences match the dense     */
+/*      ones with colors + 1 evaluations        */
+/************************************************/
+TEST( Jacobian_Sparsity, colored_jacobian )
+{
+    const size_t n = 40;
+    Track_Smoothing_Model model( n );
+    tmx::VectorN<double> x( n );
+    for( size_t i = 0; i < n; i++ )
+    {
+        x(i) = 0.1 * i;
+    }
+
+    // Reference:  one column at a time
+    const auto h0 = model( x );
+    tmx::MatrixN<double> J_dense( h0.size(), n );
+    tmx::optimize::finite_difference_jacobian( model, x, h0, J_dense );
+
+    model.evaluations = 0;
+    auto J = model.jacobian( x );
+    EXPECT_EQ( model.evaluations.load(), 4 );
+
+    model.set_jacobian_threads( 3 );
+    auto sparse = model.sparse_jacobian( x );
+    ASSERT_FALSE( sparse.has_error() );
+    ASSERT_EQ( sparse.value().nonzeros(), model.jacobian_sparsity().nonzeros() );
+    auto J_sparse = sparse.value().to_dense();
+
+    for( size_t r = 0; r < h0.size(); r++ )
+    {
+        for( size_t c = 0; c < n; c++ )
+        {
+            EXPECT_NEAR( J( r, c ), J_dense( r, c ), 1e-12 );
+            EXPECT_EQ( J( r, c ), J_sparse( r, c ) );
+            EXPECT_EQ( J( r, c ), sparse.value()( r, c ) );
+        }
+    }
+
+    // Compressed-row products agree with the dense Jacobian
+    tmx::VectorN<double> v( n, 1.0 ), y( h0.size() ), yt( n );
+    sparse.value().apply( v, y );
+    for( size_t r = 0; r < h0.size(); r++ )
+    {
+        double s = 0;
+        for( size_t c = 0; c < n; c++ )
+        {
+            s += J( r, c );
+        }
+        EXPECT_NEAR( y[r], s, 1e-12 );
+    }
+    tmx::VectorN<double> w( h0.size(), 1.0 );
+    sparse.value().apply_transpose( w, yt );
+    for( size_t c = 0; c < n; c++ )
+    {
+        double s = 0;
+        for( size_t r = 0; r < h0.size(); r++ )
+        {
+            s += J( r, c );
+        }
+        EXPECT_NEAR( yt[c], s, 1e-12 );
+    }
+}
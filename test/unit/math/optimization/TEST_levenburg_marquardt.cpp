@@ -19,6 +19,13 @@
 #include <terminus/math/optimization/levenburg_marquardt.hpp>
 #include <terminus/math/vector/sub_vector.hpp>
 
+// Test Libraries
+#include "../../alloc_counter.hpp"
+
+// C++ Libraries
+#include <atomic>
+#include <vector>
+
 namespace tmx = tmns::math;
 
 /**
@@ -46,6 +53,71 @@ struct Test_Least_Squares_Model : public tmx::optimize::Least_Squares_Model_Base
     }
 }; // End of Test_Least_Squares_Model class
 
+/**
+ * Same model again, counting how often it is evaluated
+*/
+struct Test_Counting_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Counting_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    /// Evaluate h(x)
+    result_type operator()( domain_type const& x ) const
+    {
+        evaluations++;
+        return Test_Least_Squares_Model()( x );
+    }
+
+    mutable std::atomic<size_t> evaluations { 0 };
+}; // End of Test_Counting_Model class
+
+/**
+ * Same model, templated on its scalar type so the Jacobian comes from automatic differentiation
+*/
+struct Test_Autodiff_Model : public tmx::optimize::Least_Squares_Model_Base<Test_Autodiff_Model>
+{
+    using result_type   = tmx::VectorN<double>;
+    using domain_type   = tmx::VectorN<double>;
+    using jacobian_type = tmx::MatrixN<double>;
+
+    /// Evaluate h(x)
+    template <typename T>
+    tmx::VectorN<T> operator()( tmx::VectorN<T> const& x ) const
+    {
+        using std::sin, std::cos, std::atan2;
+        tmx::VectorN<T> h(5);
+        h(0) = sin(x(0)+0.1);
+        h(1) = cos(x(1) * x(2));
+        h(2) = x(1) * cos(x(2));
+        h(3) = atan2(x(0),x(3));
+        h(4) = atan2(x(2),x(1));
+        return h;
+    }
+}; // End of Test_Autodiff_Model class
+
+/**
+ * Same model again, with compile-time sizes
+*/
+struct Test_Fixed_Model : public tmx::optimize::Least_Squares_Model_Base_Fixed<Test_Fixed_Model,4,5>
+{
+    using result_type   = tmx::Vector_<double,5>;
+    using domain_type   = tmx::Vector_<double,4>;
+    using jacobian_type = tmx::Matrix<double,5,4>;
+
+    /// Evaluate h(x)
+    result_type operator()( domain_type const& x ) const
+    {
+        result_type h;
+        h(0) = std::sin(x(0)+0.1);
+        h(1) = std::cos(x(1) * x(2));
+        h(2) = x(1) * std::cos(x(2));
+        h(3) = std::atan2(x(0),x(3));
+        h(4) = std::atan2(x(2),x(1));
+        return h;
+    }
+}; // End of Test_Fixed_Model class
+
 TEST( Levenberg_Marquardt, least_squares_model )
 {
 
@@ -109,4 +181,189 @@ TEST( Levenberg_Marquardt, levenberg_marquardt )
     ASSERT_EQ( tmx::optimize::LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE, status );
 
     EXPECT_NEAR( tmx::VectorN<double>( expected_best - best.value() ).magnitude(), 0, 1e-5 );
-}
\ No newline at end of file
+}
+
+/************************************************/
+/*      Jacobian and solve through autodiff     */
+/************************************************/
+TEST( Levenberg_Marquardt, autodiff_model )
+{
+    static_assert( tmx::optimize::Autodiff_Model<Test_Autodiff_Model,tmx::VectorN<double>> );
+    static_assert( !tmx::optimize::Autodiff_Model<Test_Least_Squares_Model,tmx::VectorN<double>> );
+
+    Test_Autodiff_Model      ad_model;
+    Test_Least_Squares_Model fd_model;
+
+    tmx::VectorN<double> x( { 0.2, 0.3, 0.4, 0.5 } );
+    auto J_ad = ad_model.jacobian( x );
+    auto J_fd = fd_model.jacobian( x );
+
+    ASSERT_EQ( J_ad.rows(), 5 );
+    ASSERT_EQ( J_ad.cols(), 4 );
+    for( size_t r = 0; r < J_ad.rows(); r++ )
+    {
+        for( size_t c = 0; c < J_ad.cols(); c++ )
+        {
+            EXPECT_NEAR( J_ad( r, c ), J_fd( r, c ), 1e-6 );
+        }
+    }
+    EXPECT_NEAR( J_ad( 2, 2 ), -0.3 * std::sin( 0.4 ), 1e-15 );
+
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::VectorN<double> seed( 4, 1.0 );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto best = tmx::optimize::levenberg_marquardt( ad_model, seed, target, status );
+    ASSERT_FALSE( best.has_error() );
+
+    tmx::Vector_<double,4> expected_best( { 0.101358, 1.15485, 1.12093, 0.185534 } );
+    EXPECT_NEAR( tmx::VectorN<double>( expected_best - best.value() ).magnitude(), 0, 1e-5 );
+}
+
+/************************************************/
+/*      Threaded finite differences match the   */
+/*      serial Jacobian exactly                 */
+/************************************************/
+TEST( Levenberg_Marquardt, parallel_jacobian )
+{
+    Test_Least_Squares_Model model;
+    tmx::VectorN<double> x( { 0.2, 0.3, 0.4, 0.5 } );
+    auto J_serial = model.jacobian( x );
+
+    model.set_jacobian_threads( 3 );
+    ASSERT_EQ( model.jacobian_threads(), 3 );
+    auto J_parallel = model.jacobian( x );
+
+    Test_Fixed_Model fixed_model;
+    fixed_model.set_jacobian_threads( 0 );
+    auto J_fixed = fixed_model.jacobian( tmx::Vector_<double,4>( { 0.2, 0.3, 0.4, 0.5 } ) );
+
+    ASSERT_EQ( J_parallel.rows(), 5 );
+    ASSERT_EQ( J_parallel.cols(), 4 );
+    for( size_t r = 0; r < 5; r++ )
+    {
+        for( size_t c = 0; c < 4; c++ )
+        {
+            EXPECT_EQ( J_serial( r, c ), J_parallel( r, c ) );
+            EXPECT_EQ( J_serial( r, c ), J_fixed( r, c ) );
+        }
+    }
+}
+
+/************************************************/
+/*      Fixed-size LM runs without touching     */
+/*      the heap                                */
+/************************************************/
+TEST( Levenberg_Marquardt, levenberg_marquardt_fixed )
+{
+    Test_Fixed_Model model;
+    tmx::Vector_<double,5> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::Vector_<double,4> seed( { 1.0, 1.0, 1.0, 1.0 } );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    const size_t allocations_before = tmns::test::allocation_count();
+    auto best = tmx::optimize::levenberg_marquardt_fixed( model, seed, target, status );
+    const size_t allocations = tmns::test::allocation_count() - allocations_before;
+
+    ASSERT_FALSE( best.has_error() );
+    EXPECT_EQ( allocations, 0 );
+    EXPECT_EQ( tmx::optimize::LM_STATUS_CODE::ERROR_CONVERGED_REL_TOLERANCE, status );
+
+    tmx::Vector_<double,4> expected_best( { 0.101358, 1.15485, 1.12093, 0.185534 } );
+    for( size_t i = 0; i < 4; i++ )
+    {
+        EXPECT_NEAR( expected_best[i], best.value()[i], 1e-5 );
+    }
+}
+
+/************************************************/
+/*      Each point is evaluated exactly once    */
+/************************************************/
+TEST( Levenberg_Marquardt, evaluation_counts )
+{
+    Test_Counting_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::VectorN<double> seed( 4, 1.0 );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Statistics  statistics;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, target, status, statistics );
+    ASSERT_FALSE( best.has_error() );
+
+    tmx::Vector_<double,4> expected_best( { 0.101358, 1.15485, 1.12093, 0.185534 } );
+    EXPECT_NEAR( tmx::VectorN<double>( expected_best - best.value() ).magnitude(), 0, 1e-5 );
+
+    // One evaluation at the seed, one per trial step, and one per column per Jacobian
+    EXPECT_GT( statistics.outer_iterations, 0 );
+    EXPECT_EQ( statistics.jacobian_evaluations, statistics.outer_iterations );
+    EXPECT_EQ( statistics.model_evaluations, 1 + statistics.inner_iterations );
+    EXPECT_EQ( model.evaluations.load(), statistics.model_evaluations + 4 * statistics.jacobian_evaluations );
+    EXPECT_LT( statistics.final_norm, statistics.initial_norm );
+
+    Test_Fixed_Model fixed_model;
+    tmx::optimize::LM_Statistics fixed_statistics;
+    auto fixed_best = tmx::optimize::levenberg_marquardt_fixed( fixed_model,
+                                                                tmx::Vector_<double,4>( { 1.0, 1.0, 1.0, 1.0 } ),
+                                                                tmx::Vector_<double,5>( { 0.2, 0.3, 0.4, 0.5, 0.6 } ),
+                                                                status, fixed_statistics );
+    ASSERT_FALSE( fixed_best.has_error() );
+    EXPECT_EQ( fixed_statistics.outer_iterations, statistics.outer_iterations );
+    EXPECT_EQ( fixed_statistics.model_evaluations, 1 + fixed_statistics.inner_iterations );
+    EXPECT_NEAR( fixed_statistics.final_norm, statistics.final_norm, 1e-12 );
+}
+
+/************************************************/
+/*      Telemetry receives one record per       */
+/*      outer iteration                         */
+/************************************************/
+TEST( Levenberg_Marquardt, telemetry )
+{
+    Test_Counting_Model model;
+    tmx::VectorN<double> target( { 0.2, 0.3, 0.4, 0.5, 0.6 } );
+    tmx::VectorN<double> seed( 4, 1.0 );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::optimize::LM_Statistics  statistics;
+    std::vector<tmx::optimize::LM_Iteration_Telemetry> records;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, target, status, statistics,
+                                                    [&]( const tmx::optimize::LM_Iteration_Telemetry& record )
+                                                    {
+                                                        records.push_back( record );
+                                                    } );
+    ASSERT_FALSE( best.has_error() );
+
+    // Same answer as without telemetry
+    tmx::optimize::LM_Statistics quiet_statistics;
+    auto quiet_best = tmx::optimize::levenberg_marquardt( model, seed, target, status, quiet_statistics );
+    ASSERT_FALSE( quiet_best.has_error() );
+    EXPECT_EQ( tmx::VectorN<double>( quiet_best.value() - best.value() ).magnitude(), 0 );
+    EXPECT_EQ( quiet_statistics.inner_iterations, statistics.inner_iterations );
+
+    ASSERT_EQ( records.size(), statistics.outer_iterations );
+    size_t inner_iterations = 0;
+    for( size_t i = 0; i < records.size(); i++ )
+    {
+        const auto& record = records[i];
+        EXPECT_EQ( record.iteration, i + 1 );
+        EXPECT_GT( record.inner_iterations, 0 );
+        EXPECT_GT( record.lambda, 0 );
+        EXPECT_GE( record.step_norm, 0 );
+        EXPECT_GE( record.model_time.count(), 0 );
+        EXPECT_GE( record.jacobian_time.count(), 0 );
+        EXPECT_GE( record.normal_equations_time.count(), 0 );
+        EXPECT_GE( record.solve_time.count(), 0 );
+        if( record.accepted )
+        {
+            EXPECT_LE( record.norm_try, record.norm_start );
+        }
+        inner_iterations += record.inner_iterations;
+        EXPECT_EQ( record.model_evaluations, 1 + inner_iterations );
+        EXPECT_EQ( record.jacobian_evaluations, i + 1 );
+    }
+    EXPECT_EQ( inner_iterations, statistics.inner_iterations );
+    EXPECT_EQ( records.front().norm_start, statistics.initial_norm );
+
+    // The logging adapter is accepted as telemetry too
+    EXPECT_FALSE( tmx::optimize::levenberg_marquardt( model, seed, target, status, statistics,
+                                                      tmx::optimize::LM_Log_Telemetry() ).has_error() );
+}
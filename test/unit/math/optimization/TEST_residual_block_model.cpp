@@ -0,0 +1,252 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_residual_block_model.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/levenburg_marquardt.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <stdexcept>
+
+namespace tmx = tmns::math;
+
+/**
+ * Errors-in-variables curve fit.  Parameter block 0 holds the curve ( a, b ), and block
+ * i + 1 holds the latent abscissa t_i of sample i.  Residual block i predicts the sample
+ * ( t_i, a * exp( 0.1 * t_i ) + b ) from the curve and its own abscissa.
+*/
+template <typename ImplT>
+struct Curve_Fit_Common : public tmx::optimize::Residual_Block_Model_Base<ImplT>
+{
+    explicit Curve_Fit_Common( size_t num_samples )
+        : m_sizes( num_samples + 1, 1 )
+    {
+        m_sizes[0] = 2;
+        for( size_t i = 0; i < num_samples; i++ )
+        {
+            m_blocks.push_back( { 2, { 0, i + 1 } } );
+        }
+    }
+
+    const std::vector<size_t>& parameter_block_sizes() const
+    {
+        return m_sizes;
+    }
+
+    const std::vector<tmx::optimize::Residual_Block_Spec>& residual_blocks() const
+    {
+        return m_blocks;
+    }
+
+    template <typename T>
+    static void predict( const T* curve,
+                         const T* t,
+                         std::span<T> residuals )
+    {
+        using std::exp;
+        residuals[0] = t[0];
+        residuals[1] = curve[0] * exp( 0.1 * t[0] ) + curve[1];
+    }
+
+    std::vector<size_t> m_sizes;
+    std::vector<tmx::optimize::Residual_Block_Spec> m_blocks;
+}; // End of Curve_Fit_Common struct
+
+/**
+ * Plain evaluate_block(), differentiated by finite differences
+ */
+struct Curve_Fit_FD_Model : public Curve_Fit_Common<Curve_Fit_FD_Model>
+{
+    using Curve_Fit_Common<Curve_Fit_FD_Model>::Curve_Fit_Common;
+
+    void evaluate_block( size_t,
+                         std::span<const double* const> parameters,
+                         std::span<double>              residuals ) const
+    {
+        predict( parameters[0], parameters[1], residuals );
+    }
+}; // End of Curve_Fit_FD_Model struct
+
+/**
+ * Templated evaluate_block(), differentiated on jets
+ */
+struct Curve_Fit_AD_Model : public Curve_Fit_Common<Curve_Fit_AD_Model>
+{
+    using Curve_Fit_Common<Curve_Fit_AD_Model>::Curve_Fit_Common;
+
+    template <typename T>
+    void evaluate_block( size_t,
+                         std::span<const T* const> parameters,
+                         std::span<T>              residuals ) const
+    {
+        predict( parameters[0], parameters[1], residuals );
+    }
+}; // End of Curve_Fit_AD_Model struct
+
+/**
+ * Hand-written block Jacobians
+ */
+struct Curve_Fit_Analytic_Model : public Curve_Fit_Common<Curve_Fit_Analytic_Model>
+{
+    using Curve_Fit_Common<Curve_Fit_Analytic_Model>::Curve_Fit_Common;
+
+    void evaluate_block( size_t,
+                         std::span<const double* const> parameters,
+                         std::span<double>              residuals ) const
+    {
+        predict( parameters[0], parameters[1], residuals );
+    }
+
+    void block_jacobian( size_t,
+                         std::span<const double* const> parameters,
+                         std::span<double>              jacobian ) const
+    {
+        const double a = parameters[0][0];
+        const double t = parameters[1][0];
+        const double g = std::exp( 0.1 * t );
+        // Columns:  a, b, t
+        jacobian[0] = 0; jacobian[1] = 0; jacobian[2] = 1;
+        jacobian[3] = g; jacobian[4] = 1; jacobian[5] = 0.1 * a * g;
+    }
+}; // End of Curve_Fit_Analytic_Model struct
+
+/**
+ * Evaluation point ( a, b, t_0, ..., t_n-1 )
+ */
+static tmx::VectorN<double> make_point( size_t num_samples,
+                                        double a,
+                                        double b,
+                                        double offset )
+{
+    tmx::VectorN<double> x( num_samples + 2 );
+    x[0] = a;
+    x[1] = b;
+    for( size_t i = 0; i < num_samples; i++ )
+    {
+        x[i + 2] = 4.0 * i / num_samples + offset * std::sin( double( i ) );
+    }
+    return x;
+}
+
+/************************************************/
+/*      Analytic, automatic and finite          */
+/*      difference block Jacobians agree        */
+/************************************************/
+TEST( Residual_Block_Model, block_jacobians )
+{
+    const size_t n = 50;
+    Curve_Fit_FD_Model       fd_model( n );
+    Curve_Fit_AD_Model       ad_model( n );
+    Curve_Fit_Analytic_Model analytic_model( n );
+    const auto x = make_point( n, 1.5, -0.3, 0.05 );
+
+    ASSERT_FALSE( fd_model.check_structure( x ).has_error() );
+    EXPECT_TRUE( fd_model.check_structure( tmx::VectorN<double>( n ) ).has_error() );
+    EXPECT_THROW( fd_model( tmx::VectorN<double>( n ) ), std::runtime_error );
+    EXPECT_THROW( fd_model.jacobian( tmx::VectorN<double>( n ) ), std::runtime_error );
+    ASSERT_EQ( fd_model.layout().num_parameters(), n + 2 );
+    ASSERT_EQ( fd_model.layout().num_residuals(), 2 * n );
+
+    // Stacked evaluation, serial and threaded
+    const auto h = fd_model( x );
+    ad_model.set_block_threads( 4 );
+    const auto h_threaded = ad_model( x );
+    ASSERT_EQ( h.size(), 2 * n );
+    for( size_t r = 0; r < h.size(); r++ )
+    {
+        EXPECT_EQ( h[r], h_threaded[r] );
+    }
+
+    // Reference:  dense differences of the stacked model
+    tmx::MatrixN<double> J_ref( h.size(), x.size() );
+    tmx::optimize::finite_difference_jacobian( fd_model, x, h, J_ref );
+
+    const auto J_fd       = fd_model.jacobian( x );
+    const auto J_ad       = ad_model.jacobian( x );
+    const auto J_analytic = analytic_model.jacobian( x );
+    auto sparse = ad_model.sparse_jacobian( x );
+    ASSERT_FALSE( sparse.has_error() );
+    EXPECT_EQ( sparse.value().nonzeros(), 2 * n * 3 );
+    const auto J_sparse = sparse.value().to_dense();
+
+    for( size_t r = 0; r < h.size(); r++ )
+    {
+        for( size_t c = 0; c < x.size(); c++ )
+        {
+            EXPECT_EQ( J_fd( r, c ), J_ref( r, c ) );
+            EXPECT_NEAR( J_ad( r, c ), J_ref( r, c ), 1e-6 );
+            EXPECT_NEAR( J_analytic( r, c ), J_ad( r, c ), 1e-12 );
+            EXPECT_EQ( J_sparse( r, c ), J_ad( r, c ) );
+        }
+    }
+}
+
+/************************************************/
+/*      Normal equations scattered per block    */
+/*      match the dense product                 */
+/************************************************/
+TEST( Residual_Block_Model, normal_equations )
+{
+    const size_t n = 400;
+    Curve_Fit_AD_Model model( n );
+    const auto x = make_point( n, 0.7, 0.2, 0.1 );
+    tmx::VectorN<double> e( 2 * n );
+    for( size_t r = 0; r < e.size(); r++ )
+    {
+        e[r] = std::cos( 0.3 * r );
+    }
+
+    tmx::MatrixN<double> JtJ_ref, JtJ, JtJ_threaded;
+    tmx::VectorN<double> Jte_ref, Jte, Jte_threaded;
+    ASSERT_FALSE( tmx::linalg::normal_equations( model.jacobian( x ), e, JtJ_ref, Jte_ref ).has_error() );
+    ASSERT_FALSE( model.normal_equations( x, e, JtJ, Jte ).has_error() );
+    model.set_block_threads( 3 );
+    ASSERT_FALSE( model.normal_equations( x, e, JtJ_threaded, Jte_threaded ).has_error() );
+
+    for( size_t i = 0; i < x.size(); i++ )
+    {
+        EXPECT_NEAR( Jte[i], Jte_ref[i], 1e-10 );
+        EXPECT_NEAR( Jte_threaded[i], Jte_ref[i], 1e-10 );
+        for( size_t j = 0; j < x.size(); j++ )
+        {
+            EXPECT_NEAR( JtJ( i, j ), JtJ_ref( i, j ), 1e-10 );
+            EXPECT_NEAR( JtJ_threaded( i, j ), JtJ_ref( i, j ), 1e-10 );
+        }
+    }
+
+    tmx::VectorN<double> short_error( 2 * n - 1 );
+    EXPECT_TRUE( model.normal_equations( x, short_error, JtJ, Jte ).has_error() );
+}
+
+/************************************************/
+/*      levenberg_marquardt on a residual       */
+/*      block model                             */
+/************************************************/
+TEST( Residual_Block_Model, levenberg_marquardt )
+{
+    const size_t n = 40;
+    Curve_Fit_AD_Model model( n );
+    model.set_block_threads( 2 );
+    const auto truth       = make_point( n, 1.2, 0.4, 0.0 );
+    const auto observation = model( truth );
+    const auto seed        = make_point( n, 0.8, 0.0, 0.05 );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto best = tmx::optimize::levenberg_marquardt( model, seed, observation, status );
+    ASSERT_FALSE( best.has_error() );
+    EXPECT_NEAR( best.value()[0], 1.2, 1e-6 );
+    EXPECT_NEAR( best.value()[1], 0.4, 1e-6 );
+}
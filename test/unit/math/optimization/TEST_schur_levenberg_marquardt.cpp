@@ -0,0 +1,174 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_schur_levenberg_marquardt.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/optimization/schur_levenberg_marquardt.hpp>
+
+// C++ Libraries
+#include <random>
+#include <stdexcept>
+
+namespace tmx = tmns::math;
+
+/**
+ * Translation-only cameras observing 3D points through a unit pinhole.  Every camera
+ * sees every point.
+*/
+struct Pinhole_Model : public tmx::optimize::Block_Least_Squares_Model_Base<Pinhole_Model,3,3,2>
+{
+    Pinhole_Model( size_t num_cameras,
+                   size_t num_points )
+        : m_num_cameras( num_cameras ),
+          m_num_points( num_points )
+    {
+        for( size_t c = 0; c < num_cameras; c++ )
+        {
+            for( size_t p = 0; p < num_points; p++ )
+            {
+                m_blocks.push_back( { c, p } );
+            }
+        }
+    }
+
+    size_t num_poses() const { return m_num_cameras; }
+
+    size_t num_landmarks() const { return m_num_points; }
+
+    const std::vector<tmx::optimize::Residual_Block>& residual_blocks() const
+    {
+        return m_blocks;
+    }
+
+    block_result_type evaluate_block( size_t,
+                                      const pose_type&     camera,
+                                      const landmark_type& point ) const
+    {
+        const double dx = point[0] - camera[0];
+        const double dy = point[1] - camera[1];
+        const double dz = point[2] - camera[2];
+        return block_result_type( { dx / dz, dy / dz } );
+    }
+
+    size_t m_num_cameras;
+    size_t m_num_points;
+    std::vector<tmx::optimize::Residual_Block> m_blocks;
+}; // End of Pinhole_Model class
+
+/**
+ * Ground truth, noise-free observations and a perturbed seed
+ */
+static void make_problem( const Pinhole_Model&  model,
+                          tmx::VectorN<double>& seed,
+                          tmx::VectorN<double>& observation )
+{
+    std::mt19937 rng( 11 );
+    std::uniform_real_distribution<double> lateral( -2.0, 2.0 );
+    std::uniform_real_distribution<double> depth( 4.0, 8.0 );
+    std::uniform_real_distribution<double> noise( -0.05, 0.05 );
+
+    tmx::VectorN<double> truth( model.num_parameters() );
+    for( size_t c = 0; c < model.num_poses(); c++ )
+    {
+        truth[3 * c]     = 0.5 * c;
+        truth[3 * c + 1] = 0.1 * c;
+        truth[3 * c + 2] = 0;
+    }
+    for( size_t p = 0; p < model.num_landmarks(); p++ )
+    {
+        const size_t offset = model.landmark_offset( p );
+        truth[offset]     = lateral( rng );
+        truth[offset + 1] = lateral( rng );
+        truth[offset + 2] = depth( rng );
+    }
+
+    observation = model( truth );
+    seed = truth;
+    for( size_t i = 0; i < seed.size(); i++ )
+    {
+        seed[i] += noise( rng );
+    }
+}
+
+/************************************************/
+/*      One Schur step equals one dense step    */
+/************************************************/
+TEST( Schur_Levenberg_Marquardt, matches_dense_step )
+{
+    Pinhole_Model model( 4, 30 );
+    tmx::VectorN<double> seed, observation;
+    make_problem( model, seed, observation );
+    ASSERT_EQ( seed.size(), 4 * 3 + 30 * 3 );
+    ASSERT_EQ( observation.size(), 4 * 30 * 2 );
+
+    tmx::optimize::LM_STATUS_CODE status;
+    auto dense = tmx::optimize::levenberg_marquardt( model, seed, observation, status,
+                                                     MATH_LM_ABS_TOL, MATH_LM_REL_TOL, 1 );
+    ASSERT_FALSE( dense.has_error() );
+
+    tmx::optimize::Schur_LM_Options options;
+    options.max_iterations = 1;
+    auto schur = tmx::optimize::levenberg_marquardt_schur( model, seed, observation, status, options );
+    ASSERT_FALSE( schur.has_error() );
+
+    options.reduced_solver = tmx::optimize::Schur_Solver_Type::CONJUGATE_GRADIENT;
+    options.pcg_options.relative_tolerance = 1e-14;
+    auto schur_pcg = tmx::optimize::levenberg_marquardt_schur( model, seed, observation, status, options );
+    ASSERT_FALSE( schur_pcg.has_error() );
+
+    for( size_t i = 0; i < seed.size(); i++ )
+    {
+        EXPECT_NEAR( schur.value()[i], dense.value()[i], 1e-8 );
+        EXPECT_NEAR( schur_pcg.value()[i], dense.value()[i], 1e-8 );
+    }
+}
+
+/************************************************/
+/*      Full solve drives the reprojection      */
+/*      error to zero                           */
+/************************************************/
+TEST( Schur_Levenberg_Marquardt, converges )
+{
+    Pinhole_Model model( 5, 200 );
+    tmx::VectorN<double> seed, observation;
+    make_problem( model, seed, observation );
+
+    const double start_norm = model.difference( observation, model( seed ) ).magnitude();
+
+    for( const auto solver : { tmx::optimize::Schur_Solver_Type::DENSE_CHOLESKY,
+                               tmx::optimize::Schur_Solver_Type::CONJUGATE_GRADIENT } )
+    {
+        tmx::optimize::Schur_LM_Options options;
+        options.reduced_solver = solver;
+
+        tmx::optimize::LM_STATUS_CODE status = tmx::optimize::LM_STATUS_CODE::ERROR_STATUS_UNKNOWN;
+        auto best = tmx::optimize::levenberg_marquardt_schur( model, seed, observation, status, options );
+        ASSERT_FALSE( best.has_error() );
+        EXPECT_NE( status, tmx::optimize::LM_STATUS_CODE::ERROR_STATUS_UNKNOWN );
+
+        const double final_norm = model.difference( observation, model( best.value() ) ).magnitude();
+        EXPECT_LT( final_norm, 1e-6 * start_norm );
+    }
+
+    // Mismatched sizes are rejected
+    tmx::optimize::LM_STATUS_CODE status;
+    tmx::VectorN<double> short_seed( seed.size() - 1 );
+    EXPECT_TRUE( tmx::optimize::levenberg_marquardt_schur( model, short_seed, observation, status ).has_error() );
+    tmx::VectorN<double> short_observation( observation.size() - 2 );
+    EXPECT_TRUE( tmx::optimize::levenberg_marquardt_schur( model, seed, short_observation, status ).has_error() );
+
+    // Evaluating the model directly validates the structure too
+    EXPECT_THROW( model( short_seed ), std::runtime_error );
+}
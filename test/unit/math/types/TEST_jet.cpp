@@ -0,0 +1,143 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2024 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/***************************# INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    TEST_jet.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/math/matrix.hpp>
+#include <terminus/math/matrix/matrix_operations.hpp>
+#include <terminus/math/types/jet.hpp>
+#include <terminus/math/vector/vector.hpp>
+
+namespace tmx = tmns::math;
+
+/************************************************/
+/*      Check derivatives of the elementary     */
+/*      functions against their closed forms    */
+/************************************************/
+TEST( Jet, elementary_functions )
+{
+    using J2 = tmx::Jet<double,2>;
+    static_assert( tmx::Is_Scalar<J2>::value );
+
+    const double a = 0.7, b = 1.3;
+    J2 x( a, 0 );
+    J2 y( b, 1 );
+
+    auto f = x * y + 3.0 * x - y / 2.0;
+    EXPECT_NEAR( f.value(), a * b + 3 * a - b / 2, 1e-15 );
+    EXPECT_NEAR( f.gradient()[0], b + 3, 1e-15 );
+    EXPECT_NEAR( f.gradient()[1], a - 0.5, 1e-15 );
+
+    auto q = x / y;
+    EXPECT_NEAR( q.gradient()[0],  1 / b, 1e-15 );
+    EXPECT_NEAR( q.gradient()[1], -a / ( b * b ), 1e-15 );
+
+    auto s = sin( x ) * exp( y ) + sqrt( x * y ) - log( y );
+    EXPECT_NEAR( s.gradient()[0], std::cos( a ) * std::exp( b ) + 0.5 * b / std::sqrt( a * b ), 1e-12 );
+    EXPECT_NEAR( s.gradient()[1], std::sin( a ) * std::exp( b ) + 0.5 * a / std::sqrt( a * b ) - 1 / b, 1e-12 );
+
+    auto t = atan2( x, y );
+    EXPECT_NEAR( t.value(), std::atan2( a, b ), 1e-15 );
+    EXPECT_NEAR( t.gradient()[0],  b / ( a * a + b * b ), 1e-15 );
+    EXPECT_NEAR( t.gradient()[1], -a / ( a * a + b * b ), 1e-15 );
+
+    auto p = pow( x, 3.0 ) + pow( 2.0, y ) + pow( x, y );
+    EXPECT_NEAR( p.gradient()[0], 3 * a * a + b * std::pow( a, b - 1 ), 1e-12 );
+    EXPECT_NEAR( p.gradient()[1], std::pow( 2.0, b ) * std::log( 2.0 ) + std::pow( a, b ) * std::log( a ), 1e-12 );
+
+    // A constant Jet exponent on a base <= 0 matches the scalar exponent
+    auto neg = pow( J2( -3.0, 0 ), J2( 2.0 ) );
+    EXPECT_NEAR( neg.value(), 9, 1e-15 );
+    EXPECT_NEAR( neg.gradient()[0], -6, 1e-15 );
+    EXPECT_NEAR( neg.gradient()[1], 0, 1e-15 );
+    auto zero = pow( J2( 0.0, 0 ), J2( 2.0 ) );
+    EXPECT_NEAR( zero.value(), 0, 1e-15 );
+    EXPECT_NEAR( zero.gradient()[0], 0, 1e-15 );
+    EXPECT_FALSE( isnan( zero ) );
+
+    auto n = abs( -x ) + fabs( y );
+    EXPECT_NEAR( n.gradient()[0], 1, 1e-15 );
+    EXPECT_NEAR( n.gradient()[1], 1, 1e-15 );
+
+    EXPECT_TRUE( x < y );
+    EXPECT_TRUE( x < 1.0 );
+    EXPECT_TRUE( 1.0 < y );
+}
+
+/************************************************/
+/*      Dynamic gradients treat constants as    */
+/*      having an all-zero gradient             */
+/************************************************/
+TEST( Jet, dynamic_gradient )
+{
+    using JN = tmx::Jet<double>;
+    JN x( 2.0, 0, 3 );
+    JN z( 5.0, 2, 3 );
+    JN c( 4.0 );
+
+    EXPECT_TRUE( c.gradient().empty() );
+
+    auto f = c * x * z + c;
+    ASSERT_EQ( f.gradient().size(), 3 );
+    EXPECT_DOUBLE_EQ( f.value(), 44.0 );
+    EXPECT_DOUBLE_EQ( f.derivative( 0 ), 20.0 );
+    EXPECT_DOUBLE_EQ( f.derivative( 1 ), 0.0 );
+    EXPECT_DOUBLE_EQ( f.derivative( 2 ), 8.0 );
+    EXPECT_DOUBLE_EQ( f.derivative( 7 ), 0.0 );
+
+    JN g = c;
+    g -= x;
+    g *= z;
+    EXPECT_DOUBLE_EQ( g.value(), 10.0 );
+    EXPECT_DOUBLE_EQ( g.derivative( 0 ), -5.0 );
+    EXPECT_DOUBLE_EQ( g.derivative( 2 ), 2.0 );
+}
+
+/************************************************/
+/*      Jets flow through Vector_ and Matrix    */
+/************************************************/
+TEST( Jet, vector_and_matrix )
+{
+    using J2 = tmx::Jet<double,2>;
+    J2 x( 0.5, 0 );
+    J2 y( 2.0, 1 );
+
+    tmx::Vector_<J2,2> v( { x, y } );
+    tmx::Matrix<J2,2,2> R( { J2( 2.0 ), J2( 1.0 ),
+                             J2( 0.0 ), J2( 3.0 ) } );
+
+    // R * v, then scaled by a jet
+    tmx::Vector_<J2,2> Rv = R * v;
+    tmx::Vector_<J2,2> w  = x * Rv;
+    EXPECT_NEAR( w[0].value(), 0.5 * ( 2 * 0.5 + 2.0 ), 1e-15 );
+    EXPECT_NEAR( w[0].gradient()[0], 2 * 0.5 * 2 + 2.0, 1e-15 );
+    EXPECT_NEAR( w[0].gradient()[1], 0.5, 1e-15 );
+    EXPECT_NEAR( w[1].value(), 0.5 * 6.0, 1e-15 );
+    EXPECT_NEAR( w[1].gradient()[0], 6.0, 1e-15 );
+    EXPECT_NEAR( w[1].gradient()[1], 1.5, 1e-15 );
+
+    // The determinant kernel is generic in its scalar type
+    tmx::Matrix<J2,2,2> M( { x, y,
+                             y, x } );
+    auto det = M.determinant();
+    EXPECT_NEAR( det.value(), 0.25 - 4.0, 1e-15 );
+    EXPECT_NEAR( det.gradient()[0],  1.0, 1e-15 );
+    EXPECT_NEAR( det.gradient()[1], -4.0, 1e-15 );
+
+    // Element-wise functors
+    tmx::Matrix<J2,2,2> A = tmx::abs( -M );
+    EXPECT_NEAR( A( 0, 1 ).value(), 2.0, 1e-15 );
+    EXPECT_NEAR( A( 0, 1 ).gradient()[1], 1.0, 1e-15 );
+}